@@ -1,6 +1,8 @@
 #ifndef INC_BITMAPS_H_
 #define INC_BITMAPS_H_
 
+#include "ssd1306.h"
+
 extern const unsigned char menu[];
 extern const unsigned char fajerwerki1[];
 extern const unsigned char fajerwerki2[];
@@ -14,4 +16,10 @@ extern const unsigned char fajerwerki9[];
 extern const unsigned char fajerwerki10[];
 extern const unsigned char fajerwerki11[];
 
+/* menu in SSD1306 page layout, see Tools/gen_page_bitmaps.py */
+extern const unsigned char menu_pages[];
+
+/* fajerwerki1..11 as deltas, see Tools/gen_animation.py */
+extern const SSD1306_Animation_t fajerwerki_anim;
+
 #endif /* INC_BITMAPS_H_ */
@@ -0,0 +1,179 @@
+/*
+ * i2c_queue.h
+ *
+ * Interrupt driven I2C transaction queue. Every device on a bus shares one
+ * queue, so keypad polls, sensor reads and display writes interleave instead
+ * of blocking each other in HAL_I2C_* calls with long timeouts.
+ */
+
+#ifndef INC_I2C_QUEUE_H_
+#define INC_I2C_QUEUE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <_ansi.h>
+
+_BEGIN_STD_C
+
+#include "stm32l4xx_hal.h"
+#include "ssd1306.h"
+
+#ifndef I2CQ_TIMEOUT_MS
+#define I2CQ_TIMEOUT_MS 10  // An attempt running longer is aborted by i2cq_Poll()...
+#endif
+#ifndef I2CQ_BYTES_PER_MS
+#define I2CQ_BYTES_PER_MS 8 // ...plus 1 ms per this many data bytes (100 kHz: ~11 bytes per ms)
+#endif
+#ifndef I2CQ_DISPLAY_CHUNK
+#define I2CQ_DISPLAY_CHUNK 32 // Bytes per background display write, other devices get the bus in between
+#endif
+#ifndef I2CQ_WAIT
+#define I2CQ_WAIT()         // Run while i2cq_Transfer() waits, e.g. __WFI()
+#endif
+#ifndef I2CQ_RETRIES
+#define I2CQ_RETRIES 2      // Attempts repeated after a NACK or bus error, set by i2cq_SetupRead/Write()
+#endif
+
+typedef enum {
+    I2CQ_OK = 0,
+    I2CQ_PENDING,   // Queued or on the bus
+    I2CQ_NACK,      // Not acknowledged, retries used up
+    I2CQ_ERROR,     // Bus error, arbitration lost or the HAL refused the transfer
+    I2CQ_TIMEOUT    // Aborted by i2cq_Poll()
+} I2CQ_Status_t;
+
+// Queued transactions start in this order, in submit order within a priority
+typedef enum {
+    I2CQ_PRIORITY_HIGH = 0,     // Input, e.g. keypad polls
+    I2CQ_PRIORITY_NORMAL,       // Sensors
+    I2CQ_PRIORITY_LOW,          // Bulk writes, e.g. display pages
+    I2CQ_PRIORITIES
+} I2CQ_Priority_t;
+
+// Per device counters, see i2cq_ResetStats()
+typedef struct {
+    uint32_t Transactions;  // Finished transactions, failed ones included
+    uint32_t Bytes;         // Data bytes of the successful ones
+    uint32_t Nacks;         // Attempts the device did not acknowledge
+    uint32_t Retries;       // Attempts repeated after a NACK or bus error
+    uint32_t Errors;        // Transactions finished with I2CQ_NACK or I2CQ_ERROR
+    uint32_t Timeouts;      // Transactions finished with I2CQ_TIMEOUT
+    uint32_t LatencyMax;    // Submit to finish in microseconds, waiting in the queue included
+    uint32_t LatencySum;    // Divided by Transactions gives the mean
+} I2CQ_Stats_t;
+
+typedef struct I2CQ_Transaction I2CQ_Transaction_t;
+typedef void (*I2CQ_Callback_t)(I2CQ_Transaction_t* t);
+
+/** Queue of one I2C peripheral, see i2cq_InitBus() */
+typedef struct I2CQ_Bus {
+    I2C_HandleTypeDef* Handle;
+    I2CQ_Transaction_t* Head[I2CQ_PRIORITIES];
+    I2CQ_Transaction_t* Tail[I2CQ_PRIORITIES];
+    I2CQ_Transaction_t* volatile Active;    /**< On the bus, NULL when idle */
+    uint32_t Started;                       /**< HAL_GetTick() at the start of the active attempt */
+    uint32_t Timeout;                       /**< Its limit in milliseconds */
+    volatile uint8_t Stuck;                 /**< Set by i2cq_Tick() past the limit, cleared by i2cq_Poll() */
+    struct I2CQ_Bus* Next;
+} I2CQ_Bus_t;
+
+/** Device on a bus, see i2cq_InitDevice() */
+typedef struct {
+    I2CQ_Bus_t* Bus;
+    uint16_t Address;       /**< Shifted left by one, as HAL_I2C_* takes it */
+    const char* Name;
+    I2CQ_Stats_t Stats;
+} I2CQ_Device_t;
+
+/**
+ * Caller owned transaction, it must stay valid until it finishes. Fill it in
+ * with i2cq_SetupRead() or i2cq_SetupWrite(), change Priority, Retries,
+ * Callback and Context if needed, then i2cq_Submit() it.
+ */
+struct I2CQ_Transaction {
+    I2CQ_Device_t* Device;
+    uint8_t Read;               /**< 1: read Length bytes into Data, 0: write them */
+    uint8_t Priority;           /**< I2CQ_Priority_t */
+    uint8_t Retries;
+    uint8_t RegSize;            /**< Register address bytes sent first (1 or 2), 0 for none */
+    uint16_t Reg;
+    uint16_t Length;
+    uint8_t* Data;
+    I2CQ_Callback_t Callback;   /**< Called with interrupts disabled when finished, NULL if none */
+    void* Context;              /**< For the callback */
+
+    volatile I2CQ_Status_t Status;
+    uint8_t Attempts;
+    uint32_t Submitted;         /**< I2CQ_NOW() at i2cq_Submit() */
+    I2CQ_Transaction_t* Next;
+};
+
+/** SSD1306 on a queue: set display->Bus to one of these, see i2cq_TransportSSD1306 */
+typedef struct {
+    I2CQ_Device_t Device;
+    I2CQ_Transaction_t Data;    /**< Background writes, I2CQ_DISPLAY_CHUNK bytes each */
+    uint8_t* Rest;              /**< Data of the background write not queued yet */
+    uint16_t RestLength;
+} I2CQ_Display_t;
+
+/**
+ * @brief Display transport through the queue, background writes go out in
+ *        I2CQ_DISPLAY_CHUNK byte pieces with I2CQ_PRIORITY_LOW, so other
+ *        devices wait for one piece at most, not for a whole frame.
+ * @note display->Bus points to an I2CQ_Display_t set up with i2cq_InitDevice(),
+ *       display->Address is not used. Commands wait for the queue, so not
+ *       from interrupt context.
+ */
+extern const SSD1306_Transport_t i2cq_TransportSSD1306;
+
+/**
+ * @brief Set up the queue of an initialized I2C peripheral. Its event and
+ *        error interrupts must be enabled and the HAL_I2C_*CpltCallback and
+ *        HAL_I2C_ErrorCallback functions must call i2cq_TransferDone() and
+ *        i2cq_TransferError().
+ */
+void i2cq_InitBus(I2CQ_Bus_t* bus, I2C_HandleTypeDef* handle);
+void i2cq_InitDevice(I2CQ_Device_t* device, I2CQ_Bus_t* bus, uint16_t address, const char* name);
+void i2cq_ResetStats(I2CQ_Device_t* device);
+
+/**
+ * @brief Fill in a register read (RegSize 1) with I2CQ_PRIORITY_NORMAL,
+ *        I2CQ_RETRIES and no callback. Not while the transaction is pending.
+ */
+void i2cq_SetupRead(I2CQ_Transaction_t* t, I2CQ_Device_t* device, uint8_t reg, uint8_t* data, uint16_t length);
+void i2cq_SetupWrite(I2CQ_Transaction_t* t, I2CQ_Device_t* device, uint8_t reg, uint8_t* data, uint16_t length);
+
+/**
+ * @brief Queue a transaction, it starts at once when the bus is idle.
+ * @return I2CQ_PENDING, I2CQ_ERROR if the transaction is still pending.
+ */
+I2CQ_Status_t i2cq_Submit(I2CQ_Transaction_t* t);
+
+/**
+ * @brief Submit and wait until the transaction finishes.
+ * @note Not from interrupt context, the transaction cannot finish there.
+ */
+I2CQ_Status_t i2cq_Transfer(I2CQ_Transaction_t* t);
+
+// From the HAL callbacks
+void i2cq_TransferDone(I2C_HandleTypeDef* handle);
+void i2cq_TransferError(I2C_HandleTypeDef* handle);
+
+/**
+ * @brief Mark buses whose attempt runs longer than I2CQ_TIMEOUT_MS plus its
+ *        transfer time, call every millisecond (SysTick).
+ * @note Only sets a flag, the peripheral is reinitialized by i2cq_Poll().
+ */
+void i2cq_Tick(void);
+
+/**
+ * @brief Abort the attempts i2cq_Tick() found stuck: reinitialize the
+ *        peripheral, finish them with I2CQ_TIMEOUT and start the next one.
+ * @note Call from the main loop, i2cq_Transfer() calls it while it waits.
+ *       Not from interrupt context.
+ */
+void i2cq_Poll(void);
+
+_END_STD_C
+
+#endif /* INC_I2C_QUEUE_H_ */
@@ -120,6 +120,40 @@ extern SPI_HandleTypeDef SSD1306_SPI_PORT;
 #define SSD1306_BUFFER_SIZE   SSD1306_WIDTH * SSD1306_HEIGHT / 8
 #endif
 
+// Number of 8px RAM pages
+#define SSD1306_PAGES           (SSD1306_HEIGHT / 8)
+
+// Size of a layer in 32 bit words, see ssd1306_ComposeLayers()
+#define SSD1306_LAYER_WORDS     (SSD1306_BUFFER_SIZE / 4)
+
+// Page strips ssd1306_RenderList() draws into, one is drawn while the other one is sent
+#ifdef SSD1306_USE_DMA
+#define SSD1306_LIST_STRIPS     2
+#else
+#define SSD1306_LIST_STRIPS     1
+#endif
+
+// Bytes ssd1306_OverlayBegin() saves for a rectangle (whole pages)
+#define SSD1306_OVERLAY_SIZE(x1, y1, x2, y2) (((x2) - (x1) + 1) * ((y2) / 8 - (y1) / 8 + 1))
+
+#if (defined(SSD1306_USE_DIRTY_UPDATE) || defined(SSD1306_USE_DMA) || defined(SSD1306_USE_DISPLAY_LIST)) && (SSD1306_HEIGHT == 128)
+#error "SSD1306_USE_DIRTY_UPDATE, SSD1306_USE_DMA and SSD1306_USE_DISPLAY_LIST need the 0x21/0x22 address window commands, which 128px high displays don't support"
+#endif
+
+#if defined(SSD1306_USE_GRAYSCALE) && !(defined(SSD1306_USE_DMA) && defined(SSD1306_USE_DIRTY_UPDATE))
+#error "SSD1306_USE_GRAYSCALE needs SSD1306_USE_DMA and SSD1306_USE_DIRTY_UPDATE"
+#endif
+
+// ssd1306_GrayTick() calls per gray subframe, 7 at 1 kHz = 143 subframes/s, see Tools/gray_timing.py
+#ifndef SSD1306_GRAY_TICKS
+#define SSD1306_GRAY_TICKS      7
+#endif
+
+// A background transfer not finished after this long is given up, see ssd1306_TxErrorCallback()
+#ifndef SSD1306_DMA_TIMEOUT_MS
+#define SSD1306_DMA_TIMEOUT_MS  100
+#endif
+
 // Enumeration for screen colors
 typedef enum {
     Black = 0x00, // Black color, no pixel
@@ -131,12 +165,45 @@ typedef enum {
     SSD1306_ERR = 0x01  // Generic error.
 } SSD1306_Error_t;
 
+/*
+ * Raster operations for ssd1306_BitBlt(). The result is
+ * (D & bit0) ^ (S & bit1) ^ (D & S & bit2) for destination D and source S.
+ * Without a constant term that is 8 of the 16 two input functions, those
+ * giving 0 for D = S = 0: 0, D, S, D ^ S, D & S, D & ~S, ~D & S and D | S.
+ * Inverting ones like ~S or ~(D | S) have no code. The common ones:
+ */
+typedef enum {
+    SSD1306_ROP_COPY   = 0x02, // S
+    SSD1306_ROP_XOR    = 0x03, // D ^ S
+    SSD1306_ROP_AND    = 0x04, // D & S
+    SSD1306_ROP_ANDNOT = 0x05, // D & ~S
+    SSD1306_ROP_OR     = 0x07  // D | S
+} SSD1306_ROP;
+
+// Bit planes of the gray mode
+typedef enum {
+    SSD1306_PLANE_HIGH = 0x00, // The screenbuffer, shown 2 of 3 subframes
+    SSD1306_PLANE_LOW = 0x01   // Shown 1 of 3 subframes
+} SSD1306_PLANE;
+
+typedef enum {
+    SSD1306_SCROLL_RIGHT = 0x26, // Right Horizontal Scroll
+    SSD1306_SCROLL_LEFT = 0x27   // Left Horizontal Scroll
+} SSD1306_SCROLL_DIR;
+
 // Struct to store transformations
 typedef struct {
     uint16_t CurrentX;
     uint16_t CurrentY;
     uint8_t Initialized;
     uint8_t DisplayOn;
+    uint8_t TransparentText;
+    uint8_t Scrolling;
+    uint8_t ClipX1;
+    uint8_t ClipY1;
+    uint8_t ClipX2;
+    uint8_t ClipY2;
+    uint8_t Contrast;
 } SSD1306_t;
 
 typedef struct {
@@ -144,14 +211,203 @@ typedef struct {
     uint8_t y;
 } SSD1306_VERTEX;
 
+// Bus traffic counters, see SSD1306_USE_BUS_STATS
+typedef struct {
+    uint32_t Bytes;         // Command and data bytes sent to the controller
+    uint32_t Transactions;  // Bus transactions (one per WriteCommands/WriteData call)
+} SSD1306_BusStats_t;
+
+typedef struct SSD1306_Display SSD1306_Display_t;
+
+/** Bus of a display, see ssd1306_TransportSPI and ssd1306_TransportI2C */
+typedef struct {
+    void (*Reset)(SSD1306_Display_t* display);  /**< Before the init sequence, NULL if none */
+    void (*WriteCommands)(SSD1306_Display_t* display, const uint8_t* buffer, size_t buff_size);
+    void (*WriteData)(SSD1306_Display_t* display, uint8_t* buffer, size_t buff_size);
+    /**
+     * SSD1306_USE_DMA: start a background write, its end is reported by ssd1306_TxCpltCallback()
+     * or ssd1306_TxErrorCallback(). Anything but HAL_OK: nothing was started.
+     */
+    HAL_StatusTypeDef (*WriteDataDMA)(SSD1306_Display_t* display, uint8_t* buffer, size_t buff_size);
+    void (*EndDataDMA)(SSD1306_Display_t* display);  /**< After the last background write of a frame, NULL if none */
+    void (*AbortDMA)(SSD1306_Display_t* display);    /**< Stop a background write past SSD1306_DMA_TIMEOUT_MS, NULL if none */
+} SSD1306_Transport_t;
+
+/**
+ * Panel with its own screenbuffer, bus and update state, see ssd1306_SelectDisplay().
+ * The caller fills in the fields up to FrontBuffer, the rest belongs to the driver.
+ */
+struct SSD1306_Display {
+    const SSD1306_Transport_t* Transport;
+    void* Bus;                  /**< Bus handle of the transport (I2C_HandleTypeDef, SPI_HandleTypeDef) */
+    uint16_t Address;           /**< I2C: address shifted left by one */
+    GPIO_TypeDef* CS_Port;      /**< SPI: chip select, data/command and reset pins */
+    uint16_t CS_Pin;
+    GPIO_TypeDef* DC_Port;
+    uint16_t DC_Pin;
+    GPIO_TypeDef* Reset_Port;
+    uint16_t Reset_Pin;
+    uint8_t Height;             /**< 32, 64 or 128, at most SSD1306_HEIGHT */
+    uint8_t XOffset;            /**< First RAM column, see SSD1306_X_OFFSET */
+    uint8_t* Buffer;            /**< Screenbuffer, SSD1306_BUFFER_SIZE bytes, word aligned */
+    uint8_t* FrontBuffer;       /**< SSD1306_USE_DMA: SSD1306_BUFFER_SIZE bytes for ssd1306_UpdateScreenAsync() */
+
+    SSD1306_t State;
+    uint8_t PageOffset;         /**< RAM page shown at the top, see ssd1306_ScrollPages() */
+    uint8_t StartLinePending;
+#ifdef SSD1306_USE_DIRTY_UPDATE
+    uint8_t DirtyStart[SSD1306_PAGES];
+    uint8_t DirtyEnd[SSD1306_PAGES];
+    uint8_t InkStart[SSD1306_PAGES];
+    uint8_t InkEnd[SSD1306_PAGES];
+    uint8_t FillColor;
+#endif
+#ifdef SSD1306_USE_DMA
+    uint8_t* TxSource;          /**< Background transfer: columns TxX1..TxX2, next page TxPage, last page TxLastPage */
+    uint8_t TxX1;
+    uint8_t TxX2;
+    volatile uint8_t TxPage;
+    uint8_t TxLastPage;
+    volatile uint8_t TxBusy;
+#endif
+#ifdef SSD1306_USE_DISPLAY_LIST
+    uint8_t ListStart[SSD1306_PAGES];   /**< Columns of the last ssd1306_RenderList() per RAM page */
+    uint8_t ListEnd[SSD1306_PAGES];
+    uint8_t ListBackground;             /**< Its background, 0xFF while the panel shows something else */
+    uint8_t ListStrips[SSD1306_LIST_STRIPS][SSD1306_WIDTH];  /**< Pages on their way to this panel */
+#endif
+    SSD1306_Display_t* Next;    /**< Displays set up by ssd1306_Init() */
+};
+
+/** Animation stored as screenbuffer deltas, see Tools/gen_animation.py */
+typedef struct {
+    const uint8_t *const data;  /**< Deltas: first frame against a black screen, then frame to frame */
+    const uint16_t frames;      /**< Number of frames */
+    const uint32_t loop;        /**< Offset of the delta from the last frame back to the first */
+} SSD1306_Animation_t;
+
+/** Image drawn and erased by ssd1306_UpdateSprites() */
+typedef struct {
+    const uint8_t* mask;        /**< Page layout image, set bits are drawn in color */
+    uint8_t w;                  /**< Width in pixels */
+    uint8_t h;                  /**< Height in pixels */
+    int16_t x;                  /**< Top left corner, may be off the screen */
+    int16_t y;
+    uint8_t color;
+    uint8_t visible;
+    uint8_t dim;                /**< Gray mode: not drawn in the low plane, White shows as light gray */
+    const uint8_t* drawnMask;   /**< What the last update drew, erased when the sprite changes */
+    int16_t drawnX;
+    int16_t drawnY;
+    uint8_t drawnW;
+    uint8_t drawnH;
+    uint8_t drawn;
+    uint8_t redraw;             /**< Erased and drawn again by the running ssd1306_UpdateSprites() */
+} SSD1306_Sprite_t;
+
+/** Screenbuffer bytes saved under a popup, see ssd1306_OverlayBegin() */
+typedef struct {
+    uint8_t* save;              /**< Caller storage, SSD1306_OVERLAY_SIZE() bytes */
+    uint8_t* plane;             /**< Screenbuffer (gray mode: plane) the bytes came from */
+    uint8_t x1;                 /**< Saved columns */
+    uint8_t x2;
+    uint8_t page1;              /**< Saved pages */
+    uint8_t page2;
+    uint8_t clipX1;             /**< Clip rectangle before the overlay */
+    uint8_t clipY1;
+    uint8_t clipX2;
+    uint8_t clipY2;
+    uint8_t open;
+} SSD1306_Overlay_t;
+
+/** Playback state of an animation */
+typedef struct {
+    const SSD1306_Animation_t* anim;
+    uint32_t offset;            /**< Offset of the next delta */
+    uint32_t restart;           /**< Offset of the second frame's delta, used after the loop delta */
+    uint16_t frame;             /**< Frames shown so far */
+} SSD1306_AnimPlayer_t;
+
+/** Glyph of a packed font, see Tools/gen_font_packed.py */
+typedef struct {
+    uint32_t offset : 13;       /**< First byte of the glyph in the packed data */
+    uint32_t x : 4;             /**< Bounding box of the set pixels in the character cell */
+    uint32_t y : 5;
+    uint32_t w : 5;             /**< 0 for a blank glyph */
+    uint32_t h : 5;
+} SSD1306_PackedGlyph_t;
+
 /** Font */
 typedef struct {
 	const uint8_t width;                /**< Font width in pixels */
 	const uint8_t height;               /**< Font height in pixels */
 	const uint16_t *const data;         /**< Pointer to font data array */
     const uint8_t *const char_width;    /**< Proportional character width in pixels (NULL for monospaced) */
+    const uint8_t *const page_data;     /**< Glyphs in page layout, see Tools/gen_font_pages.py (NULL to draw from data) */
+    const SSD1306_PackedGlyph_t *const glyphs;  /**< Packed font: glyph boxes (NULL to draw from data or page_data) */
+    const uint8_t *const packed;        /**< Packed font: box columns, h bits each, bit 0 = top row */
 } SSD1306_Font_t;
 
+#ifdef SSD1306_USE_DISPLAY_LIST
+// Primitives a display list can hold
+typedef enum {
+    SSD1306_ITEM_PIXEL,
+    SSD1306_ITEM_LINE,
+    SSD1306_ITEM_CIRCLE,
+    SSD1306_ITEM_FILL_CIRCLE,
+    SSD1306_ITEM_FILL_RECTANGLE,
+    SSD1306_ITEM_TEXT,
+    SSD1306_ITEM_BITMAP
+} SSD1306_ITEM_TYPE;
+
+/** One recorded primitive */
+typedef struct {
+    uint8_t type;               /**< SSD1306_ITEM_TYPE */
+    uint8_t color;
+    uint8_t page1;              /**< Pages the primitive touches, none if page1 > page2 */
+    uint8_t page2;
+    uint8_t col1;               /**< Columns the primitive touches */
+    uint8_t col2;
+    int16_t x1;
+    int16_t y1;
+    int16_t x2;                 /**< Line or rectangle end, circle radius, bitmap width */
+    int16_t y2;                 /**< Line or rectangle end, bitmap height */
+    const void* data;           /**< Text or page layout bitmap, not copied */
+    const SSD1306_Font_t* font;
+} SSD1306_DrawItem_t;
+
+/** Primitives of one frame, drawn in order by ssd1306_RenderList() */
+typedef struct {
+    SSD1306_DrawItem_t* items;
+    uint16_t capacity;
+    uint16_t count;
+    SSD1306_COLOR background;
+} SSD1306_DrawList_t;
+#endif
+
+#ifdef HAL_SPI_MODULE_ENABLED
+extern const SSD1306_Transport_t ssd1306_TransportSPI;
+#endif
+#ifdef HAL_I2C_MODULE_ENABLED
+extern const SSD1306_Transport_t ssd1306_TransportI2C;
+#endif
+
+/**
+ * @brief Select the display all other functions work on.
+ * @param display Set up display, NULL for the one of ssd1306_conf.h (the default).
+ * @note Call ssd1306_Init() once after selecting a new display. Every display
+ *       keeps its cursor, clip rectangle and contrast. Background transfers of
+ *       displays on different buses run at the same time, on a shared bus
+ *       they wait for each other. The gray mode, fades and display lists
+ *       work on the display selected when they are used.
+ */
+void ssd1306_SelectDisplay(SSD1306_Display_t* display);
+
+/**
+ * @brief Returns the selected display.
+ */
+SSD1306_Display_t* ssd1306_GetDisplay(void);
+
 // Procedure definitions
 void ssd1306_Init(void);
 void ssd1306_Fill(SSD1306_COLOR color);
@@ -160,7 +416,7 @@ void ssd1306_DrawPixel(uint8_t x, uint8_t y, SSD1306_COLOR color);
 char ssd1306_WriteChar(char ch, SSD1306_Font_t Font, SSD1306_COLOR color);
 char ssd1306_WriteString(char* str, SSD1306_Font_t Font, SSD1306_COLOR color);
 void ssd1306_SetCursor(uint8_t x, uint8_t y);
-void ssd1306_Line(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1306_COLOR color);
+void ssd1306_Line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, SSD1306_COLOR color);
 void ssd1306_DrawArc(uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep, SSD1306_COLOR color);
 void ssd1306_DrawArcWithRadiusLine(uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep, SSD1306_COLOR color);
 void ssd1306_DrawCircle(uint8_t par_x, uint8_t par_y, uint8_t par_r, SSD1306_COLOR color);
@@ -180,8 +436,218 @@ void ssd1306_FillRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD13
  */
 SSD1306_Error_t ssd1306_InvertRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2);
 
+/**
+ * @brief Write a character enlarged a whole number of times (nearest neighbour)
+ *
+ * Every glyph column is expanded straight into page bytes and blitted, so
+ * large text can come from Font_6x8 or Font_7x10 instead of compiling in the
+ * big fonts, see Tools/font_sizes.py.
+ *
+ * @param ch Character
+ * @param Font Font to enlarge
+ * @param scale 1..8, the glyph has to fit on the display and be at most 64px high
+ * @param color Color of the set pixels
+ * @return ch, 0 if it could not be written
+ */
+char ssd1306_WriteCharScaled(char ch, SSD1306_Font_t Font, uint8_t scale, SSD1306_COLOR color);
+char ssd1306_WriteStringScaled(char* str, SSD1306_Font_t Font, uint8_t scale, SSD1306_COLOR color);
+
+/*
+ * Fill patterns are 8 bytes, one per column, bit 0 = top row, the same layout
+ * as a page of the screenbuffer. They are anchored to the screen: column x uses
+ * byte x % 8, so shaded shapes next to each other line up. Set bits are drawn
+ * in color, clear bits are left alone, e.g. a Black pattern dims what is below.
+ */
+
+/**
+ * @brief Build an ordered dither (8x8 Bayer) fill pattern
+ *
+ * @param level Gray level, number of lit pixels out of 64: 0 = none, 32 = checker, 64 = solid
+ * @param pattern Output, 8 bytes
+ */
+void ssd1306_BayerPattern(uint8_t level, uint8_t* pattern);
+
+/**
+ * @brief Fill a rectangle with a pattern, at the cost of a solid fill
+ *
+ * @param x1 X Coordinate of top left corner
+ * @param y1 Y Coordinate of top left corner
+ * @param x2 X Coordinate of bottom right corner
+ * @param y2 Y Coordinate of bottom right corner
+ * @param pattern 8 byte fill pattern, NULL for solid
+ * @param color Color of the set pattern bits
+ */
+void ssd1306_FillRectanglePattern(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, const uint8_t* pattern, SSD1306_COLOR color);
+
+/**
+ * @brief Fill a circle with a pattern, at the cost of a solid fill
+ *
+ * @param x X Coordinate of the center
+ * @param y Y Coordinate of the center
+ * @param r Radius
+ * @param pattern 8 byte fill pattern, NULL for solid
+ * @param color Color of the set pattern bits
+ */
+void ssd1306_FillCirclePattern(uint8_t x, uint8_t y, uint8_t r, const uint8_t* pattern, SSD1306_COLOR color);
+
 void ssd1306_DrawBitmap(uint8_t x, uint8_t y, const unsigned char* bitmap, uint8_t w, uint8_t h, SSD1306_COLOR color);
 
+/**
+ * @brief Draw a bitmap stored in page layout (see Tools/gen_page_bitmaps.py)
+ *
+ * Like ssd1306_DrawBitmap(): set bits are drawn in color, clear bits are left alone.
+ *
+ * @param x X Coordinate of top left corner
+ * @param y Y Coordinate of top left corner
+ * @param bitmap Bitmap data, (h + 7) / 8 pages of w bytes, bit 0 = top row
+ * @param w Bitmap width in pixels
+ * @param h Bitmap height in pixels
+ * @param color Color of the set bits
+ */
+void ssd1306_DrawBitmapPages(uint8_t x, uint8_t y, const uint8_t* bitmap, uint8_t w, uint8_t h, SSD1306_COLOR color);
+
+/**
+ * @brief Copy a bitmap stored in page layout over the screenbuffer
+ *
+ * Set bits become White and clear bits Black. With y a multiple of 8 every page
+ * is copied with memcpy, a full screen image is a single copy.
+ *
+ * @param x X Coordinate of top left corner
+ * @param y Y Coordinate of top left corner
+ * @param bitmap Bitmap data, (h + 7) / 8 pages of w bytes, bit 0 = top row
+ * @param w Bitmap width in pixels
+ * @param h Bitmap height in pixels
+ */
+void ssd1306_BlitBitmapPages(uint8_t x, uint8_t y, const uint8_t* bitmap, uint8_t w, uint8_t h);
+
+/**
+ * @brief Combine a bitmap in page layout with the screenbuffer at any position
+ *
+ * Works on 32 bit words, 4 columns at a time: each source page is shifted
+ * into the two destination pages it straddles and merged with the rows mask
+ * of the box. Honours the clip rectangle.
+ *
+ * @param x X Coordinate of top left corner, may be off screen
+ * @param y Y Coordinate of top left corner, may be off screen
+ * @param src Source data, (h + 7) / 8 pages of w bytes, bit 0 = top row. NULL for all ones
+ * @param w Width in pixels
+ * @param h Height in pixels
+ * @param rop Raster operation
+ */
+void ssd1306_BitBlt(int16_t x, int16_t y, const uint8_t* src, uint8_t w, uint8_t h, SSD1306_ROP rop);
+
+/**
+ * @brief Start playing an animation, clears the screenbuffer
+ *
+ * @param player Playback state
+ * @param anim Animation to play
+ */
+void ssd1306_AnimationStart(SSD1306_AnimPlayer_t* player, const SSD1306_Animation_t* anim);
+
+/**
+ * @brief Apply the next frame's delta to the screenbuffer
+ *
+ * Only the changed bytes are written and marked dirty. After the last frame
+ * the animation continues with the first one. Anything drawn over a frame
+ * has to be drawn again after each call.
+ *
+ * @param player Playback state
+ * @return Bit mask of the pages that changed, bit 0 = page 0
+ */
+uint16_t ssd1306_AnimationNextFrame(SSD1306_AnimPlayer_t* player);
+
+/**
+ * @brief Copy the screenbuffer into a layer
+ *
+ * In gray mode the current draw plane is copied.
+ *
+ * @param layer SSD1306_LAYER_WORDS words (1 KB for 128x64)
+ */
+void ssd1306_SaveLayer(uint32_t* layer);
+
+/**
+ * @brief Replace the screenbuffer with background AND NOT mask OR foreground
+ *
+ * Works a 32 bit word (4 columns of a page) at a time. Only the words that
+ * change are written and marked dirty, so composing the same layers again
+ * costs no bus traffic. The clip rectangle is ignored. In gray mode the
+ * current draw plane is replaced.
+ *
+ * @param background Layer saved with ssd1306_SaveLayer()
+ * @param foreground Pixels set to White, NULL for none
+ * @param mask Pixels of the background to clear, NULL for none
+ */
+void ssd1306_ComposeLayers(const uint32_t* background, const uint32_t* foreground, const uint32_t* mask);
+
+/**
+ * @brief Save the screenbuffer under a popup and clip drawing to it
+ *
+ * Draw the popup with the usual functions, ssd1306_OverlayEnd() puts the
+ * saved bytes back. Only the popup's columns of the pages it touches are
+ * copied and sent, the screen behind it is not redrawn. Overlays nest:
+ * end them in the reverse order. In gray mode the current draw plane is
+ * saved, use one overlay per plane for a popup on both.
+ *
+ * @param overlay Overlay state
+ * @param save SSD1306_OVERLAY_SIZE(x1, y1, x2, y2) bytes, kept until ssd1306_OverlayEnd()
+ * @param size Size of save
+ * @param x1 X Coordinate of top left corner
+ * @param y1 Y Coordinate of top left corner
+ * @param x2 X Coordinate of bottom right corner, limited to the screen
+ * @param y2 Y Coordinate of bottom right corner, limited to the screen
+ * @return SSD1306_ERR if the rectangle is empty or save is too small.
+ */
+SSD1306_Error_t ssd1306_OverlayBegin(SSD1306_Overlay_t* overlay, uint8_t* save, uint16_t size,
+                                     uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2);
+
+/**
+ * @brief Restore the screenbuffer under a popup and the clip rectangle before it
+ *
+ * The restored area is marked dirty, scrolling in between is not undone.
+ */
+void ssd1306_OverlayEnd(SSD1306_Overlay_t* overlay);
+
+/**
+ * @brief Set up a visible sprite at 0, 0 that is not on the screen yet
+ *
+ * @param sprite Sprite
+ * @param mask Image in page layout, (h + 7) / 8 pages of w bytes, bit 0 = top row
+ * @param w Image width in pixels
+ * @param h Image height in pixels
+ * @param color Color of the set bits
+ */
+void ssd1306_SpriteInit(SSD1306_Sprite_t* sprite, const uint8_t* mask, uint8_t w, uint8_t h, SSD1306_COLOR color);
+
+/**
+ * @brief Change the image of a sprite, takes effect at the next ssd1306_UpdateSprites()
+ */
+void ssd1306_SpriteSetImage(SSD1306_Sprite_t* sprite, const uint8_t* mask, uint8_t w, uint8_t h);
+
+/**
+ * @brief Move the top left corner of a sprite, takes effect at the next ssd1306_UpdateSprites()
+ */
+void ssd1306_SpriteMove(SSD1306_Sprite_t* sprite, int16_t x, int16_t y);
+
+/**
+ * @brief Bring the screenbuffer up to date with the sprites
+ *
+ * Sprites that moved, changed image or visibility are erased where they were
+ * drawn (only their set bits, in the background color) and drawn again, so
+ * are the sprites overlapping them. Everything else is left alone, with dirty
+ * updates only the changed columns are sent. The result is the same as
+ * ssd1306_Fill(background) followed by drawing all visible sprites in order.
+ *
+ * @param sprites Sprites, drawn in this order
+ * @param count Number of sprites
+ * @param background Color behind the sprites
+ */
+void ssd1306_UpdateSprites(SSD1306_Sprite_t* sprites, uint8_t count, SSD1306_COLOR background);
+
+/**
+ * @brief Forget what the sprites drew, call after the screenbuffer was cleared.
+ */
+void ssd1306_ForgetSprites(SSD1306_Sprite_t* sprites, uint8_t count);
+
 /**
  * @brief Sets the contrast of the display.
  * @param[in] value contrast to set.
@@ -190,12 +656,92 @@ void ssd1306_DrawBitmap(uint8_t x, uint8_t y, const unsigned char* bitmap, uint8
  */
 void ssd1306_SetContrast(const uint8_t value);
 
+/**
+ * @brief Start fading the contrast to a value, returns at once.
+ *
+ * The ramp is linear in sqrt(contrast) and costs one contrast command (2 bytes)
+ * per changed value instead of redrawn frames. Drive it with ssd1306_FadeUpdate().
+ * If the display is off, it is turned on at the darkest setting first, so
+ * a screen drawn while off fades in from black.
+ *
+ * @param[in] contrast Contrast at the end
+ * @param[in] duration Length in ms
+ * @param[in] off Turn the display off at the end (fade out)
+ */
+void ssd1306_FadeTo(uint8_t contrast, uint32_t duration, uint8_t off);
+
+/**
+ * @brief Send the contrast step due now, call often, e.g. from the main loop.
+ * @return  0: no fade running.
+ *          1: fade in progress.
+ */
+uint8_t ssd1306_FadeUpdate(void);
+
 /**
  * @brief Set Display ON/OFF.
  * @param[in] on 0 for OFF, any for ON.
  */
 void ssd1306_SetDisplayOn(const uint8_t on);
 
+/**
+ * @brief Set transparent text mode.
+ * @param[in] on 0 to draw the glyph background in the inverse color, any to leave it untouched.
+ * @note Transparent text can be drawn on top of bitmaps.
+ */
+void ssd1306_SetTransparentText(const uint8_t on);
+
+/**
+ * @brief Restrict drawing to a rectangle (include border).
+ *
+ * Pixels, lines, shapes, text and bitmaps outside of it are not drawn.
+ * ssd1306_Fill(), ssd1306_FillBuffer() and animations still cover the whole screen.
+ *
+ * @param[in] x1 X Coordinate of top left corner
+ * @param[in] y1 Y Coordinate of top left corner
+ * @param[in] x2 X Coordinate of bottom right corner, limited to the screen
+ * @param[in] y2 Y Coordinate of bottom right corner, limited to the screen
+ */
+void ssd1306_SetClipRect(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2);
+
+/**
+ * @brief Draw on the whole screen again.
+ */
+void ssd1306_ResetClipRect(void);
+
+/**
+ * @brief Move the picture up (pages > 0) or down (pages < 0) by whole pages.
+ *
+ * The controller's display start line does the move, only the exposed pages
+ * have to be sent. They are cleared to Black in the screenbuffer, draw into
+ * them before the next screen update, which also sends the new start line.
+ *
+ * @param[in] pages Number of pages (8 rows) to move, -7..7 except 0.
+ * @return SSD1306_ERR if the move is out of range, the screen is not 64 rows
+ *         high or hardware scrolling is active.
+ */
+SSD1306_Error_t ssd1306_ScrollPages(int8_t pages);
+
+/**
+ * @brief Start continuous horizontal scrolling of pages page1..page2.
+ *
+ * The controller scrolls its RAM on its own. Screen updates are held back
+ * until ssd1306_StopScroll(), the RAM must not be written while scrolling.
+ *
+ * @param[in] dir SSD1306_SCROLL_RIGHT or SSD1306_SCROLL_LEFT.
+ * @param[in] page1 First page.
+ * @param[in] page2 Last page.
+ * @param[in] interval Time between scroll steps in frames, 0: 5, 1: 64, 2: 128,
+ *            3: 256, 4: 3, 5: 4, 6: 25, 7: 2.
+ * @return SSD1306_ERR if the range is invalid or wraps around the RAM after
+ *         ssd1306_ScrollPages().
+ */
+SSD1306_Error_t ssd1306_StartScroll(SSD1306_SCROLL_DIR dir, uint8_t page1, uint8_t page2, uint8_t interval);
+
+/**
+ * @brief Stop hardware scrolling, the next screen update redraws the whole screen.
+ */
+void ssd1306_StopScroll(void);
+
 /**
  * @brief Reads DisplayOn state.
  * @return  0: OFF.
@@ -203,11 +749,168 @@ void ssd1306_SetDisplayOn(const uint8_t on);
  */
 uint8_t ssd1306_GetDisplayOn();
 
-// Low-level procedures
+#ifdef SSD1306_USE_DMA
+/**
+ * @brief Starts sending the screenbuffer to the screen using DMA and returns.
+ * @note Drawing the next frame may start right away, the sent frame is kept in a second buffer.
+ * @note Waits for the previous transfer if it is still running.
+ */
+void ssd1306_UpdateScreenAsync(void);
+
+/**
+ * @brief Transfer complete handler, continues the transfer of the display on this bus.
+ * @param bus Bus handle of the HAL callback.
+ * @note Call from HAL_SPI_TxCpltCallback and HAL_I2C_MemTxCpltCallback.
+ */
+void ssd1306_TxCpltCallback(const void* bus);
+
+/**
+ * @brief Transfer error handler, gives up the transfer of the display on this bus.
+ * @param bus Bus handle of the HAL callback.
+ * @note Call from HAL_SPI_ErrorCallback and HAL_I2C_ErrorCallback. The whole
+ *       screen is marked for the next update, the panel RAM is unknown.
+ */
+void ssd1306_TxErrorCallback(const void* bus);
+
+/**
+ * @brief Reads the background transfer state of the selected display.
+ * @return  0: idle.
+ *          1: ssd1306_UpdateScreenAsync() transfer in progress.
+ */
+uint8_t ssd1306_IsTransferBusy(void);
+
+/**
+ * @brief Blocks until the background transfer of the selected display has finished.
+ * @note After SSD1306_DMA_TIMEOUT_MS the transfer is given up like a failed one.
+ */
+void ssd1306_WaitForTransfer(void);
+#endif
+
+#ifdef SSD1306_USE_GRAYSCALE
+/*
+ * Gray mode: two bit planes shown as alternating subframes, a pixel is lit
+ * (2 * high + low) / 3 of the time: 0 black, 1 dark gray, 2 light gray, 3 white.
+ * ssd1306_GrayTick() has to be called from a periodic interrupt, it times the
+ * subframes, and ssd1306_GrayPoll() from the main loop, it starts the DMA
+ * transfers. Between subframes only the window where the planes differ is
+ * sent, so a small gray area costs little bus time.
+ */
+
+/**
+ * @brief Enter gray mode, the current screenbuffer is copied to both planes (white).
+ * @note ssd1306_UpdateScreen() and ssd1306_UpdateScreenAsync() call ssd1306_GrayPresent()
+ *       until ssd1306_GrayEnd(). ssd1306_RenderList() can't be used in gray mode.
+ */
+void ssd1306_GrayBegin(void);
+
+/**
+ * @brief Back to one bit, the next screen update sends the high plane (the screenbuffer).
+ */
+void ssd1306_GrayEnd(void);
+
+/**
+ * @brief Select the plane the drawing functions and ssd1306_Fill() write.
+ * @note Sprites are drawn into both planes, see SSD1306_Sprite_t.dim.
+ */
+void ssd1306_SetDrawPlane(SSD1306_PLANE plane);
+
+/**
+ * @brief Hand the changes of both planes to the subframe transfers.
+ */
+void ssd1306_GrayPresent(void);
+
+/**
+ * @brief Subframe timer, call from a periodic interrupt, e.g. SysTick. Touches no bus.
+ */
+void ssd1306_GrayTick(void);
+
+/**
+ * @brief Start the subframe ssd1306_GrayTick() has queued, call from the main loop.
+ * @note Call at least every tick, a subframe lasts until the next call after it is over.
+ *       ssd1306_UpdateScreen() and ssd1306_UpdateScreenAsync() call it too.
+ */
+void ssd1306_GrayPoll(void);
+#endif
+
+#ifdef SSD1306_USE_DISPLAY_LIST
+/**
+ * @brief Start recording a frame into items, drops what the list held.
+ *
+ * @param list Display list
+ * @param items Storage for the recorded primitives
+ * @param capacity Number of items
+ * @param background Color of everything not drawn
+ */
+void ssd1306_ListBegin(SSD1306_DrawList_t* list, SSD1306_DrawItem_t* items, uint16_t capacity, SSD1306_COLOR background);
+
+/**
+ * @brief Record a primitive, the arguments are the ones of the immediate mode function.
+ * @return SSD1306_ERR if the list is full.
+ */
+SSD1306_Error_t ssd1306_ListPixel(SSD1306_DrawList_t* list, uint8_t x, uint8_t y, SSD1306_COLOR color);
+SSD1306_Error_t ssd1306_ListLine(SSD1306_DrawList_t* list, int16_t x1, int16_t y1, int16_t x2, int16_t y2, SSD1306_COLOR color);
+SSD1306_Error_t ssd1306_ListCircle(SSD1306_DrawList_t* list, uint8_t x, uint8_t y, uint8_t r, SSD1306_COLOR color);
+SSD1306_Error_t ssd1306_ListFillCircle(SSD1306_DrawList_t* list, uint8_t x, uint8_t y, uint8_t r, SSD1306_COLOR color);
+SSD1306_Error_t ssd1306_ListFillRectangle(SSD1306_DrawList_t* list, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1306_COLOR color);
+/** @note str is not copied and has to stay valid until ssd1306_RenderList() */
+SSD1306_Error_t ssd1306_ListText(SSD1306_DrawList_t* list, uint8_t x, uint8_t y, const char* str, const SSD1306_Font_t* font, SSD1306_COLOR color);
+/** @note Draws like ssd1306_DrawBitmapPages() */
+SSD1306_Error_t ssd1306_ListBitmapPages(SSD1306_DrawList_t* list, uint8_t x, uint8_t y, const uint8_t* bitmap, uint8_t w, uint8_t h, SSD1306_COLOR color);
+
+/**
+ * @brief Draw the list and send it to the screen one page at a time.
+ *
+ * Every page is rasterized into a 128 byte strip, the screenbuffer is not
+ * touched. Only the columns and pages the primitives of this and of the
+ * previous list cover are sent, the first list after an update or on a new
+ * background sends the whole screen. With SSD1306_USE_DMA the next page is
+ * drawn while the previous one is being sent. The result is the same as
+ * drawing the primitives in order after ssd1306_Fill(background).
+ *
+ * @note The next ssd1306_UpdateScreen() sends the screenbuffer where the list was sent.
+ */
+void ssd1306_RenderList(const SSD1306_DrawList_t* list);
+#endif
+
+#ifdef SSD1306_USE_BUS_TRACE
+/**
+ * @brief Application hook, called with every bus transaction before it is sent.
+ * @param display Display the transaction goes to.
+ * @param kind 'C' command bytes, 'D' data bytes, 'B' background (DMA) data
+ *             bytes, 'E' end of the background writes of a frame, 'F' start
+ *             of a screen update, 'R' hardware reset. buffer is NULL for the last three.
+ * @note Called from the DMA interrupt for background writes after the first.
+ *       Writing one line per call, the kind and the bytes in hex ("C 21 00 7F"),
+ *       gives a trace Tools/ssd1306_emu.py replays into the display RAM and
+ *       the bus cost of every frame.
+ * @note The default writes these lines to ITM port 0 (SWO), or to the UART of
+ *       SSD1306_TRACE_UART. It blocks, so background writes no longer overlap drawing.
+ */
+void ssd1306_BusTrace(const SSD1306_Display_t* display, char kind, const uint8_t* buffer, size_t buff_size);
+#endif
+
+#ifdef SSD1306_USE_BUS_STATS
+/**
+ * @brief Returns the bus traffic of all displays counted since the last ssd1306_ResetBusStats().
+ */
+SSD1306_BusStats_t ssd1306_GetBusStats(void);
+
+/**
+ * @brief Clears the bus traffic counters.
+ */
+void ssd1306_ResetBusStats(void);
+#endif
+
+// Low-level procedures, on the selected display
 void ssd1306_Reset(void);
 void ssd1306_WriteCommand(uint8_t byte);
+/**
+ * @brief Sends several command bytes in one bus transaction (one I2C write
+ *        with control byte 0x00, one SPI transfer with DC low).
+ */
+void ssd1306_WriteCommands(const uint8_t* buffer, size_t buff_size);
 void ssd1306_WriteData(uint8_t* buffer, size_t buff_size);
-SSD1306_Error_t ssd1306_FillBuffer(uint8_t* buf, uint32_t len);
+SSD1306_Error_t ssd1306_FillBuffer(const uint8_t* buf, uint32_t len);
 
 _END_STD_C
 
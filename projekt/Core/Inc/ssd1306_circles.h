@@ -0,0 +1,20 @@
+#ifndef __SSD1306_CIRCLES_H__
+#define __SSD1306_CIRCLES_H__
+
+#include <stdint.h>
+
+// Radii covered by the circle tables, see Tools/gen_circles.py
+#define SSD1306_CIRCLE_R_MIN    3
+#define SSD1306_CIRCLE_R_MAX    24
+
+/*
+ * Masks of the (2r+1) x (2r+1) box around a circle of radius r, stored
+ * page by page with one byte per column. Bit 0 of the first page is the
+ * top row of the box. The mask of radius r starts at
+ * SSD1306_CircleOffsets[r - SSD1306_CIRCLE_R_MIN].
+ */
+extern const uint8_t SSD1306_FilledCircles[];
+extern const uint8_t SSD1306_OutlineCircles[];
+extern const uint16_t SSD1306_CircleOffsets[];
+
+#endif // __SSD1306_CIRCLES_H__
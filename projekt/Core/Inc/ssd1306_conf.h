@@ -22,7 +22,11 @@
 //#define SSD1306_USE_I2C
 #define SSD1306_USE_SPI
 
-// I2C Configuration
+// Drive CS/DC through BSRR and send through the SPI data register instead of
+// HAL_GPIO_WritePin()/HAL_SPI_Transmit(), DMA transfers still go through the HAL
+// #define SSD1306_USE_SPI_LL
+
+// I2C Configuration, main.c runs the display through the hi2c1 queue of i2c_queue.h
 //#define SSD1306_I2C_PORT        hi2c1
 //#define SSD1306_I2C_ADDR        (0x3C << 1)
 
@@ -35,6 +39,30 @@
 #define SSD1306_Reset_Port      GPIOA
 #define SSD1306_Reset_Pin       GPIO_PIN_9
 
+// Static RAM of the driver: the screenbuffer (WIDTH * HEIGHT / 8 = 1 KB) plus
+// what the options below add. Layers for ssd1306_ComposeLayers() are 1 KB each
+// and belong to the caller.
+
+// Send only the changed parts of the screenbuffer in ssd1306_UpdateScreen() (+4 bytes per page)
+#define SSD1306_USE_DIRTY_UPDATE
+
+// Enable ssd1306_UpdateScreenAsync(), needs a DMA channel linked to the bus handle (+1 KB front buffer)
+#define SSD1306_USE_DMA
+
+// Enable ssd1306_RenderList(), drawing from a display list one page at a time (+1 strip of WIDTH bytes per display, 2 with DMA)
+// #define SSD1306_USE_DISPLAY_LIST
+
+// Enable the 2 bit gray mode, needs DIRTY_UPDATE, DMA, ssd1306_GrayTick() in SysTick and ssd1306_GrayPoll() in the main loop (+2 KB, low plane and its front buffer)
+// #define SSD1306_USE_GRAYSCALE
+
+// Count bytes and transactions sent to the display
+// #define SSD1306_USE_BUS_STATS
+
+// Pass every transaction to ssd1306_BusTrace(), for Tools/ssd1306_emu.py. The
+// default one writes the lines to ITM port 0 (SWO), or blocking to this UART
+// #define SSD1306_USE_BUS_TRACE
+// #define SSD1306_TRACE_UART      huart2
+
 // Mirror the screen if needed
 // #define SSD1306_MIRROR_VERT
 // #define SSD1306_MIRROR_HORIZ
@@ -42,15 +70,20 @@
 // Set inverse color if needed
 // # define SSD1306_INVERSE_COLOR
 
-// Include only needed fonts
+// Store the fonts bounding box packed (Core/Src/ssd1306_fonts_packed.c) instead of
+// rows and pages, a third of the flash or less, see Tools/font_sizes.py
+#define SSD1306_USE_PACKED_FONTS
+
+// Include only needed fonts, large text can be Font_6x8/Font_7x10 through
+// ssd1306_WriteStringScaled(), see Tools/font_sizes.py for the flash each costs
 #define SSD1306_INCLUDE_FONT_6x8
 #define SSD1306_INCLUDE_FONT_7x10
-#define SSD1306_INCLUDE_FONT_11x18
-#define SSD1306_INCLUDE_FONT_16x26
+// #define SSD1306_INCLUDE_FONT_11x18
+// #define SSD1306_INCLUDE_FONT_16x26
 
-#define SSD1306_INCLUDE_FONT_16x24
+// #define SSD1306_INCLUDE_FONT_16x24
 
-#define SSD1306_INCLUDE_FONT_16x15
+// #define SSD1306_INCLUDE_FONT_16x15
 
 // The width of the screen can be set using this
 // define. The default value is 128.
@@ -0,0 +1,16 @@
+#ifndef __SSD1306_SINE_H__
+#define __SSD1306_SINE_H__
+
+#include <stdint.h>
+
+// Angle units per degree and the fixed-point one of the sine table, see Tools/gen_sine.py
+#define SSD1306_ANGLE_STEPS     256
+#define SSD1306_SINE_ONE        32768
+
+/*
+ * sin(d degrees) * SSD1306_SINE_ONE for d = 0..90, the other quadrants
+ * are mirrored from it.
+ */
+extern const uint16_t SSD1306_Sine[];
+
+#endif // __SSD1306_SINE_H__
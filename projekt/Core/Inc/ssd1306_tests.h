@@ -13,11 +13,21 @@ void ssd1306_TestAll(void);
 void ssd1306_TestLine(void);
 void ssd1306_TestRectangle(void);
 void ssd1306_TestRectangleFill(void);
+void ssd1306_TestPatternFill(void);
 void ssd1306_TestRectangleInvert(void);
 void ssd1306_TestCircle(void);
 void ssd1306_TestArc(void);
 void ssd1306_TestPolyline(void);
 void ssd1306_TestDrawBitmap(void);
+void ssd1306_TestBusTraffic(void);
+void ssd1306_TestRasterBenchmark(void);
+void ssd1306_TestBitmapBenchmark(void);
+void ssd1306_TestArcBenchmark(void);
+void ssd1306_TestBlitBenchmark(void);
+void ssd1306_TestFontBenchmark(void);
+void ssd1306_TestTransportBenchmark(void);
+void ssd1306_TestFade(void);
+void ssd1306_TestOverlay(void);
 
 _END_STD_C
 
@@ -16,12 +16,12 @@ _BEGIN_STD_C
 
 
 #include "stm32l4xx_hal.h"
+#include "i2c_queue.h"
 
 
 #define I2C_ERROR_OK 0
 
 
-#define i2CTimeout 1000 // Timeout for I2C receive
 #define SXAddress (0x3E << 1)
 #define INAAddress (0x40 << 1)
 
@@ -29,9 +29,14 @@ _BEGIN_STD_C
 
 
 
+// All transfers go through the I2C queue, sx1509Init() first
+void sx1509Init(I2CQ_Bus_t* bus);
+I2CQ_Device_t* sx1509Device(void); // For its statistics
 void reset(uint8_t hardware);
 uint8_t readByte(uint8_t reg);
 uint16_t readWord(uint8_t reg);
+// Queue a read of len registers from reg with I2CQ_PRIORITY_HIGH, callback gets buf filled
+void readBytesAsync(I2CQ_Transaction_t* t, uint8_t reg, uint8_t* buf, uint16_t len, I2CQ_Callback_t callback);
 
 _END_STD_C
 
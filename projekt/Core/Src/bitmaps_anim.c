@@ -0,0 +1,108 @@
+/*
+ * Generated by Tools/gen_animation.py, do not edit.
+ * fajerwerki1..11 of bitmaps.c as page layout deltas.
+ */
+
+#include "bitmaps.h"
+
+static const uint8_t fajerwerki_deltas[] = {
+// fajerwerki1
+0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x69, 0x82, 0x08, 0x58, 0x08, 0x2D, 0x82, 0x01, 0x0B, 0x01,
+0x00,
+// fajerwerki2
+0x7F, 0x7F, 0x7F, 0x66, 0x82, 0x40, 0xC0, 0x40, 0x7E, 0x80, 0xFF, 0x7F, 0x80, 0x5D, 0x7E, 0x82,
+0x00, 0x00, 0x00, 0x7F, 0x00,
+// fajerwerki3
+0x7F, 0x7F, 0x65, 0x82, 0x04, 0x7E, 0x04, 0x7D, 0x82, 0x00, 0x12, 0x00, 0x2D, 0x82, 0x08, 0xF8,
+0x08, 0x4E, 0x80, 0x00, 0x2F, 0x80, 0xBF, 0x4F, 0x80, 0x00, 0x2F, 0x80, 0x0B, 0x7E, 0x82, 0x00,
+0x00, 0x00, 0x00,
+// fajerwerki4
+0x7F, 0x65, 0x80, 0x40, 0x2E, 0x82, 0x40, 0xE0, 0x40, 0x48, 0x8C, 0x10, 0x00, 0x10, 0x92, 0x44,
+0x38, 0xFB, 0x38, 0x44, 0x92, 0x10, 0x00, 0x10, 0x29, 0x80, 0x27, 0x4F, 0x80, 0x0A, 0x2E, 0x82,
+0x00, 0x01, 0x00, 0x7E, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x00,
+// fajerwerki5
+0x64, 0x80, 0x80, 0x77, 0x90, 0x10, 0x20, 0x40, 0x80, 0x10, 0x60, 0x80, 0x00, 0xEA, 0x00, 0x80,
+0x60, 0x10, 0x80, 0x40, 0x20, 0x10, 0x24, 0x86, 0x20, 0x40, 0x80, 0xB4, 0x80, 0x40, 0x20, 0x3F,
+0x9A, 0x10, 0x00, 0x10, 0x00, 0x10, 0x01, 0x92, 0x92, 0x54, 0x11, 0xBA, 0x7C, 0xFE, 0xFF, 0xFE,
+0x7C, 0xBA, 0x11, 0x54, 0x92, 0x92, 0x01, 0x10, 0x00, 0x10, 0x00, 0x10, 0x1C, 0x8C, 0x01, 0x00,
+0x01, 0x09, 0x04, 0x03, 0xAF, 0x03, 0x04, 0x09, 0x01, 0x00, 0x01, 0x41, 0x90, 0x11, 0x08, 0x04,
+0x02, 0x11, 0x0C, 0x02, 0x00, 0xAF, 0x00, 0x02, 0x0C, 0x11, 0x02, 0x04, 0x08, 0x11, 0x27, 0x80,
+0x00, 0x4F, 0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x00,
+// fajerwerki6
+0x64, 0x80, 0xB4, 0x2F, 0x80, 0xA8, 0x44, 0x82, 0x82, 0x84, 0x08, 0x03, 0x81, 0x86, 0x18, 0x03,
+0x80, 0xFF, 0x03, 0x81, 0x18, 0x86, 0x03, 0x83, 0x08, 0x84, 0x82, 0x01, 0x1B, 0x90, 0x11, 0x22,
+0x24, 0x48, 0x11, 0xA6, 0xC8, 0xE0, 0xFE, 0xE0, 0xC8, 0xA6, 0x11, 0x48, 0x24, 0x22, 0x11, 0x32,
+0x84, 0x10, 0x10, 0x00, 0x10, 0x10, 0x04, 0x84, 0x10, 0x10, 0x10, 0x11, 0x11, 0x03, 0x80, 0x1D,
+0x0B, 0x84, 0x11, 0x11, 0x10, 0x10, 0x10, 0x03, 0x84, 0x10, 0x10, 0x00, 0x10, 0x10, 0x0E, 0x9A,
+0x01, 0x00, 0x01, 0x00, 0x01, 0x10, 0x89, 0x49, 0x25, 0x11, 0xCB, 0x27, 0x0F, 0xFF, 0x0F, 0x27,
+0xCB, 0x11, 0x25, 0x49, 0x89, 0x10, 0x01, 0x00, 0x01, 0x00, 0x01, 0x37, 0x82, 0x82, 0x42, 0x21,
+0x03, 0x81, 0xC2, 0x31, 0x03, 0x80, 0xFF, 0x03, 0x81, 0x31, 0xC2, 0x03, 0x82, 0x21, 0x42, 0x82,
+0x1C, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0x2A, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x47,
+0x80, 0x36, 0x7F, 0x7F, 0x7F, 0x00,
+// fajerwerki7
+0x14, 0x80, 0x40, 0x47, 0x82, 0x18, 0x60, 0x80, 0x05, 0x80, 0x80, 0x05, 0x82, 0x80, 0x60, 0x18,
+0x1B, 0x83, 0x10, 0x20, 0x40, 0x80, 0x03, 0x81, 0x60, 0x80, 0x03, 0x80, 0xFB, 0x03, 0x81, 0x80,
+0x60, 0x03, 0x82, 0x80, 0x40, 0x20, 0x33, 0x86, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x02,
+0x83, 0x00, 0x20, 0x41, 0x06, 0x04, 0x80, 0x0D, 0x04, 0x82, 0x06, 0x41, 0x00, 0x02, 0x87, 0x80,
+0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0x13, 0x82, 0x08, 0x08, 0x10, 0x08, 0x80, 0xFF, 0x03,
+0x80, 0xD1, 0x04, 0x82, 0x10, 0x08, 0x08, 0x2F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x91,
+0x00, 0x01, 0x11, 0x82, 0x82, 0x44, 0x44, 0x00, 0x11, 0x38, 0x7C, 0x38, 0x11, 0x00, 0x44, 0x44,
+0x82, 0x82, 0x02, 0x81, 0x00, 0x00, 0x02, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+0x84, 0x01, 0x01, 0x00, 0x01, 0x01, 0x03, 0x84, 0x01, 0x21, 0x21, 0x11, 0x11, 0x0F, 0x84, 0x11,
+0x11, 0x21, 0x21, 0x01, 0x04, 0x84, 0x01, 0x01, 0x00, 0x01, 0x01, 0x29, 0x89, 0x10, 0x10, 0x08,
+0x08, 0x04, 0x04, 0x02, 0x02, 0x01, 0x01, 0x02, 0x89, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC8, 0x00,
+0x03, 0x0C, 0x30, 0x02, 0x81, 0x00, 0x01, 0x02, 0x86, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10,
+0x13, 0x82, 0x08, 0x04, 0x02, 0x03, 0x81, 0x0C, 0x03, 0x03, 0x80, 0x6F, 0x03, 0x81, 0x03, 0x0C,
+0x03, 0x82, 0x02, 0x04, 0x08, 0x3C, 0x82, 0x30, 0x0C, 0x03, 0x05, 0x80, 0x01, 0x05, 0x82, 0x03,
+0x0C, 0x30, 0x27, 0x80, 0x03, 0x7F, 0x7F, 0x00,
+// fajerwerki8
+0x0C, 0x80, 0x80, 0x07, 0x80, 0x00, 0x07, 0x80, 0x80, 0x6B, 0x81, 0x00, 0x00, 0x02, 0x82, 0x01,
+0x06, 0x18, 0x05, 0x80, 0xD8, 0x05, 0x85, 0x18, 0x06, 0x01, 0x80, 0x00, 0x00, 0x3E, 0x8C, 0x01,
+0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x18, 0x85, 0x01, 0x01,
+0x02, 0x02, 0x04, 0x04, 0x03, 0x80, 0x10, 0x02, 0x8C, 0x40, 0x41, 0x06, 0x18, 0x80, 0xC0, 0x80,
+0x18, 0x06, 0x41, 0x40, 0x24, 0x20, 0x04, 0x85, 0x04, 0x04, 0x02, 0x02, 0x01, 0x01, 0x36, 0x91,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x44, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x10, 0x12, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x41, 0x41, 0x21, 0x20, 0x10,
+0x11, 0x88, 0x48, 0x04, 0x04, 0xC0, 0x31, 0x03, 0x87, 0x03, 0x31, 0xC0, 0x04, 0x24, 0x48, 0x08,
+0x02, 0x8B, 0x20, 0x20, 0x41, 0x41, 0x81, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x80,
+0x00, 0x03, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+0x20, 0x40, 0x14, 0x81, 0x01, 0x01, 0x04, 0x85, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x30, 0x05, 0x80,
+0x1C, 0x05, 0x82, 0x30, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x04, 0x81, 0x01, 0x01, 0x66, 0x80, 0x03,
+0x07, 0x80, 0x00, 0x07, 0x80, 0x03, 0x7F, 0x7F, 0x00,
+// fajerwerki9
+0x5C, 0x82, 0x08, 0x00, 0x00, 0x0B, 0x82, 0x00, 0x00, 0x10, 0x22, 0x81, 0x20, 0x00, 0x03, 0x80,
+0x58, 0x03, 0x80, 0x00, 0x3A, 0x8C, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x04, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x17, 0x91, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3A, 0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88,
+0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x04, 0x80, 0x00, 0x03, 0x81, 0x00, 0x00,
+0x19, 0x92, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x34, 0x8C, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x01, 0x04, 0x80, 0x00, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x03, 0x80, 0x18, 0x03, 0x80, 0x00, 0x43, 0x82, 0x00,
+0x00, 0x02, 0x05, 0x80, 0x00, 0x05, 0x82, 0x02, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x00,
+// fajerwerki10
+0x1C, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x84, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0x80, 0x08, 0x04, 0x82, 0x00, 0x00, 0x00, 0x38, 0x80, 0x00, 0x0F, 0x80,
+0x08, 0x10, 0x80, 0x00, 0x0D, 0x8A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x06, 0x80, 0x10, 0x07, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32,
+0x80, 0x00, 0x03, 0x80, 0x10, 0x04, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x04, 0x80,
+0x10, 0x02, 0x80, 0x00, 0x14, 0x93, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x04, 0x85, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x41, 0x80, 0x20, 0x0E, 0x80, 0x00, 0x0F, 0x81, 0x00, 0x00, 0x08, 0x82, 0x00, 0x20,
+0x00, 0x04, 0x80, 0x00, 0x04, 0x82, 0x00, 0x20, 0x00, 0x02, 0x80, 0x00, 0x05, 0x81, 0x00, 0x00,
+0x38, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x21, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0x7F, 0x00,
+// fajerwerki11
+0x0C, 0x80, 0x00, 0x7D, 0x81, 0x00, 0x80, 0x08, 0x80, 0x80, 0x07, 0x82, 0x00, 0x00, 0x40, 0x3B,
+0x80, 0x00, 0x09, 0x80, 0x00, 0x08, 0x80, 0x00, 0x16, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x10, 0x80,
+0x00, 0x35, 0x80, 0x00, 0x11, 0x80, 0x00, 0x18, 0x81, 0x00, 0x00, 0x03, 0x80, 0x01, 0x04, 0x80,
+0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x04, 0x80, 0x01, 0x02, 0x83, 0x00, 0x00, 0x80, 0x00,
+0x32, 0x80, 0x00, 0x0D, 0x80, 0x00, 0x08, 0x80, 0x00, 0x1D, 0x80, 0x02, 0x02, 0x80, 0x00, 0x05,
+0x80, 0x02, 0x05, 0x80, 0x00, 0x02, 0x80, 0x00, 0x7F, 0x7F, 0x7F, 0x00,
+// loop
+0x7F, 0x0C, 0x80, 0x00, 0x08, 0x80, 0x00, 0x09, 0x80, 0x00, 0x7F, 0x6D, 0x80, 0x00, 0x11, 0x80,
+0x00, 0x04, 0x80, 0x00, 0x68, 0x80, 0x00, 0x08, 0x80, 0x00, 0x7F, 0x7F, 0x50, 0x82, 0x08, 0x58,
+0x08, 0x2D, 0x82, 0x01, 0x0B, 0x01, 0x00,
+};
+
+const SSD1306_Animation_t fajerwerki_anim = {fajerwerki_deltas, 11, 1228};
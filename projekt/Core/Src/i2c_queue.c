@@ -0,0 +1,327 @@
+/*
+ * i2c_queue.c
+ *
+ * One transaction is on the bus at a time, started with the HAL interrupt
+ * functions. Its completion or error interrupt finishes it and starts the
+ * highest priority queued one, so nothing waits for the bus in a blocking
+ * HAL call. A failed attempt goes back to the end of its priority until
+ * its retries are used up.
+ */
+
+#include "i2c_queue.h"
+
+#ifndef I2CQ_NOW
+// Latency clock: the cycle counter, started by i2cq_InitBus()
+#define I2CQ_NOW() (DWT->CYCCNT)
+#define I2CQ_TICKS_PER_US (SystemCoreClock / 1000000U)
+#define I2CQ_START_CLOCK() do { CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk; } while (0)
+#endif
+
+#ifndef I2CQ_LOCK
+// The queues are changed in thread mode and in the I2C interrupts
+#define I2CQ_LOCK()   uint32_t i2cq_primask = __get_PRIMASK(); __disable_irq()
+#define I2CQ_UNLOCK() __set_PRIMASK(i2cq_primask)
+#endif
+
+static I2CQ_Bus_t* I2CQ_Buses;
+
+static I2CQ_Bus_t* i2cq_FindBus(const I2C_HandleTypeDef* handle) {
+    I2CQ_Bus_t* bus = I2CQ_Buses;
+    while (bus != NULL && bus->Handle != handle) {
+        bus = bus->Next;
+    }
+    return bus;
+}
+
+static void i2cq_Append(I2CQ_Bus_t* bus, I2CQ_Transaction_t* t) {
+    t->Next = NULL;
+    if (bus->Tail[t->Priority] == NULL) {
+        bus->Head[t->Priority] = t;
+    } else {
+        bus->Tail[t->Priority]->Next = t;
+    }
+    bus->Tail[t->Priority] = t;
+}
+
+static I2CQ_Transaction_t* i2cq_Pop(I2CQ_Bus_t* bus) {
+    for (uint8_t p = 0; p < I2CQ_PRIORITIES; p++) {
+        I2CQ_Transaction_t* t = bus->Head[p];
+        if (t != NULL) {
+            bus->Head[p] = t->Next;
+            if (bus->Head[p] == NULL) {
+                bus->Tail[p] = NULL;
+            }
+            return t;
+        }
+    }
+    return NULL;
+}
+
+static void i2cq_Finish(I2CQ_Transaction_t* t, I2CQ_Status_t status) {
+    I2CQ_Stats_t* stats = &t->Device->Stats;
+    uint32_t latency = (I2CQ_NOW() - t->Submitted) / I2CQ_TICKS_PER_US;
+
+    stats->Transactions++;
+    stats->LatencySum += latency;
+    if (latency > stats->LatencyMax) {
+        stats->LatencyMax = latency;
+    }
+    if (status == I2CQ_OK) {
+        stats->Bytes += t->Length;
+    } else if (status == I2CQ_TIMEOUT) {
+        stats->Timeouts++;
+    } else {
+        stats->Errors++;
+    }
+
+    t->Status = status;
+    if (t->Callback != NULL) {
+        t->Callback(t);
+    }
+}
+
+// Queue the transaction again or finish it
+static void i2cq_Failed(I2CQ_Bus_t* bus, I2CQ_Transaction_t* t, uint8_t nack) {
+    if (nack) {
+        t->Device->Stats.Nacks++;
+    }
+    if (t->Attempts <= t->Retries) {
+        t->Device->Stats.Retries++;
+        i2cq_Append(bus, t);
+    } else {
+        i2cq_Finish(t, nack ? I2CQ_NACK : I2CQ_ERROR);
+    }
+}
+
+// Start queued transactions until one is on the bus or the queue is empty
+static void i2cq_StartNext(I2CQ_Bus_t* bus) {
+    while (bus->Active == NULL) {
+        I2CQ_Transaction_t* t = i2cq_Pop(bus);
+        if (t == NULL) {
+            return;
+        }
+
+        HAL_StatusTypeDef ret;
+        uint16_t address = t->Device->Address;
+        t->Attempts++;
+        bus->Active = t;
+        bus->Started = HAL_GetTick();
+        bus->Timeout = I2CQ_TIMEOUT_MS + t->Length / I2CQ_BYTES_PER_MS;
+        if (t->RegSize != 0) {
+            ret = t->Read ? HAL_I2C_Mem_Read_IT(bus->Handle, address, t->Reg, t->RegSize, t->Data, t->Length)
+                          : HAL_I2C_Mem_Write_IT(bus->Handle, address, t->Reg, t->RegSize, t->Data, t->Length);
+        } else {
+            ret = t->Read ? HAL_I2C_Master_Receive_IT(bus->Handle, address, t->Data, t->Length)
+                          : HAL_I2C_Master_Transmit_IT(bus->Handle, address, t->Data, t->Length);
+        }
+        if (ret != HAL_OK) {
+            bus->Active = NULL;
+            i2cq_Failed(bus, t, 0);
+        }
+    }
+}
+
+static void i2cq_SSD1306_Write(SSD1306_Display_t* display, uint8_t control, uint8_t* buffer, size_t buff_size) {
+    I2CQ_Display_t* queued = (I2CQ_Display_t*)display->Bus;
+    I2CQ_Transaction_t t;
+    i2cq_SetupWrite(&t, &queued->Device, control, buffer, buff_size);
+    i2cq_Transfer(&t);
+}
+
+// Send bytes to the command register, one control byte (Co = 0) for all of them
+static void i2cq_SSD1306_WriteCommands(SSD1306_Display_t* display, const uint8_t* buffer, size_t buff_size) {
+    i2cq_SSD1306_Write(display, 0x00, (uint8_t*)buffer, buff_size);
+}
+
+static void i2cq_SSD1306_WriteData(SSD1306_Display_t* display, uint8_t* buffer, size_t buff_size) {
+    i2cq_SSD1306_Write(display, 0x40, buffer, buff_size);
+}
+
+#ifdef SSD1306_USE_DMA
+static void i2cq_SSD1306_SendChunk(I2CQ_Display_t* queued);
+
+// The display goes on with the next page once the whole write is out
+static void i2cq_SSD1306_DataDone(I2CQ_Transaction_t* t) {
+    I2CQ_Display_t* queued = (I2CQ_Display_t*)t->Context;
+    if (t->Status != I2CQ_OK) {
+        // Retries used up, the panel RAM is unknown from here on: the driver
+        // gives up the frame and sends the whole screen with the next update
+        queued->RestLength = 0;
+        ssd1306_TxErrorCallback(queued);
+    } else if (queued->RestLength != 0) {
+        i2cq_SSD1306_SendChunk(queued);
+    } else {
+        ssd1306_TxCpltCallback(queued);
+    }
+}
+
+// Queue the next piece, the display RAM address keeps counting between them
+static void i2cq_SSD1306_SendChunk(I2CQ_Display_t* queued) {
+    uint16_t len = queued->RestLength < I2CQ_DISPLAY_CHUNK ? queued->RestLength : I2CQ_DISPLAY_CHUNK;
+    i2cq_SetupWrite(&queued->Data, &queued->Device, 0x40, queued->Rest, len);
+    queued->Data.Priority = I2CQ_PRIORITY_LOW;
+    queued->Data.Callback = i2cq_SSD1306_DataDone;
+    queued->Data.Context = queued;
+    queued->Rest += len;
+    queued->RestLength -= len;
+    i2cq_Submit(&queued->Data);
+}
+
+// Always taken, the queue starts it once the bus is free
+static HAL_StatusTypeDef i2cq_SSD1306_WriteDataDMA(SSD1306_Display_t* display, uint8_t* buffer, size_t buff_size) {
+    I2CQ_Display_t* queued = (I2CQ_Display_t*)display->Bus;
+    queued->Rest = buffer;
+    queued->RestLength = buff_size;
+    i2cq_SSD1306_SendChunk(queued);
+    return HAL_OK;
+}
+#endif
+
+const SSD1306_Transport_t i2cq_TransportSSD1306 = {
+    .Reset = NULL,
+    .WriteCommands = i2cq_SSD1306_WriteCommands,
+    .WriteData = i2cq_SSD1306_WriteData,
+#ifdef SSD1306_USE_DMA
+    .WriteDataDMA = i2cq_SSD1306_WriteDataDMA,
+#endif
+    .EndDataDMA = NULL,
+    .AbortDMA = NULL, // i2cq_Poll() aborts stuck attempts
+};
+
+void i2cq_InitBus(I2CQ_Bus_t* bus, I2C_HandleTypeDef* handle) {
+    I2CQ_START_CLOCK();
+    for (uint8_t p = 0; p < I2CQ_PRIORITIES; p++) {
+        bus->Head[p] = NULL;
+        bus->Tail[p] = NULL;
+    }
+    bus->Handle = handle;
+    bus->Active = NULL;
+    bus->Stuck = 0;
+    if (i2cq_FindBus(handle) == NULL) {
+        bus->Next = I2CQ_Buses;
+        I2CQ_Buses = bus;
+    }
+}
+
+void i2cq_InitDevice(I2CQ_Device_t* device, I2CQ_Bus_t* bus, uint16_t address, const char* name) {
+    device->Bus = bus;
+    device->Address = address;
+    device->Name = name;
+    i2cq_ResetStats(device);
+}
+
+void i2cq_ResetStats(I2CQ_Device_t* device) {
+    I2CQ_LOCK();
+    device->Stats = (I2CQ_Stats_t){0};
+    I2CQ_UNLOCK();
+}
+
+static void i2cq_Setup(I2CQ_Transaction_t* t, I2CQ_Device_t* device, uint8_t read, uint8_t reg, uint8_t* data, uint16_t length) {
+    t->Device = device;
+    t->Read = read;
+    t->Priority = I2CQ_PRIORITY_NORMAL;
+    t->Retries = I2CQ_RETRIES;
+    t->RegSize = 1;
+    t->Reg = reg;
+    t->Length = length;
+    t->Data = data;
+    t->Callback = NULL;
+    t->Context = NULL;
+    t->Status = I2CQ_OK;
+}
+
+void i2cq_SetupRead(I2CQ_Transaction_t* t, I2CQ_Device_t* device, uint8_t reg, uint8_t* data, uint16_t length) {
+    i2cq_Setup(t, device, 1, reg, data, length);
+}
+
+void i2cq_SetupWrite(I2CQ_Transaction_t* t, I2CQ_Device_t* device, uint8_t reg, uint8_t* data, uint16_t length) {
+    i2cq_Setup(t, device, 0, reg, data, length);
+}
+
+I2CQ_Status_t i2cq_Submit(I2CQ_Transaction_t* t) {
+    I2CQ_Bus_t* bus = t->Device->Bus;
+    I2CQ_LOCK();
+    if (t->Status == I2CQ_PENDING) {
+        I2CQ_UNLOCK();
+        return I2CQ_ERROR;
+    }
+    t->Status = I2CQ_PENDING;
+    t->Attempts = 0;
+    t->Submitted = I2CQ_NOW();
+    i2cq_Append(bus, t);
+    i2cq_StartNext(bus);
+    I2CQ_UNLOCK();
+    return I2CQ_PENDING;
+}
+
+I2CQ_Status_t i2cq_Transfer(I2CQ_Transaction_t* t) {
+    if (i2cq_Submit(t) != I2CQ_PENDING) {
+        return I2CQ_ERROR;
+    }
+    while (t->Status == I2CQ_PENDING) {
+        // A stuck attempt ahead of it would never finish otherwise
+        i2cq_Poll();
+        I2CQ_WAIT();
+    }
+    return t->Status;
+}
+
+void i2cq_TransferDone(I2C_HandleTypeDef* handle) {
+    I2CQ_Bus_t* bus = i2cq_FindBus(handle);
+    if (bus == NULL) {
+        return;
+    }
+    I2CQ_LOCK();
+    I2CQ_Transaction_t* t = bus->Active;
+    if (t != NULL) {
+        bus->Active = NULL;
+        i2cq_Finish(t, I2CQ_OK);
+        i2cq_StartNext(bus);
+    }
+    I2CQ_UNLOCK();
+}
+
+void i2cq_TransferError(I2C_HandleTypeDef* handle) {
+    I2CQ_Bus_t* bus = i2cq_FindBus(handle);
+    if (bus == NULL) {
+        return;
+    }
+    I2CQ_LOCK();
+    I2CQ_Transaction_t* t = bus->Active;
+    if (t != NULL) {
+        bus->Active = NULL;
+        i2cq_Failed(bus, t, (HAL_I2C_GetError(handle) & HAL_I2C_ERROR_AF) != 0);
+        i2cq_StartNext(bus);
+    }
+    I2CQ_UNLOCK();
+}
+
+// The HAL calls of the recovery stay out of SysTick, it may interrupt thread code using the handle
+void i2cq_Tick(void) {
+    for (I2CQ_Bus_t* bus = I2CQ_Buses; bus != NULL; bus = bus->Next) {
+        if (bus->Active != NULL && HAL_GetTick() - bus->Started >= bus->Timeout) {
+            bus->Stuck = 1;
+        }
+    }
+}
+
+void i2cq_Poll(void) {
+    for (I2CQ_Bus_t* bus = I2CQ_Buses; bus != NULL; bus = bus->Next) {
+        if (!bus->Stuck) {
+            continue;
+        }
+        I2CQ_LOCK();
+        bus->Stuck = 0;
+        I2CQ_Transaction_t* t = bus->Active;
+        // The attempt may have finished since the tick, or a new one started
+        if (t != NULL && HAL_GetTick() - bus->Started >= bus->Timeout) {
+            // Stops the transfer, a device stretching the clock forever included
+            bus->Active = NULL;
+            HAL_I2C_DeInit(bus->Handle);
+            HAL_I2C_Init(bus->Handle);
+            i2cq_Finish(t, I2CQ_TIMEOUT);
+            i2cq_StartNext(bus);
+        }
+        I2CQ_UNLOCK();
+    }
+}
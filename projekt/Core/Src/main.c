@@ -2,6 +2,8 @@
 #include "main.h"
 #include "ssd1306.h"
 #include "ssd1306_fonts.h"
+#include "ssd1306_circles.h"
+#include "i2c_queue.h"
 #include "sx1509.h"
 #include <LCD_KEYPAD.h>
 #include <stdio.h>
@@ -17,6 +19,15 @@
 #define MAP_HEIGHT 64
 #define MAP_NO_DOTS_ZONE 15
 #define PLAYER_LIMIT 24
+#define SPRITE_PLAYER 10
+#define SPRITE_BOT 11
+#define SPRITE_COUNT 12
+#define FADE_MS 300 // Screen transitions, see screenFadeIn()
+// Pause popup, two whole pages in the middle of the screen
+#define PAUSE_X1 40
+#define PAUSE_Y1 24
+#define PAUSE_X2 87
+#define PAUSE_Y2 39
 /* Private typedef -----------------------------------------------------------*/
 typedef uint64_t flash_datatype;
 typedef struct
@@ -43,14 +54,34 @@ typedef struct
 /* Private variables ---------------------------------------------------------*/
 I2C_HandleTypeDef hi2c1;
 SPI_HandleTypeDef hspi1;
+DMA_HandleTypeDef hdma_spi1_tx;
 UART_HandleTypeDef huart2;
+I2CQ_Bus_t i2c1Queue; // Every hi2c1 transfer goes through it
+#ifdef SSD1306_USE_I2C
+/* The display shares hi2c1 with the keypad, so it goes through the queue as well */
+I2CQ_Display_t displayQueue;
+static uint8_t displayBuffer[SSD1306_BUFFER_SIZE] __ALIGNED(4);
+static uint8_t displayFront[SSD1306_BUFFER_SIZE] __ALIGNED(4);
+SSD1306_Display_t display = {
+    .Transport = &i2cq_TransportSSD1306,
+    .Bus = &displayQueue,
+    .Height = SSD1306_HEIGHT,
+    .XOffset = SSD1306_X_OFFSET_LOWER + (SSD1306_X_OFFSET_UPPER << 4),
+    .Buffer = displayBuffer,
+    .FrontBuffer = displayFront,
+};
+#endif
 HighScore topScores[3];
 Dot dots[10];
 player myPlayer;
+/* Sprites of the game screen: the dots, then both players */
+SSD1306_Sprite_t sprites[SPRITE_COUNT];
+static const uint8_t dotMask[] = {0x01};
 /* Bitmaps */
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
+static void MX_DMA_Init(void);
 static void MX_USART2_UART_Init(void);
 static void MX_I2C1_Init(void);
 static void MX_SPI1_Init(void);
@@ -61,6 +92,14 @@ void updatePlayer(player *p);
 int dotEat(player *p);
 void dotPosition(int n);
 void dotDraw(void);
+void playerDraw(SSD1306_Sprite_t *sprite, const player *p, const uint8_t *circles);
+void gameScreenStart(void);
+void gameScreenEnd(void);
+void pauseGame(void);
+SSD1306_Error_t pauseDrawPopup(SSD1306_Overlay_t *overlay, uint8_t *saved);
+void screenFadeIn(void);
+void screenFadeOut(void);
+void waitWithFade(uint32_t ms);
 void loadHighScores(void);
 void updateHighScores(uint32_t newScore, const char *newName);
 void menuDisplay(void);
@@ -88,11 +127,18 @@ int main(void)
     HAL_Init();
     SystemClock_Config();
     MX_GPIO_Init();
+    MX_DMA_Init();
     MX_USART2_UART_Init();
     MX_I2C1_Init();
     MX_SPI1_Init();
     /* Peripherals Initialization */
+    i2cq_InitBus(&i2c1Queue, &hi2c1);
+    sx1509Init(&i2c1Queue);
     LCD_init();
+#ifdef SSD1306_USE_I2C
+    i2cq_InitDevice(&displayQueue.Device, &i2c1Queue, SSD1306_I2C_ADDR, "SSD1306");
+    ssd1306_SelectDisplay(&display);
+#endif
     ssd1306_Init();
     /* Game State Initialization */
     loadHighScores();
@@ -101,6 +147,13 @@ int main(void)
     bot.dx = 1;
     for (int i = 0; i < 10; i++)
         dotPosition(i);
+    for (int i = 0; i < 10; i++)
+        ssd1306_SpriteInit(&sprites[i], dotMask, 1, 1, White);
+    ssd1306_SpriteInit(&sprites[SPRITE_PLAYER], NULL, 0, 0, White);
+    ssd1306_SpriteInit(&sprites[SPRITE_BOT], NULL, 0, 0, White);
+#ifdef SSD1306_USE_GRAYSCALE
+    sprites[SPRITE_BOT].dim = 1;
+#endif
     HAL_UART_Transmit(&huart2, (uint8_t *)"\033[2J\033[HScore: 0", strlen("\033[2J\033[HScore: 0"), 30);
     /* Intro */
     // winAnimation();
@@ -109,6 +162,8 @@ int main(void)
     /* Game Loop */
     while (1)
     {
+        // A transfer SysTick found stuck is aborted here, not in the interrupt
+        i2cq_Poll();
         uint8_t received_char;
         HAL_StatusTypeDef status = HAL_UART_Receive(&huart2, &received_char, 1, 1);
         if (status == HAL_OK)
@@ -132,6 +187,9 @@ int main(void)
                 myPlayer.dx = 1;
                 myPlayer.dy = 0;
                 break;
+            case 'p':
+                pauseGame();
+                break;
             }
         }
         // --- 2. BOT INPUT ---
@@ -160,6 +218,7 @@ int main(void)
             // Bot is bigger: Does the Bot's radius reach the Player's center?
             if (distSq < (bot.radius * bot.radius))
             {
+                gameScreenEnd();
                 loseAnimation();
                 resetGame(&bot, &myPlayer);
                 menuDisplay();
@@ -170,6 +229,7 @@ int main(void)
             // Player is bigger: Does the Player's radius reach the Bot's center?
             if (distSq < (myPlayer.radius * myPlayer.radius))
             {
+                gameScreenEnd();
                 updateHighScores(myPlayer.score, myPlayer.nickname);
                 winAnimation();
                 resetGame(&bot, &myPlayer);
@@ -179,19 +239,27 @@ int main(void)
         // DRAW
         if (bot.radius == PLAYER_LIMIT && myPlayer.radius == PLAYER_LIMIT)
         {
+            gameScreenEnd();
             drawAnimation();
             resetGame(&bot, &myPlayer);
             menuDisplay();
         }
         // --- 6. DRAWING ---
-        ssd1306_Fill(Black);
+        ssd1306_FadeUpdate();
         dotDraw();
         // Draw Human (Filled)
-        ssd1306_FillCircle(myPlayer.x + myPlayer.radius, myPlayer.y + myPlayer.radius, myPlayer.radius, White);
+        playerDraw(&sprites[SPRITE_PLAYER], &myPlayer, SSD1306_FilledCircles);
+#ifdef SSD1306_USE_GRAYSCALE
+        // Draw Bot (Filled, light gray to differentiate)
+        playerDraw(&sprites[SPRITE_BOT], &bot, SSD1306_FilledCircles);
+#else
         // Draw Bot (Empty/Outline to differentiate)
-        ssd1306_DrawCircle(bot.x + bot.radius, bot.y + bot.radius, bot.radius, White);
-        ssd1306_UpdateScreen();
-        HAL_Delay(30);
+        playerDraw(&sprites[SPRITE_BOT], &bot, SSD1306_OutlineCircles);
+#endif
+        // Only the sprites that moved or grew are erased and drawn again
+        ssd1306_UpdateSprites(sprites, SPRITE_COUNT, Black);
+        ssd1306_UpdateScreenAsync();
+        waitWithFade(30);
     }
 }
 /* Game Logic Implementations ------------------------------------------------*/
@@ -360,22 +428,127 @@ void dotPosition(int n)
 void dotDraw(void)
 {
     for (int i = 0; i < 10; i++)
-        ssd1306_DrawPixel(dots[i].x, dots[i].y, White);
+        ssd1306_SpriteMove(&sprites[i], dots[i].x, dots[i].y);
+}
+void playerDraw(SSD1306_Sprite_t *sprite, const player *p, const uint8_t *circles)
+{
+    // The circle tables cover every player radius (3..PLAYER_LIMIT)
+    const int d = 2 * p->radius + 1;
+    ssd1306_SpriteSetImage(sprite, &circles[SSD1306_CircleOffsets[p->radius - SSD1306_CIRCLE_R_MIN]], d, d);
+    ssd1306_SpriteMove(sprite, p->x, p->y);
+}
+void gameScreenStart(void)
+{
+    ssd1306_Fill(Black);
+    ssd1306_ForgetSprites(sprites, SPRITE_COUNT);
+#ifdef SSD1306_USE_GRAYSCALE
+    // SysTick times the subframes, the waits of the game loop start them
+    ssd1306_GrayBegin();
+#endif
+    ssd1306_UpdateScreen();
+    // Continues in the game loop
+    screenFadeIn();
+}
+void gameScreenEnd(void)
+{
+    screenFadeOut();
+#ifdef SSD1306_USE_GRAYSCALE
+    // The round end screens are drawn in one bit
+    ssd1306_GrayEnd();
+#endif
+}
+// Popup over the running game until 'p' again, only its area is saved, sent and restored
+void pauseGame(void)
+{
+    static uint8_t saved[2][SSD1306_OVERLAY_SIZE(PAUSE_X1, PAUSE_Y1, PAUSE_X2, PAUSE_Y2)];
+    // Not open unless pauseDrawPopup() opened it, ssd1306_OverlayEnd() leaves those alone
+    SSD1306_Overlay_t overlay[2] = {0};
+    SSD1306_Error_t shown[2] = {SSD1306_ERR, SSD1306_ERR};
+    shown[0] = pauseDrawPopup(&overlay[0], saved[0]);
+#ifdef SSD1306_USE_GRAYSCALE
+    // The game shows through where the low plane is set, the popup goes into both
+    ssd1306_SetDrawPlane(SSD1306_PLANE_LOW);
+    shown[1] = pauseDrawPopup(&overlay[1], saved[1]);
+    ssd1306_SetDrawPlane(SSD1306_PLANE_HIGH);
+#endif
+    ssd1306_UpdateScreenAsync();
+    uint8_t received_char = 0;
+    while (HAL_UART_Receive(&huart2, &received_char, 1, 1) != HAL_OK || received_char != 'p')
+    {
+        i2cq_Poll();
+#ifdef SSD1306_USE_GRAYSCALE
+        ssd1306_GrayPoll();
+#endif
+    }
+    for (int i = 1; i >= 0; i--)
+    {
+        if (shown[i] == SSD1306_OK)
+            ssd1306_OverlayEnd(&overlay[i]);
+    }
+    ssd1306_UpdateScreenAsync();
+}
+SSD1306_Error_t pauseDrawPopup(SSD1306_Overlay_t *overlay, uint8_t *saved)
+{
+    if (ssd1306_OverlayBegin(overlay, saved, SSD1306_OVERLAY_SIZE(PAUSE_X1, PAUSE_Y1, PAUSE_X2, PAUSE_Y2),
+                             PAUSE_X1, PAUSE_Y1, PAUSE_X2, PAUSE_Y2) != SSD1306_OK)
+    {
+        // Nothing saved, drawing would leave the popup on the game
+        return SSD1306_ERR;
+    }
+    ssd1306_FillRectangle(PAUSE_X1, PAUSE_Y1, PAUSE_X2, PAUSE_Y2, Black);
+    ssd1306_DrawRectangle(PAUSE_X1, PAUSE_Y1, PAUSE_X2, PAUSE_Y2, White);
+    ssd1306_SetCursor(PAUSE_X1 + 9, PAUSE_Y1 + 4);
+    ssd1306_WriteString("PAUZA", Font_6x8, White);
+    return SSD1306_OK;
+}
+// Fade from black to the screen on the panel, driven by ssd1306_FadeUpdate()
+void screenFadeIn(void)
+{
+    ssd1306_FadeTo(0xFF, FADE_MS, 0);
+}
+// Fade to black and turn the panel off, the next screen can be sent unseen
+void screenFadeOut(void)
+{
+    ssd1306_FadeTo(0x00, FADE_MS, 1);
+    while (ssd1306_FadeUpdate())
+    {
+        i2cq_Poll();
+#ifdef SSD1306_USE_GRAYSCALE
+        ssd1306_GrayPoll();
+#endif
+    }
+}
+// HAL_Delay() that keeps a fade, the gray subframes and the I2C queue going
+void waitWithFade(uint32_t ms)
+{
+    uint32_t start = HAL_GetTick();
+    while (HAL_GetTick() - start < ms)
+    {
+        ssd1306_FadeUpdate();
+        i2cq_Poll();
+#ifdef SSD1306_USE_GRAYSCALE
+        ssd1306_GrayPoll();
+#endif
+    }
 }
 void menuDisplay(void)
 {
     drawMenuInterface();
+    screenFadeIn();
     uint8_t buffer[1];
     while (1)
     {
         buffer[0] = 0;
-        HAL_UART_Receive(&huart2, buffer, 1, 50);
+        ssd1306_FadeUpdate();
+        i2cq_Poll();
+        HAL_UART_Receive(&huart2, buffer, 1, 10);
         switch (buffer[0])
         {
         case '1':
             if (myPlayer.nickname[0] == '\0')
                 drawNickInterface();
             loadingAnimation();
+            gameScreenStart();
             return;
         case '2':
             showDescription();
@@ -397,8 +570,7 @@ void menuDisplay(void)
 }
 void drawMenuInterface(void)
 {
-    ssd1306_Fill(Black);
-    ssd1306_DrawBitmap(0, 0, menu, 128, 64, White);
+    ssd1306_BlitBitmapPages(0, 0, menu_pages, 128, 64);
     ssd1306_SetCursor(12, 15);
     ssd1306_WriteString("1. Graj", Font_6x8, White);
     ssd1306_SetCursor(12, 25);
@@ -416,6 +588,12 @@ void drawNickInterface(void)
     uint8_t rx_data;
     uint32_t last_tick = HAL_GetTick();
     uint8_t cursor_visible = 1;
+    // The frame and the label never change, draw them once and keep them as a layer
+    static uint32_t background[SSD1306_LAYER_WORDS];
+    ssd1306_BlitBitmapPages(0, 0, menu_pages, 128, 64);
+    ssd1306_SetCursor(16, 15);
+    ssd1306_WriteString("Wpisz nick:", Font_6x8, White);
+    ssd1306_SaveLayer(background);
     while (1)
     {
         if (HAL_UART_Receive(&huart2, &rx_data, 1, 10) == HAL_OK)
@@ -444,10 +622,7 @@ void drawNickInterface(void)
             cursor_visible = !cursor_visible;
             last_tick = HAL_GetTick();
         }
-        ssd1306_Fill(Black);
-        ssd1306_DrawBitmap(0, 0, menu, 128, 64, White);
-        ssd1306_SetCursor(16, 15);
-        ssd1306_WriteString("Wpisz nick:", Font_6x8, White);
+        ssd1306_ComposeLayers(background, NULL, NULL);
         ssd1306_SetCursor(16, 25);
         ssd1306_WriteString(nickname, Font_6x8, White);
         if (cursor_visible)
@@ -459,12 +634,18 @@ void drawNickInterface(void)
 }
 void loadingAnimation(void)
 {
+    screenFadeOut();
+    ssd1306_Fill(Black);
+    ssd1306_DrawCircle(64, 32, 20, White);
+    ssd1306_Line(56, 38, 64, 43, White);
+    ssd1306_Line(64, 43, 72, 38, White);
+    ssd1306_SetCursor(35, 56);
+    ssd1306_WriteString("Loading...", Font_6x8, White);
     for (int i = 0; i < 6; i++)
     {
-        ssd1306_Fill(Black);
-        ssd1306_DrawCircle(64, 32, 20, White);
-        ssd1306_Line(56, 38, 64, 43, White);
-        ssd1306_Line(64, 43, 72, 38, White);
+        // Only the eyes change
+        ssd1306_FillRectangle(53, 23, 59, 29, Black);
+        ssd1306_FillRectangle(69, 23, 75, 29, Black);
         if (i % 2 == 0)
         {
             ssd1306_DrawCircle(56, 26, 2, White);
@@ -475,11 +656,12 @@ void loadingAnimation(void)
             ssd1306_Line(54, 26, 58, 26, White);
             ssd1306_Line(70, 26, 74, 26, White);
         }
-        ssd1306_SetCursor(35, 56);
-        ssd1306_WriteString("Loading...", Font_6x8, White);
         ssd1306_UpdateScreen();
-        HAL_Delay(500);
+        if (i == 0)
+            screenFadeIn();
+        waitWithFade(500);
     }
+    screenFadeOut();
 }
 void showAuthors(void)
 {
@@ -529,8 +711,7 @@ void showDescription(void)
 void showScores(void)
 {
     char buffer[32];
-    ssd1306_Fill(Black);
-    ssd1306_DrawBitmap(0, 0, menu, 128, 64, White);
+    ssd1306_BlitBitmapPages(0, 0, menu_pages, 128, 64);
     // Header
     ssd1306_SetCursor(40, 15);
     ssd1306_WriteString("Wyniki:", Font_6x8, White);
@@ -559,86 +740,56 @@ void thanksForPlaying(void)
 }
 void winAnimation(void)
 {
-    for (int j = 0; j < 3; j++)
+    SSD1306_AnimPlayer_t player;
+    ssd1306_AnimationStart(&player, &fajerwerki_anim);
+    while (player.frame < 3 * fajerwerki_anim.frames)
     {
-        for (int i = 1; i <= 11; i++)
-        {
-            ssd1306_Fill(Black);
-            switch (i)
-            {
-            case 1:
-                ssd1306_DrawBitmap(0, 0, fajerwerki1, 128, 64, White);
-                break;
-            case 2:
-                ssd1306_DrawBitmap(0, 0, fajerwerki2, 128, 64, White);
-                break;
-            case 3:
-                ssd1306_DrawBitmap(0, 0, fajerwerki3, 128, 64, White);
-                break;
-            case 4:
-                ssd1306_DrawBitmap(0, 0, fajerwerki4, 128, 64, White);
-                break;
-            case 5:
-                ssd1306_DrawBitmap(0, 0, fajerwerki5, 128, 64, White);
-                break;
-            case 6:
-                ssd1306_DrawBitmap(0, 0, fajerwerki6, 128, 64, White);
-                break;
-            case 7:
-                ssd1306_DrawBitmap(0, 0, fajerwerki7, 128, 64, White);
-                break;
-            case 8:
-                ssd1306_DrawBitmap(0, 0, fajerwerki8, 128, 64, White);
-                break;
-            case 9:
-                ssd1306_DrawBitmap(0, 0, fajerwerki9, 128, 64, White);
-                break;
-            case 10:
-                ssd1306_DrawBitmap(0, 0, fajerwerki10, 128, 64, White);
-                break;
-            case 11:
-                ssd1306_DrawBitmap(0, 0, fajerwerki11, 128, 64, White);
-                break;
-            }
-            ssd1306_SetCursor(43, 39);
-            ssd1306_WriteString("WYGRANA", Font_6x8, White);
-            ssd1306_UpdateScreen();
-            HAL_Delay(100);
-        }
+        ssd1306_AnimationNextFrame(&player);
+        ssd1306_SetCursor(43, 39);
+        ssd1306_WriteString("WYGRANA", Font_6x8, White);
+        ssd1306_UpdateScreen();
+        if (player.frame == 1)
+            screenFadeIn();
+        waitWithFade(100);
     }
+    screenFadeOut();
 }
 void loseAnimation(void)
 {
+    ssd1306_Fill(Black);
+    ssd1306_DrawCircle(64, 32, 20, White);
+    ssd1306_Line(56, 43, 64, 38, White);
+    ssd1306_Line(64, 38, 72, 43, White);
+    ssd1306_DrawCircle(56, 26, 2, White);
+    ssd1306_DrawCircle(72, 26, 2, White);
+    ssd1306_SetCursor(37, 56);
+    ssd1306_WriteString("PRZEGRANA", Font_6x8, White);
     for (int i = 0; i < 10; i++)
     {
-        ssd1306_Fill(Black);
-        ssd1306_DrawCircle(64, 32, 20, White);
-        ssd1306_Line(56, 43, 64, 38, White);
-        ssd1306_Line(64, 38, 72, 43, White);
-        ssd1306_DrawCircle(56, 26, 2, White);
-        ssd1306_DrawCircle(72, 26, 2, White);
-        if (i % 2 == 0)
-        {
-            ssd1306_DrawPixel(53, 27, White);
-            ssd1306_DrawPixel(52, 28, White);
-            ssd1306_DrawPixel(52, 29, White);
-            ssd1306_DrawPixel(53, 30, White);
-            ssd1306_DrawPixel(54, 30, White);
-            ssd1306_DrawPixel(55, 30, White);
-            ssd1306_DrawPixel(56, 29, White);
-        }
-        ssd1306_SetCursor(37, 56);
-        ssd1306_WriteString("PRZEGRANA", Font_6x8, White);
+        // Only the tear blinks
+        const SSD1306_COLOR tear = (i % 2 == 0) ? White : Black;
+        ssd1306_DrawPixel(53, 27, tear);
+        ssd1306_DrawPixel(52, 28, tear);
+        ssd1306_DrawPixel(52, 29, tear);
+        ssd1306_DrawPixel(53, 30, tear);
+        ssd1306_DrawPixel(54, 30, tear);
+        ssd1306_DrawPixel(55, 30, tear);
+        ssd1306_DrawPixel(56, 29, tear);
         ssd1306_UpdateScreen();
-        HAL_Delay(500);
+        if (i == 0)
+            screenFadeIn();
+        waitWithFade(500);
     }
+    screenFadeOut();
 }
 void drawAnimation(void)
 {
     ssd1306_SetCursor(52, 56);
     ssd1306_WriteString("REMIS", Font_6x8, White);
     ssd1306_UpdateScreen();
-    HAL_Delay(2000);
+    screenFadeIn();
+    waitWithFade(2000);
+    screenFadeOut();
 }
 void resetGame(player *b, player *h)
 {
@@ -812,6 +963,11 @@ static void MX_I2C1_Init(void)
         Error_Handler();
     if (HAL_I2CEx_ConfigDigitalFilter(&hi2c1, 0) != HAL_OK)
         Error_Handler();
+    // Transfers of the I2C queue run in these interrupts
+    HAL_NVIC_SetPriority(I2C1_EV_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(I2C1_EV_IRQn);
+    HAL_NVIC_SetPriority(I2C1_ER_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(I2C1_ER_IRQn);
 }
 static void MX_SPI1_Init(void)
 {
@@ -832,6 +988,12 @@ static void MX_SPI1_Init(void)
     if (HAL_SPI_Init(&hspi1) != HAL_OK)
         Error_Handler();
 }
+static void MX_DMA_Init(void)
+{
+    __HAL_RCC_DMA1_CLK_ENABLE();
+    HAL_NVIC_SetPriority(DMA1_Channel3_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel3_IRQn);
+}
 static void MX_USART2_UART_Init(void)
 {
     huart2.Instance = USART2;
@@ -903,6 +1065,38 @@ static void MX_GPIO_Init(void)
     HAL_GPIO_Init(SSD1306_Reset_Port, &GPIO_InitStruct);
     HAL_GPIO_WritePin(SX1509_nRST_PORT, SX1509_nRST_Pin, GPIO_PIN_SET);
 }
+/* HAL Callbacks -------------------------------------------------------------*/
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    ssd1306_TxCpltCallback(hspi);
+}
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    ssd1306_TxErrorCallback(hspi);
+}
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    i2cq_TransferDone(hi2c);
+}
+void HAL_I2C_MasterRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    i2cq_TransferDone(hi2c);
+}
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    i2cq_TransferDone(hi2c);
+    // Displays with ssd1306_TransportI2C on another bus than the queues
+    ssd1306_TxCpltCallback(hi2c);
+}
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    i2cq_TransferDone(hi2c);
+}
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    i2cq_TransferError(hi2c);
+    ssd1306_TxErrorCallback(hi2c);
+}
 void Error_Handler(void)
 {
     __disable_irq();
@@ -1,164 +1,571 @@
 #include "ssd1306.h"
-#include <math.h>
+#include "ssd1306_circles.h"
+#include "ssd1306_sine.h"
 #include <stdlib.h>
 #include <string.h>  // For memcpy
 
-#if defined(SSD1306_USE_I2C)
+#ifdef SSD1306_USE_BUS_STATS
+static SSD1306_BusStats_t SSD1306_BusStats;
+#define SSD1306_COUNT_TRANSACTION(len) do { SSD1306_BusStats.Bytes += (len); SSD1306_BusStats.Transactions++; } while (0)
+#else
+#define SSD1306_COUNT_TRANSACTION(len)
+#endif
 
-void ssd1306_Reset(void) {
-    /* for I2C - do nothing */
-}
+#ifdef SSD1306_USE_BUS_TRACE
+#define SSD1306_TRACE(display, kind, buffer, len) ssd1306_BusTrace(display, kind, buffer, len)
+#else
+#define SSD1306_TRACE(display, kind, buffer, len)
+#endif
 
-// Send a byte to the command register
-void ssd1306_WriteCommand(uint8_t byte) {
-    HAL_I2C_Mem_Write(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x00, 1, &byte, 1, HAL_MAX_DELAY);
+#ifdef SSD1306_USE_DMA
+#define SSD1306_WAIT_FOR_TRANSFER() ssd1306_WaitForBus()
+#else
+#define SSD1306_WAIT_FOR_TRANSFER()
+#endif
+
+#ifdef SSD1306_USE_GRAYSCALE
+// Set between ssd1306_GrayBegin() and ssd1306_GrayEnd()
+static volatile uint8_t SSD1306_GrayOn;
+// Display in gray mode, ssd1306_GrayPoll() sends to it whichever display is selected
+static SSD1306_Display_t* SSD1306_GrayDisplay;
+#define SSD1306_GRAY_ACTIVE() (SSD1306_GrayOn && SSD1306_Display == SSD1306_GrayDisplay)
+// Nonzero while the bus or the front planes are in use outside ssd1306_GrayPoll(), which then waits
+static volatile uint8_t SSD1306_GrayLock;
+#define SSD1306_GRAY_LOCK()   (SSD1306_GrayLock++)
+#define SSD1306_GRAY_UNLOCK() (SSD1306_GrayLock--)
+#else
+#define SSD1306_GRAY_LOCK()
+#define SSD1306_GRAY_UNLOCK()
+#endif
+
+// Pre-charge period (0xD9), phase 2 in the high nibble, phase 1 in the low one
+#define SSD1306_PRECHARGE       0x22
+#define SSD1306_PRECHARGE_DIM   0x11 // Bottom of a fade, see ssd1306_FadeTo()
+
+#ifdef HAL_I2C_MODULE_ENABLED
+
+// Send bytes to the command register, one control byte (Co = 0) for all of them
+static void ssd1306_I2C_WriteCommands(SSD1306_Display_t* display, const uint8_t* buffer, size_t buff_size) {
+    HAL_I2C_Mem_Write((I2C_HandleTypeDef*)display->Bus, display->Address, 0x00, 1, (uint8_t*)buffer, buff_size, HAL_MAX_DELAY);
 }
 
 // Send data
-void ssd1306_WriteData(uint8_t* buffer, size_t buff_size) {
-    HAL_I2C_Mem_Write(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x40, 1, buffer, buff_size, HAL_MAX_DELAY);
+static void ssd1306_I2C_WriteData(SSD1306_Display_t* display, uint8_t* buffer, size_t buff_size) {
+    HAL_I2C_Mem_Write((I2C_HandleTypeDef*)display->Bus, display->Address, 0x40, 1, buffer, buff_size, HAL_MAX_DELAY);
 }
 
-#elif defined(SSD1306_USE_SPI)
+// Start sending data in the background, completion is signalled by HAL_I2C_MemTxCpltCallback
+static HAL_StatusTypeDef ssd1306_I2C_WriteDataDMA(SSD1306_Display_t* display, uint8_t* buffer, size_t buff_size) {
+    return HAL_I2C_Mem_Write_DMA((I2C_HandleTypeDef*)display->Bus, display->Address, 0x40, 1, buffer, buff_size);
+}
 
-void ssd1306_Reset(void) {
+const SSD1306_Transport_t ssd1306_TransportI2C = {
+    .Reset = NULL, // for I2C - do nothing
+    .WriteCommands = ssd1306_I2C_WriteCommands,
+    .WriteData = ssd1306_I2C_WriteData,
+    .WriteDataDMA = ssd1306_I2C_WriteDataDMA,
+    .EndDataDMA = NULL,
+    .AbortDMA = NULL, // The HAL can't abort memory writes, they end with HAL_I2C_ErrorCallback
+};
+
+#endif
+
+#ifdef HAL_SPI_MODULE_ENABLED
+
+#ifdef SSD1306_USE_SPI_LL
+#if !defined(SPI_SR_TXE)
+#error "SSD1306_USE_SPI_LL needs an SPI with TXE/BSY flags (not STM32H7)"
+#endif
+
+#define SSD1306_PIN_LOW(port, pin)  ((port)->BSRR = (uint32_t)(pin) << 16)
+#define SSD1306_PIN_HIGH(port, pin) ((port)->BSRR = (uint32_t)(pin))
+
+// Blocking transmit on the registers: byte writes to DR keep 8 bit frames
+// with the TX FIFO, the received bytes are dropped and OVR cleared at the end
+static void ssd1306_SpiTransmit(SPI_TypeDef* spi, const uint8_t* buffer, size_t buff_size) {
+    if (!(spi->CR1 & SPI_CR1_SPE)) {
+        spi->CR1 |= SPI_CR1_SPE;
+    }
+    for (size_t i = 0; i < buff_size; i++) {
+        while (!(spi->SR & SPI_SR_TXE)) {
+        }
+        *(__IO uint8_t*)&spi->DR = buffer[i];
+    }
+#ifdef SPI_SR_FTLVL
+    while (spi->SR & SPI_SR_FTLVL) {
+    }
+#else
+    while (!(spi->SR & SPI_SR_TXE)) {
+    }
+#endif
+    while (spi->SR & SPI_SR_BSY) {
+    }
+    while (spi->SR & SPI_SR_RXNE) {
+        (void)*(__IO uint8_t*)&spi->DR;
+    }
+    (void)spi->SR;
+}
+#define SSD1306_SPI_TRANSMIT(display, buffer, buff_size) \
+    ssd1306_SpiTransmit(((SPI_HandleTypeDef*)(display)->Bus)->Instance, buffer, buff_size)
+#else
+#define SSD1306_PIN_LOW(port, pin)  HAL_GPIO_WritePin(port, pin, GPIO_PIN_RESET)
+#define SSD1306_PIN_HIGH(port, pin) HAL_GPIO_WritePin(port, pin, GPIO_PIN_SET)
+#define SSD1306_SPI_TRANSMIT(display, buffer, buff_size) \
+    HAL_SPI_Transmit((SPI_HandleTypeDef*)(display)->Bus, (uint8_t*)(buffer), buff_size, HAL_MAX_DELAY)
+#endif
+
+static void ssd1306_SPI_Reset(SSD1306_Display_t* display) {
     // CS = High (not selected)
-    HAL_GPIO_WritePin(SSD1306_CS_Port, SSD1306_CS_Pin, GPIO_PIN_SET);
+    HAL_GPIO_WritePin(display->CS_Port, display->CS_Pin, GPIO_PIN_SET);
 
     // Reset the OLED
-    HAL_GPIO_WritePin(SSD1306_Reset_Port, SSD1306_Reset_Pin, GPIO_PIN_RESET);
+    HAL_GPIO_WritePin(display->Reset_Port, display->Reset_Pin, GPIO_PIN_RESET);
     HAL_Delay(10);
-    HAL_GPIO_WritePin(SSD1306_Reset_Port, SSD1306_Reset_Pin, GPIO_PIN_SET);
+    HAL_GPIO_WritePin(display->Reset_Port, display->Reset_Pin, GPIO_PIN_SET);
     HAL_Delay(10);
 }
 
-// Send a byte to the command register
-void ssd1306_WriteCommand(uint8_t byte) {
-    HAL_GPIO_WritePin(SSD1306_CS_Port, SSD1306_CS_Pin, GPIO_PIN_RESET); // select OLED
-    HAL_GPIO_WritePin(SSD1306_DC_Port, SSD1306_DC_Pin, GPIO_PIN_RESET); // command
-    HAL_SPI_Transmit(&SSD1306_SPI_PORT, (uint8_t *) &byte, 1, HAL_MAX_DELAY);
-    HAL_GPIO_WritePin(SSD1306_CS_Port, SSD1306_CS_Pin, GPIO_PIN_SET); // un-select OLED
+// Send bytes to the command register, DC stays low for all of them
+static void ssd1306_SPI_WriteCommands(SSD1306_Display_t* display, const uint8_t* buffer, size_t buff_size) {
+    SSD1306_PIN_LOW(display->CS_Port, display->CS_Pin); // select OLED
+    SSD1306_PIN_LOW(display->DC_Port, display->DC_Pin); // command
+    SSD1306_SPI_TRANSMIT(display, buffer, buff_size);
+    SSD1306_PIN_HIGH(display->CS_Port, display->CS_Pin); // un-select OLED
+}
+
+// Send data
+static void ssd1306_SPI_WriteData(SSD1306_Display_t* display, uint8_t* buffer, size_t buff_size) {
+    SSD1306_PIN_LOW(display->CS_Port, display->CS_Pin); // select OLED
+    SSD1306_PIN_HIGH(display->DC_Port, display->DC_Pin); // data
+    SSD1306_SPI_TRANSMIT(display, buffer, buff_size);
+    SSD1306_PIN_HIGH(display->CS_Port, display->CS_Pin); // un-select OLED
+}
+
+// Start sending data in the background, completion is signalled by HAL_SPI_TxCpltCallback.
+// The OLED stays selected until ssd1306_SPI_EndDataDMA().
+static HAL_StatusTypeDef ssd1306_SPI_WriteDataDMA(SSD1306_Display_t* display, uint8_t* buffer, size_t buff_size) {
+    SSD1306_PIN_LOW(display->CS_Port, display->CS_Pin); // select OLED
+    SSD1306_PIN_HIGH(display->DC_Port, display->DC_Pin); // data
+    return HAL_SPI_Transmit_DMA((SPI_HandleTypeDef*)display->Bus, buffer, buff_size);
+}
+
+static void ssd1306_SPI_EndDataDMA(SSD1306_Display_t* display) {
+    SSD1306_PIN_HIGH(display->CS_Port, display->CS_Pin); // un-select OLED
+}
+
+static void ssd1306_SPI_AbortDMA(SSD1306_Display_t* display) {
+    HAL_SPI_Abort((SPI_HandleTypeDef*)display->Bus);
+}
+
+const SSD1306_Transport_t ssd1306_TransportSPI = {
+    .Reset = ssd1306_SPI_Reset,
+    .WriteCommands = ssd1306_SPI_WriteCommands,
+    .WriteData = ssd1306_SPI_WriteData,
+    .WriteDataDMA = ssd1306_SPI_WriteDataDMA,
+    .EndDataDMA = ssd1306_SPI_EndDataDMA,
+    .AbortDMA = ssd1306_SPI_AbortDMA,
+};
+
+#endif
+
+#if !defined(SSD1306_USE_I2C) && !defined(SSD1306_USE_SPI)
+#error "You should define SSD1306_USE_SPI or SSD1306_USE_I2C macro"
+#endif
+
+#if (SSD1306_WIDTH % 4) != 0
+#error "Layers work on 32 bit words, SSD1306_WIDTH has to be a multiple of 4"
+#endif
+
+// Screenbuffer of the default display, word aligned for ssd1306_ComposeLayers()
+static uint8_t SSD1306_DefaultBuffer[SSD1306_BUFFER_SIZE] __ALIGNED(4);
+
+#ifdef SSD1306_USE_DMA
+// Copy of the frame being sent by ssd1306_UpdateScreenAsync(), drawing continues in the screenbuffer
+static uint8_t SSD1306_DefaultFront[SSD1306_BUFFER_SIZE];
+#endif
+
+// Display of ssd1306_conf.h, drawing is clipped to the whole screen until ssd1306_SetClipRect()
+static SSD1306_Display_t SSD1306_DefaultDisplay = {
+#if defined(SSD1306_USE_I2C)
+    .Transport = &ssd1306_TransportI2C,
+    .Bus = &SSD1306_I2C_PORT,
+    .Address = SSD1306_I2C_ADDR,
+#else
+    .Transport = &ssd1306_TransportSPI,
+    .Bus = &SSD1306_SPI_PORT,
+    .CS_Port = SSD1306_CS_Port,
+    .CS_Pin = SSD1306_CS_Pin,
+    .DC_Port = SSD1306_DC_Port,
+    .DC_Pin = SSD1306_DC_Pin,
+    .Reset_Port = SSD1306_Reset_Port,
+    .Reset_Pin = SSD1306_Reset_Pin,
+#endif
+    .Height = SSD1306_HEIGHT,
+    .XOffset = SSD1306_X_OFFSET_LOWER + (SSD1306_X_OFFSET_UPPER << 4),
+    .Buffer = SSD1306_DefaultBuffer,
+#ifdef SSD1306_USE_DMA
+    .FrontBuffer = SSD1306_DefaultFront,
+#endif
+    .State = {
+        .ClipX2 = SSD1306_WIDTH - 1,
+        .ClipY2 = SSD1306_HEIGHT - 1,
+    },
+#ifdef SSD1306_USE_DIRTY_UPDATE
+    .FillColor = 0xFF,
+#endif
+};
+
+// Displays set up by ssd1306_Init(), searched by ssd1306_TxCpltCallback()
+static SSD1306_Display_t* SSD1306_Displays = &SSD1306_DefaultDisplay;
+
+// Display the drawing and update functions work on, see ssd1306_SelectDisplay()
+static SSD1306_Display_t* SSD1306_Display = &SSD1306_DefaultDisplay;
+
+// Screen object and screenbuffer of the selected display
+#define SSD1306                 (SSD1306_Display->State)
+#define SSD1306_Buffer          (SSD1306_Display->Buffer)
+
+// Pages of the selected panel, the screenbuffer always has SSD1306_PAGES
+#define SSD1306_DisplayPages    (SSD1306_Display->Height / 8)
+
+#ifdef SSD1306_USE_GRAYSCALE
+// Low plane of the gray mode, the screenbuffer is the high plane
+static uint8_t SSD1306_GrayBuffer[SSD1306_BUFFER_SIZE] __ALIGNED(4);
+// Plane drawn by the drawing functions and ssd1306_Fill(), see ssd1306_SetDrawPlane()
+static uint8_t* SSD1306_Plane = SSD1306_DefaultBuffer;
+#else
+#define SSD1306_Plane SSD1306_Buffer
+#endif
+
+// Drawing target, the screenbuffer or one page strip of ssd1306_RenderList() holding page SSD1306_TargetPage
+static uint8_t* SSD1306_Target = SSD1306_DefaultBuffer;
+static uint8_t SSD1306_TargetPage;
+
+// Start of a page in the drawing target, only pages inside the clip rectangle are valid
+#define SSD1306_PAGE(page) (&SSD1306_Target[((int32_t)(page) - SSD1306_TargetPage) * SSD1306_WIDTH])
+
+#ifdef SSD1306_USE_DMA
+// Window of the background transfer: columns TxX1..TxX2, next page TxPage, last page TxLastPage of TxSource
+#define SSD1306_FrontBuffer     (SSD1306_Display->FrontBuffer)
+#define SSD1306_TxSource        (SSD1306_Display->TxSource)
+#define SSD1306_TxX1            (SSD1306_Display->TxX1)
+#define SSD1306_TxX2            (SSD1306_Display->TxX2)
+#define SSD1306_TxPage          (SSD1306_Display->TxPage)
+#define SSD1306_TxLastPage      (SSD1306_Display->TxLastPage)
+#define SSD1306_TxBusy          (SSD1306_Display->TxBusy)
+
+/* Nonzero while a display on the bus of display sends in the background */
+static uint8_t ssd1306_BusBusy(const SSD1306_Display_t* display) {
+    for (const SSD1306_Display_t* d = SSD1306_Displays; d != NULL; d = d->Next) {
+        if (d->Bus == display->Bus && d->TxBusy) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Give up the background transfer of display, the next update sends the whole screen */
+static void ssd1306_TxFailed(SSD1306_Display_t* display) {
+    SSD1306_TRACE(display, 'E', NULL, 0);
+    if (display->Transport->EndDataDMA != NULL) {
+        display->Transport->EndDataDMA(display);
+    }
+#ifdef SSD1306_USE_DIRTY_UPDATE
+    memset(display->DirtyStart, 0, sizeof(display->DirtyStart));
+    memset(display->DirtyEnd, SSD1306_WIDTH - 1, sizeof(display->DirtyEnd));
+    display->FillColor = 0xFF;
+#endif
+#ifdef SSD1306_USE_DISPLAY_LIST
+    display->ListBackground = 0xFF;
+#endif
+    display->TxBusy = 0;
+}
+
+/* Stop and give up a background transfer that took longer than SSD1306_DMA_TIMEOUT_MS */
+static void ssd1306_TxTimeout(SSD1306_Display_t* display) {
+    if (display->Transport->AbortDMA != NULL) {
+        display->Transport->AbortDMA(display);
+    }
+    ssd1306_TxFailed(display);
+}
+
+/* Transfers on other buses go on, one bus carries one transfer at a time */
+static void ssd1306_WaitForBus(void) {
+    const uint32_t start = HAL_GetTick();
+    while (ssd1306_BusBusy(SSD1306_Display)) {
+        if (HAL_GetTick() - start < SSD1306_DMA_TIMEOUT_MS) {
+            continue;
+        }
+        for (SSD1306_Display_t* d = SSD1306_Displays; d != NULL; d = d->Next) {
+            if (d->Bus == SSD1306_Display->Bus && d->TxBusy) {
+                ssd1306_TxTimeout(d);
+            }
+        }
+    }
+}
+#endif
+
+void ssd1306_Reset(void) {
+    if (SSD1306_Display->Transport->Reset != NULL) {
+        SSD1306_TRACE(SSD1306_Display, 'R', NULL, 0);
+        SSD1306_Display->Transport->Reset(SSD1306_Display);
+    }
+}
+
+// Send bytes to the command register
+void ssd1306_WriteCommands(const uint8_t* buffer, size_t buff_size) {
+    SSD1306_GRAY_LOCK();
+    SSD1306_WAIT_FOR_TRANSFER();
+    SSD1306_TRACE(SSD1306_Display, 'C', buffer, buff_size);
+    SSD1306_Display->Transport->WriteCommands(SSD1306_Display, buffer, buff_size);
+    SSD1306_GRAY_UNLOCK();
+    SSD1306_COUNT_TRANSACTION(buff_size);
 }
 
 // Send data
 void ssd1306_WriteData(uint8_t* buffer, size_t buff_size) {
-    HAL_GPIO_WritePin(SSD1306_CS_Port, SSD1306_CS_Pin, GPIO_PIN_RESET); // select OLED
-    HAL_GPIO_WritePin(SSD1306_DC_Port, SSD1306_DC_Pin, GPIO_PIN_SET); // data
-    HAL_SPI_Transmit(&SSD1306_SPI_PORT, buffer, buff_size, HAL_MAX_DELAY);
-    HAL_GPIO_WritePin(SSD1306_CS_Port, SSD1306_CS_Pin, GPIO_PIN_SET); // un-select OLED
+    SSD1306_GRAY_LOCK();
+    SSD1306_WAIT_FOR_TRANSFER();
+    SSD1306_TRACE(SSD1306_Display, 'D', buffer, buff_size);
+    SSD1306_Display->Transport->WriteData(SSD1306_Display, buffer, buff_size);
+    SSD1306_GRAY_UNLOCK();
+    SSD1306_COUNT_TRANSACTION(buff_size);
+}
+
+// Send a byte to the command register
+void ssd1306_WriteCommand(uint8_t byte) {
+    ssd1306_WriteCommands(&byte, 1);
+}
+
+#ifdef SSD1306_USE_DMA
+/*
+ * Start sending data in the background, completion is reported by ssd1306_TxCpltCallback().
+ * When the DMA doesn't start (bus busy or in error) the data is sent blocking and 0 returned.
+ */
+static uint8_t ssd1306_WriteDataDMA(SSD1306_Display_t* display, uint8_t* buffer, size_t buff_size) {
+    SSD1306_TRACE(display, 'B', buffer, buff_size);
+    SSD1306_COUNT_TRANSACTION(buff_size);
+    if (display->Transport->WriteDataDMA(display, buffer, buff_size) == HAL_OK) {
+        return 1;
+    }
+    // Release the bus (SPI: CS) first, the blocking write selects it again
+    if (display->Transport->EndDataDMA != NULL) {
+        display->Transport->EndDataDMA(display);
+    }
+    display->Transport->WriteData(display, buffer, buff_size);
+    return 0;
+}
+
+// Called after the last background data transfer of a frame
+static void ssd1306_EndDataDMA(SSD1306_Display_t* display) {
+    SSD1306_TRACE(display, 'E', NULL, 0);
+    if (display->Transport->EndDataDMA != NULL) {
+        display->Transport->EndDataDMA(display);
+    }
+}
+#endif
+
+void ssd1306_SelectDisplay(SSD1306_Display_t* display) {
+    SSD1306_Display = (display != NULL) ? display : &SSD1306_DefaultDisplay;
+#ifdef SSD1306_USE_GRAYSCALE
+    SSD1306_Plane = SSD1306_Buffer;
+#endif
+    SSD1306_Target = SSD1306_Buffer;
+    SSD1306_TargetPage = 0;
+}
+
+SSD1306_Display_t* ssd1306_GetDisplay(void) {
+    return SSD1306_Display;
 }
 
+// RAM page shown at the top of the screen, moved by ssd1306_ScrollPages()
+#define SSD1306_PageOffset       (SSD1306_Display->PageOffset)
+#define SSD1306_StartLinePending (SSD1306_Display->StartLinePending)
+
+#ifdef SSD1306_USE_DISPLAY_LIST
+// Columns of the last ssd1306_RenderList() per RAM page, its background, 0xFF while the panel shows something else
+#define SSD1306_ListStart       (SSD1306_Display->ListStart)
+#define SSD1306_ListEnd         (SSD1306_Display->ListEnd)
+#define SSD1306_ListBackground  (SSD1306_Display->ListBackground)
+#define SSD1306_Strips          (SSD1306_Display->ListStrips)
+#define SSD1306_LIST_FORGET()   (SSD1306_ListBackground = 0xFF)
 #else
-#error "You should define SSD1306_USE_SPI or SSD1306_USE_I2C macro"
+#define SSD1306_LIST_FORGET()
 #endif
 
+// Screenbuffer page stored in RAM page q and back
+#define SSD1306_BUFFER_PAGE(q) (((q) + SSD1306_PAGES - SSD1306_PageOffset) % SSD1306_PAGES)
+#define SSD1306_RAM_PAGE(p)    (((p) + SSD1306_PageOffset) % SSD1306_PAGES)
+
+/* Send the display start line moved by ssd1306_ScrollPages(), right before the exposed pages */
+static void ssd1306_ApplyStartLine(void) {
+    if (SSD1306_StartLinePending) {
+        ssd1306_WriteCommand(0x40 | (SSD1306_PageOffset * 8)); // Set Display Start Line
+        SSD1306_StartLinePending = 0;
+    }
+}
+
+#ifdef SSD1306_USE_DIRTY_UPDATE
+/*
+ * Per page column ranges, empty when start > end.
+ * Dirty: columns that differ from what the panel shows.
+ * Ink:   columns drawn over the background of the last ssd1306_Fill(),
+ *        i.e. what the next ssd1306_Fill() with the same color has to clear.
+ */
+#define SSD1306_DirtyStart  (SSD1306_Display->DirtyStart)
+#define SSD1306_DirtyEnd    (SSD1306_Display->DirtyEnd)
+#define SSD1306_InkStart    (SSD1306_Display->InkStart)
+#define SSD1306_InkEnd      (SSD1306_Display->InkEnd)
+#define SSD1306_FillColor   (SSD1306_Display->FillColor) // Color of the last ssd1306_Fill(), 0xFF if unknown
+
+/* Mark columns x1..x2 of pages page1..page2 as changed */
+static void ssd1306_MarkDirty(uint8_t x1, uint8_t x2, uint8_t page1, uint8_t page2) {
+    for (uint8_t p = page1; p <= page2; p++) {
+        if (x1 < SSD1306_DirtyStart[p]) SSD1306_DirtyStart[p] = x1;
+        if (x2 > SSD1306_DirtyEnd[p])   SSD1306_DirtyEnd[p] = x2;
+        if (x1 < SSD1306_InkStart[p])   SSD1306_InkStart[p] = x1;
+        if (x2 > SSD1306_InkEnd[p])     SSD1306_InkEnd[p] = x2;
+    }
+}
 
-// Screenbuffer
-static uint8_t SSD1306_Buffer[SSD1306_BUFFER_SIZE];
+/* Forget everything known about the panel contents */
+static void ssd1306_MarkAllDirty(void) {
+    memset(SSD1306_DirtyStart, 0, sizeof(SSD1306_DirtyStart));
+    memset(SSD1306_DirtyEnd, SSD1306_WIDTH - 1, sizeof(SSD1306_DirtyEnd));
+    SSD1306_FillColor = 0xFF; // Next ssd1306_Fill() can't rely on the ink ranges
+}
+#else
+#define ssd1306_MarkDirty(x1, x2, page1, page2)
+#define ssd1306_MarkAllDirty()
+#endif
 
-// Screen object
-static SSD1306_t SSD1306;
+#if defined(SSD1306_USE_DIRTY_UPDATE) || defined(SSD1306_USE_DMA) || defined(SSD1306_USE_DISPLAY_LIST)
+/* Set the area written by the following data bytes (Horizontal Addressing Mode) */
+static void ssd1306_SetWindow(uint8_t x1, uint8_t x2, uint8_t page1, uint8_t page2) {
+    const uint8_t cmd[] = {
+        0x21, // Set Column Address
+        x1 + SSD1306_Display->XOffset,
+        x2 + SSD1306_Display->XOffset,
+        0x22, // Set Page Address
+        page1,
+        page2,
+    };
+    ssd1306_WriteCommands(cmd, sizeof(cmd));
+}
+#endif
 
 /* Fills the Screenbuffer with values from a given buffer of a fixed length */
-SSD1306_Error_t ssd1306_FillBuffer(uint8_t* buf, uint32_t len) {
+SSD1306_Error_t ssd1306_FillBuffer(const uint8_t* buf, uint32_t len) {
     SSD1306_Error_t ret = SSD1306_ERR;
     if (len <= SSD1306_BUFFER_SIZE) {
         memcpy(SSD1306_Buffer,buf,len);
+        ssd1306_MarkAllDirty();
         ret = SSD1306_OK;
     }
     return ret;
 }
 
-/* Initialize the oled screen */
-void ssd1306_Init(void) {
-    // Reset OLED
-    ssd1306_Reset();
-
-    // Wait for the screen to boot
-    HAL_Delay(100);
+#if (SSD1306_HEIGHT != 32) && (SSD1306_HEIGHT != 64) && (SSD1306_HEIGHT != 128)
+#error "Only 32, 64, or 128 lines of height are supported!"
+#endif
 
-    // Init OLED
-    ssd1306_SetDisplayOn(0); //display off
+/* Init sequence, sent by ssd1306_Init() in one transaction followed by the panel height */
+static const uint8_t SSD1306_InitCommands[] = {
+    0xAE, //display off
 
-    ssd1306_WriteCommand(0x20); //Set Memory Addressing Mode
-    ssd1306_WriteCommand(0x00); // 00b,Horizontal Addressing Mode; 01b,Vertical Addressing Mode;
-                                // 10b,Page Addressing Mode (RESET); 11b,Invalid
+    0x20, //Set Memory Addressing Mode
+    0x00, // 00b,Horizontal Addressing Mode; 01b,Vertical Addressing Mode;
+          // 10b,Page Addressing Mode (RESET); 11b,Invalid
 
-    ssd1306_WriteCommand(0xB0); //Set Page Start Address for Page Addressing Mode,0-7
+    0xB0, //Set Page Start Address for Page Addressing Mode,0-7
 
 #ifdef SSD1306_MIRROR_VERT
-    ssd1306_WriteCommand(0xC0); // Mirror vertically
+    0xC0, // Mirror vertically
 #else
-    ssd1306_WriteCommand(0xC8); //Set COM Output Scan Direction
+    0xC8, //Set COM Output Scan Direction
 #endif
 
-    ssd1306_WriteCommand(0x00); //---set low column address
-    ssd1306_WriteCommand(0x10); //---set high column address
+    0x00, //---set low column address
+    0x10, //---set high column address
 
-    ssd1306_WriteCommand(0x40); //--set start line address - CHECK
+    0x2E, //--deactivate scroll
+    0x40, //--set start line address - CHECK
 
-    ssd1306_SetContrast(0xFF);
+    0x81, //--set contrast control register
+    0xFF,
 
 #ifdef SSD1306_MIRROR_HORIZ
-    ssd1306_WriteCommand(0xA0); // Mirror horizontally
+    0xA0, // Mirror horizontally
 #else
-    ssd1306_WriteCommand(0xA1); //--set segment re-map 0 to 127 - CHECK
+    0xA1, //--set segment re-map 0 to 127 - CHECK
 #endif
 
 #ifdef SSD1306_INVERSE_COLOR
-    ssd1306_WriteCommand(0xA7); //--set inverse color
+    0xA7, //--set inverse color
 #else
-    ssd1306_WriteCommand(0xA6); //--set normal color
+    0xA6, //--set normal color
 #endif
 
-// Set multiplex ratio.
-#if (SSD1306_HEIGHT == 128)
-    // Found in the Luma Python lib for SH1106.
-    ssd1306_WriteCommand(0xFF);
-#else
-    ssd1306_WriteCommand(0xA8); //--set multiplex ratio(1 to 64) - CHECK
-#endif
+    0xA4, //0xa4,Output follows RAM content;0xa5,Output ignores RAM content
 
-#if (SSD1306_HEIGHT == 32)
-    ssd1306_WriteCommand(0x1F); //
-#elif (SSD1306_HEIGHT == 64)
-    ssd1306_WriteCommand(0x3F); //
-#elif (SSD1306_HEIGHT == 128)
-    ssd1306_WriteCommand(0x3F); // Seems to work for 128px high displays too.
-#else
-#error "Only 32, 64, or 128 lines of height are supported!"
-#endif
+    0xD3, //-set display offset - CHECK
+    0x00, //-not offset
 
-    ssd1306_WriteCommand(0xA4); //0xa4,Output follows RAM content;0xa5,Output ignores RAM content
+    0xD5, //--set display clock divide ratio/oscillator frequency
+    0xF0, //--set divide ratio
 
-    ssd1306_WriteCommand(0xD3); //-set display offset - CHECK
-    ssd1306_WriteCommand(0x00); //-not offset
+    0xD9, //--set pre-charge period
+    SSD1306_PRECHARGE, //
 
-    ssd1306_WriteCommand(0xD5); //--set display clock divide ratio/oscillator frequency
-    ssd1306_WriteCommand(0xF0); //--set divide ratio
+    0xDB, //--set vcomh
+    0x20, //0x20,0.77xVcc
 
-    ssd1306_WriteCommand(0xD9); //--set pre-charge period
-    ssd1306_WriteCommand(0x22); //
+    0x8D, //--set DC-DC enable
+    0x14, //
+};
 
-    ssd1306_WriteCommand(0xDA); //--set com pins hardware configuration - CHECK
-#if (SSD1306_HEIGHT == 32)
-    ssd1306_WriteCommand(0x02);
-#elif (SSD1306_HEIGHT == 64)
-    ssd1306_WriteCommand(0x12);
-#elif (SSD1306_HEIGHT == 128)
-    ssd1306_WriteCommand(0x12);
-#else
-#error "Only 32, 64, or 128 lines of height are supported!"
+/* Initialize the oled screen */
+void ssd1306_Init(void) {
+    SSD1306_Display_t* display = SSD1306_Displays;
+    while (display != NULL && display != SSD1306_Display) {
+        display = display->Next;
+    }
+    if (display == NULL) {
+        // New display, ssd1306_TxCpltCallback() finds it from now on
+#ifdef SSD1306_USE_DMA
+        SSD1306_TxBusy = 0;
 #endif
+        SSD1306_Display->Next = SSD1306_Displays;
+        SSD1306_Displays = SSD1306_Display;
+    }
+    ssd1306_ResetClipRect();
 
-    ssd1306_WriteCommand(0xDB); //--set vcomh
-    ssd1306_WriteCommand(0x20); //0x20,0.77xVcc
+    // Reset OLED
+    ssd1306_Reset();
 
-    ssd1306_WriteCommand(0x8D); //--set DC-DC enable
-    ssd1306_WriteCommand(0x14); //
-    ssd1306_SetDisplayOn(1); //--turn on SSD1306 panel
+    // Wait for the screen to boot
+    HAL_Delay(100);
 
-    // Clear screen
+    // Init OLED in one transaction
+    const uint8_t height = SSD1306_Display->Height;
+    uint8_t cmd[sizeof(SSD1306_InitCommands) + 5];
+    memcpy(cmd, SSD1306_InitCommands, sizeof(SSD1306_InitCommands));
+    uint8_t* geometry = &cmd[sizeof(SSD1306_InitCommands)];
+    // Set multiplex ratio, 0xFF for 128 lines was found in the Luma Python lib for SH1106
+    geometry[0] = (height == 128) ? 0xFF : 0xA8;
+    geometry[1] = (height == 32) ? 0x1F : 0x3F; // 0x3F seems to work for 128px high displays too
+    geometry[2] = 0xDA; //--set com pins hardware configuration - CHECK
+    geometry[3] = (height == 32) ? 0x02 : 0x12;
+    geometry[4] = 0xAF; //--turn on SSD1306 panel
+    ssd1306_WriteCommands(cmd, sizeof(cmd));
+    SSD1306_PageOffset = 0;
+    SSD1306_StartLinePending = 0;
+    SSD1306.Scrolling = 0;
+    SSD1306.Contrast = 0xFF;
+    SSD1306.DisplayOn = 1;
+
+    // Clear screen. GDDRAM content is undefined after reset.
+    ssd1306_MarkAllDirty();
     ssd1306_Fill(Black);
 
     // Flush buffer to screen
@@ -173,9 +580,94 @@ void ssd1306_Init(void) {
 
 /* Fill the whole screen with the given color */
 void ssd1306_Fill(SSD1306_COLOR color) {
-    memset(SSD1306_Buffer, (color == Black) ? 0x00 : 0xFF, sizeof(SSD1306_Buffer));
+    memset(SSD1306_Plane, (color == Black) ? 0x00 : 0xFF, SSD1306_BUFFER_SIZE);
+
+#ifdef SSD1306_USE_GRAYSCALE
+    if (SSD1306_Plane != SSD1306_Buffer) {
+        // The ink ranges only describe the screenbuffer, keep them for it
+        memset(SSD1306_DirtyStart, 0, sizeof(SSD1306_DirtyStart));
+        memset(SSD1306_DirtyEnd, SSD1306_WIDTH - 1, sizeof(SSD1306_DirtyEnd));
+        return;
+    }
+#endif
+#ifdef SSD1306_USE_DIRTY_UPDATE
+    if (color != SSD1306_FillColor) {
+        ssd1306_MarkAllDirty();
+        SSD1306_FillColor = color;
+    } else {
+        // Only what was drawn over the old background changes
+        for (uint8_t p = 0; p < SSD1306_PAGES; p++) {
+            if (SSD1306_InkStart[p] < SSD1306_DirtyStart[p]) SSD1306_DirtyStart[p] = SSD1306_InkStart[p];
+            if (SSD1306_InkEnd[p] > SSD1306_DirtyEnd[p])     SSD1306_DirtyEnd[p] = SSD1306_InkEnd[p];
+        }
+    }
+    memset(SSD1306_InkStart, 0xFF, sizeof(SSD1306_InkStart));
+    memset(SSD1306_InkEnd, 0, sizeof(SSD1306_InkEnd));
+#endif
 }
 
+#ifdef SSD1306_USE_DIRTY_UPDATE
+/*
+ * Write the changed parts of the screenbuffer to the screen.
+ * Consecutive dirty pages share one address window spanning their column ranges,
+ * a window covering whole pages is sent in a single data transaction.
+ */
+void ssd1306_UpdateScreen(void) {
+    uint8_t ram = 0;
+
+#ifdef SSD1306_USE_GRAYSCALE
+    if (SSD1306_GRAY_ACTIVE()) {
+        ssd1306_GrayPoll();
+        ssd1306_GrayPresent();
+        return;
+    }
+#endif
+    if (SSD1306.Scrolling) {
+        // No RAM access allowed, the changes stay dirty
+        return;
+    }
+    SSD1306_TRACE(SSD1306_Display, 'F', NULL, 0);
+    SSD1306_LIST_FORGET();
+    ssd1306_ApplyStartLine();
+
+    // Walk the RAM pages, they differ from the screenbuffer pages after ssd1306_ScrollPages()
+    while (ram < SSD1306_DisplayPages) {
+        uint8_t page = SSD1306_BUFFER_PAGE(ram);
+        if (SSD1306_DirtyStart[page] > SSD1306_DirtyEnd[page]) {
+            ram++;
+            continue;
+        }
+
+        uint8_t first = ram;
+        uint8_t x1 = SSD1306_DirtyStart[page];
+        uint8_t x2 = SSD1306_DirtyEnd[page];
+        while (ram + 1 < SSD1306_DisplayPages) {
+            page = SSD1306_BUFFER_PAGE(ram + 1);
+            if (SSD1306_DirtyStart[page] > SSD1306_DirtyEnd[page]) {
+                break;
+            }
+            ram++;
+            if (SSD1306_DirtyStart[page] < x1) x1 = SSD1306_DirtyStart[page];
+            if (SSD1306_DirtyEnd[page] > x2)   x2 = SSD1306_DirtyEnd[page];
+        }
+
+        ssd1306_SetWindow(x1, x2, first, ram);
+        page = SSD1306_BUFFER_PAGE(first);
+        if (x1 == 0 && x2 == SSD1306_WIDTH - 1 && page + (ram - first) < SSD1306_PAGES) {
+            // Whole pages that are contiguous in the screenbuffer too
+            ssd1306_WriteData(&SSD1306_Buffer[SSD1306_WIDTH*page], SSD1306_WIDTH*(ram - first + 1));
+        } else {
+            for (uint8_t i = first; i <= ram; i++) {
+                ssd1306_WriteData(&SSD1306_Buffer[SSD1306_WIDTH*SSD1306_BUFFER_PAGE(i) + x1], x2 - x1 + 1);
+            }
+        }
+        ram++;
+    }
+
+    memset(SSD1306_DirtyStart, 0xFF, sizeof(SSD1306_DirtyStart));
+    memset(SSD1306_DirtyEnd, 0, sizeof(SSD1306_DirtyEnd));
+}
+#else
 /* Write the screenbuffer with changed to the screen */
 void ssd1306_UpdateScreen(void) {
     // Write data to each page of RAM. Number of pages
@@ -184,86 +676,839 @@ void ssd1306_UpdateScreen(void) {
     //  * 32px   ==  4 pages
     //  * 64px   ==  8 pages
     //  * 128px  ==  16 pages
-    for(uint8_t i = 0; i < SSD1306_HEIGHT/8; i++) {
-        ssd1306_WriteCommand(0xB0 + i); // Set the current RAM page address.
-        ssd1306_WriteCommand(0x00 + SSD1306_X_OFFSET_LOWER);
-        ssd1306_WriteCommand(0x10 + SSD1306_X_OFFSET_UPPER);
-        ssd1306_WriteData(&SSD1306_Buffer[SSD1306_WIDTH*i],SSD1306_WIDTH);
+    if (SSD1306.Scrolling) {
+        // No RAM access allowed
+        return;
+    }
+    SSD1306_TRACE(SSD1306_Display, 'F', NULL, 0);
+    SSD1306_LIST_FORGET();
+    ssd1306_ApplyStartLine();
+
+    for(uint8_t i = 0; i < SSD1306_DisplayPages; i++) {
+        const uint8_t cmd[] = {
+            0xB0 + i, // Set the current RAM page address.
+            0x00 + (SSD1306_Display->XOffset & 0x0F),
+            0x10 + ((SSD1306_Display->XOffset >> 4) & 0x07),
+        };
+        ssd1306_WriteCommands(cmd, sizeof(cmd));
+        ssd1306_WriteData(&SSD1306_Buffer[SSD1306_WIDTH*SSD1306_BUFFER_PAGE(i)],SSD1306_WIDTH);
     }
 }
+#endif
 
+#ifdef SSD1306_USE_DMA
 /*
- * Draw one pixel in the screenbuffer
- * X => X Coordinate
- * Y => Y Coordinate
- * color => Pixel color
+ * Send the next part of the background transfer of display. Parts the DMA
+ * can't take are sent blocking, the transfer ends here if that was the rest.
  */
-void ssd1306_DrawPixel(uint8_t x, uint8_t y, SSD1306_COLOR color) {
-    if(x >= SSD1306_WIDTH || y >= SSD1306_HEIGHT) {
-        // Don't write outside the buffer
+static void ssd1306_SendNextPageDMA(SSD1306_Display_t* display) {
+    while (display->TxPage <= display->TxLastPage) {
+        uint8_t page = display->TxPage;
+        uint8_t started;
+        if (display->TxX1 == 0 && display->TxX2 == SSD1306_WIDTH - 1) {
+            // Whole pages are contiguous in the buffer
+            display->TxPage = display->TxLastPage + 1;
+            started = ssd1306_WriteDataDMA(display, &display->TxSource[SSD1306_WIDTH*page], SSD1306_WIDTH*(display->TxLastPage - page + 1));
+        } else {
+            display->TxPage = page + 1;
+            started = ssd1306_WriteDataDMA(display, &display->TxSource[SSD1306_WIDTH*page + display->TxX1], display->TxX2 - display->TxX1 + 1);
+        }
+        if (started) {
+            return;
+        }
+    }
+    ssd1306_EndDataDMA(display);
+    display->TxBusy = 0;
+}
+
+/*
+ * Start writing the screenbuffer to the screen in the background.
+ * The changed area is copied to the front buffer, so drawing of the next
+ * frame can begin as soon as this returns.
+ */
+void ssd1306_UpdateScreenAsync(void) {
+    uint8_t x1 = 0;
+    uint8_t x2 = SSD1306_WIDTH - 1;
+    uint8_t first = 0;
+    uint8_t last = SSD1306_DisplayPages - 1;
+
+#ifdef SSD1306_USE_GRAYSCALE
+    if (SSD1306_GRAY_ACTIVE()) {
+        ssd1306_GrayPoll();
+        ssd1306_GrayPresent();
         return;
     }
+#endif
+    // The front buffer is still in use until the previous frame is out
+    ssd1306_WaitForTransfer();
 
-    // Draw in the right color
-    if(color == White) {
-        SSD1306_Buffer[x + (y / 8) * SSD1306_WIDTH] |= 1 << (y % 8);
-    } else {
-        SSD1306_Buffer[x + (y / 8) * SSD1306_WIDTH] &= ~(1 << (y % 8));
+    if (SSD1306.Scrolling) {
+        // No RAM access allowed, the changes stay dirty
+        return;
+    }
+    SSD1306_TRACE(SSD1306_Display, 'F', NULL, 0);
+    SSD1306_LIST_FORGET();
+    ssd1306_ApplyStartLine();
+
+#ifdef SSD1306_USE_DIRTY_UPDATE
+    // One window around all dirty RAM pages, the transfer can't stop to send commands
+    x1 = SSD1306_WIDTH - 1;
+    x2 = 0;
+    first = SSD1306_PAGES;
+    for (uint8_t ram = 0; ram < SSD1306_DisplayPages; ram++) {
+        const uint8_t p = SSD1306_BUFFER_PAGE(ram);
+        if (SSD1306_DirtyStart[p] > SSD1306_DirtyEnd[p]) {
+            continue;
+        }
+        if (first == SSD1306_PAGES) first = ram;
+        last = ram;
+        if (SSD1306_DirtyStart[p] < x1) x1 = SSD1306_DirtyStart[p];
+        if (SSD1306_DirtyEnd[p] > x2)   x2 = SSD1306_DirtyEnd[p];
+    }
+    memset(SSD1306_DirtyStart, 0xFF, sizeof(SSD1306_DirtyStart));
+    memset(SSD1306_DirtyEnd, 0, sizeof(SSD1306_DirtyEnd));
+    if (first == SSD1306_PAGES) {
+        // Nothing changed
+        return;
+    }
+#endif
+
+    // The front buffer is kept in RAM page order
+    for (uint8_t ram = first; ram <= last; ram++) {
+        memcpy(&SSD1306_FrontBuffer[SSD1306_WIDTH*ram + x1],
+               &SSD1306_Buffer[SSD1306_WIDTH*SSD1306_BUFFER_PAGE(ram) + x1], x2 - x1 + 1);
     }
+
+    ssd1306_SetWindow(x1, x2, first, last);
+
+    SSD1306_TxSource = SSD1306_FrontBuffer;
+    SSD1306_TxX1 = x1;
+    SSD1306_TxX2 = x2;
+    SSD1306_TxPage = first;
+    SSD1306_TxLastPage = last;
+    SSD1306_TxBusy = 1;
+    ssd1306_SendNextPageDMA(SSD1306_Display);
 }
 
 /*
- * Draw 1 char to the screen buffer
- * ch       => char om weg te schrijven
- * Font     => Font waarmee we gaan schrijven
- * color    => Black or White
+ * Continue or finish the background transfer on the bus, call from the HAL
+ * transfer complete callback. A bus carries one transfer at a time.
  */
-char ssd1306_WriteChar(char ch, SSD1306_Font_t Font, SSD1306_COLOR color) {
-    uint32_t i, b, j;
-
-    // Check if character is valid
-    if (ch < 32 || ch > 126)
-        return 0;
+void ssd1306_TxCpltCallback(const void* bus) {
+    SSD1306_Display_t* display = SSD1306_Displays;
+    while (display != NULL && (display->Bus != bus || !display->TxBusy)) {
+        display = display->Next;
+    }
+    if (display == NULL) {
+        return;
+    }
 
-    // Check remaining space on current line
-    if (SSD1306_WIDTH < (SSD1306.CurrentX + Font.width) ||
-        SSD1306_HEIGHT < (SSD1306.CurrentY + Font.height))
-    {
-        // Not enough space on current line
-        return 0;
+    if (display->TxPage <= display->TxLastPage) {
+        ssd1306_SendNextPageDMA(display);
+    } else {
+        ssd1306_EndDataDMA(display);
+        display->TxBusy = 0;
     }
+}
 
-    // Use the font to write
-    for(i = 0; i < Font.height; i++) {
-        b = Font.data[(ch - 32) * Font.height + i];
-        for(j = 0; j < Font.width; j++) {
-            if((b << j) & 0x8000)  {
-                ssd1306_DrawPixel(SSD1306.CurrentX + j, (SSD1306.CurrentY + i), (SSD1306_COLOR) color);
-            } else {
-                ssd1306_DrawPixel(SSD1306.CurrentX + j, (SSD1306.CurrentY + i), (SSD1306_COLOR)!color);
-            }
+void ssd1306_TxErrorCallback(const void* bus) {
+    for (SSD1306_Display_t* display = SSD1306_Displays; display != NULL; display = display->Next) {
+        if (display->Bus == bus && display->TxBusy) {
+            ssd1306_TxFailed(display);
+            return;
         }
     }
+}
 
-    // The current space is now taken
-    SSD1306.CurrentX += Font.char_width ? Font.char_width[ch - 32] : Font.width;
-
-    // Return written char for validation
-    return ch;
+uint8_t ssd1306_IsTransferBusy(void) {
+    return SSD1306_TxBusy;
 }
 
-/* Write full string to screenbuffer */
-char ssd1306_WriteString(char* str, SSD1306_Font_t Font, SSD1306_COLOR color) {
-    while (*str) {
-        if (ssd1306_WriteChar(*str, Font, color) != *str) {
-            // Char could not be written
-            return *str;
+void ssd1306_WaitForTransfer(void) {
+    const uint32_t start = HAL_GetTick();
+    while (SSD1306_TxBusy) {
+        if (HAL_GetTick() - start >= SSD1306_DMA_TIMEOUT_MS) {
+            ssd1306_TxTimeout(SSD1306_Display);
         }
-        str++;
     }
-
-    // Everything ok
-    return *str;
+}
+#endif
+
+#ifdef SSD1306_USE_GRAYSCALE
+/*
+ * Gray mode: the screenbuffer (high plane) is shown for two subframes and the
+ * low plane for one, so a pixel is lit for (2 * high + low) / 3 of the time.
+ * Between a high and a low subframe only the window where the two planes
+ * differ is sent, between two high subframes nothing is.
+ */
+
+// RAM page window, empty while page1 > page2
+typedef struct {
+    uint8_t x1;
+    uint8_t x2;
+    uint8_t page1;
+    uint8_t page2;
+} SSD1306_GrayWindow_t;
+
+// Low plane being shown, RAM page order like SSD1306_FrontBuffer which holds the high plane
+static uint8_t SSD1306_GrayFront[SSD1306_BUFFER_SIZE];
+static volatile uint8_t SSD1306_GrayTicks;  // ssd1306_GrayTick() calls in the current subframe
+static volatile uint8_t SSD1306_GrayDue;    // Subframe over, ssd1306_GrayPoll() starts the next one
+static uint8_t SSD1306_GraySubframe;        // 0 and 1 show the high plane, 2 the low plane
+static uint8_t SSD1306_GrayShown;           // Plane in the panel RAM inside SSD1306_GrayDiff, 1 = low
+static SSD1306_GrayWindow_t SSD1306_GrayDiff;     // Where the front planes differ
+static SSD1306_GrayWindow_t SSD1306_GrayPending;  // Presented, not yet written to the panel
+
+static void ssd1306_GrayMerge(SSD1306_GrayWindow_t* w, const SSD1306_GrayWindow_t* add) {
+    if (add->page1 > add->page2) {
+        return;
+    }
+    if (w->page1 > w->page2) {
+        *w = *add;
+        return;
+    }
+    if (add->x1 < w->x1) w->x1 = add->x1;
+    if (add->x2 > w->x2) w->x2 = add->x2;
+    if (add->page1 < w->page1) w->page1 = add->page1;
+    if (add->page2 > w->page2) w->page2 = add->page2;
+}
+
+void ssd1306_SetDrawPlane(SSD1306_PLANE plane) {
+    SSD1306_Plane = (plane == SSD1306_PLANE_LOW) ? SSD1306_GrayBuffer : SSD1306_Buffer;
+    SSD1306_Target = SSD1306_Plane;
+}
+
+void ssd1306_GrayBegin(void) {
+    if (SSD1306_GrayOn) {
+        return;
+    }
+    ssd1306_WaitForTransfer();
+
+    // What is on the screen stays white
+    memcpy(SSD1306_GrayBuffer, SSD1306_Buffer, SSD1306_BUFFER_SIZE);
+    ssd1306_MarkAllDirty();
+    SSD1306_GrayDiff.page1 = SSD1306_PAGES;
+    SSD1306_GrayDiff.page2 = 0;
+    SSD1306_GrayPending = SSD1306_GrayDiff;
+    SSD1306_GrayTicks = 0;
+    SSD1306_GrayDue = 0;
+    SSD1306_GraySubframe = 2; // The first subframe is a high one
+    SSD1306_GrayShown = 0;
+    SSD1306_GrayDisplay = SSD1306_Display;
+    SSD1306_GrayOn = 1;
+    ssd1306_GrayPresent();
+}
+
+void ssd1306_GrayEnd(void) {
+    if (!SSD1306_GRAY_ACTIVE()) {
+        return;
+    }
+    SSD1306_GRAY_LOCK();
+    ssd1306_WaitForTransfer();
+    SSD1306_GrayOn = 0;
+    SSD1306_GRAY_UNLOCK();
+
+    ssd1306_SetDrawPlane(SSD1306_PLANE_HIGH);
+    // The panel may hold the low plane or frames not sent yet
+    ssd1306_MarkAllDirty();
+}
+
+/*
+ * Copy the changed parts of both planes to the front planes, the following
+ * subframes send them. Called by ssd1306_UpdateScreen() in gray mode.
+ */
+void ssd1306_GrayPresent(void) {
+    SSD1306_GrayWindow_t dirty = { SSD1306_WIDTH - 1, 0, SSD1306_PAGES, 0 };
+
+    // Keep ssd1306_GrayPoll() away from the front planes
+    SSD1306_GRAY_LOCK();
+    ssd1306_WaitForTransfer();
+    if (SSD1306.Scrolling) {
+        // No RAM access allowed, the changes stay dirty
+        SSD1306_GRAY_UNLOCK();
+        return;
+    }
+    SSD1306_LIST_FORGET();
+    ssd1306_ApplyStartLine();
+
+    for (uint8_t ram = 0; ram < SSD1306_PAGES; ram++) {
+        const uint8_t p = SSD1306_BUFFER_PAGE(ram);
+        if (SSD1306_DirtyStart[p] > SSD1306_DirtyEnd[p]) {
+            continue;
+        }
+        if (dirty.page1 == SSD1306_PAGES) dirty.page1 = ram;
+        dirty.page2 = ram;
+        if (SSD1306_DirtyStart[p] < dirty.x1) dirty.x1 = SSD1306_DirtyStart[p];
+        if (SSD1306_DirtyEnd[p] > dirty.x2)   dirty.x2 = SSD1306_DirtyEnd[p];
+    }
+    memset(SSD1306_DirtyStart, 0xFF, sizeof(SSD1306_DirtyStart));
+    memset(SSD1306_DirtyEnd, 0, sizeof(SSD1306_DirtyEnd));
+    if (dirty.page1 == SSD1306_PAGES) {
+        SSD1306_GRAY_UNLOCK();
+        return;
+    }
+
+    SSD1306_GrayDiff.page1 = SSD1306_PAGES;
+    SSD1306_GrayDiff.page2 = 0;
+    for (uint8_t ram = 0; ram < SSD1306_PAGES; ram++) {
+        const uint32_t offset = SSD1306_WIDTH*SSD1306_BUFFER_PAGE(ram);
+        uint8_t* high = &SSD1306_FrontBuffer[SSD1306_WIDTH*ram];
+        uint8_t* low = &SSD1306_GrayFront[SSD1306_WIDTH*ram];
+        if (ram >= dirty.page1 && ram <= dirty.page2) {
+            memcpy(&high[dirty.x1], &SSD1306_Buffer[offset + dirty.x1], dirty.x2 - dirty.x1 + 1);
+            memcpy(&low[dirty.x1], &SSD1306_GrayBuffer[offset + dirty.x1], dirty.x2 - dirty.x1 + 1);
+        }
+
+        // Columns where the planes differ, the diff can shrink so it is found again
+        int32_t x1 = 0;
+        int32_t x2 = SSD1306_WIDTH - 1;
+        while (x1 < SSD1306_WIDTH && high[x1] == low[x1]) x1++;
+        if (x1 == SSD1306_WIDTH) {
+            continue;
+        }
+        while (high[x2] == low[x2]) x2--;
+        const SSD1306_GrayWindow_t page = { x1, x2, ram, ram };
+        ssd1306_GrayMerge(&SSD1306_GrayDiff, &page);
+    }
+    ssd1306_GrayMerge(&SSD1306_GrayPending, &dirty);
+
+    SSD1306_GRAY_UNLOCK();
+}
+
+/* Start the next subframe on the selected display */
+static void ssd1306_GrayNextSubframe(void) {
+    SSD1306_GrayTicks = 0;
+    SSD1306_GraySubframe = (SSD1306_GraySubframe == 2) ? 0 : SSD1306_GraySubframe + 1;
+
+    const uint8_t plane = (SSD1306_GraySubframe == 2);
+    SSD1306_GrayWindow_t w = SSD1306_GrayPending;
+    if (plane != SSD1306_GrayShown) {
+        ssd1306_GrayMerge(&w, &SSD1306_GrayDiff);
+        SSD1306_GrayShown = plane;
+    }
+    SSD1306_GrayPending.page1 = SSD1306_PAGES;
+    SSD1306_GrayPending.page2 = 0;
+    if (w.page1 > w.page2) {
+        return;
+    }
+
+    SSD1306_TRACE(SSD1306_Display, 'F', NULL, 0);
+    ssd1306_SetWindow(w.x1, w.x2, w.page1, w.page2);
+    SSD1306_TxSource = plane ? SSD1306_GrayFront : SSD1306_FrontBuffer;
+    SSD1306_TxX1 = w.x1;
+    SSD1306_TxX2 = w.x2;
+    SSD1306_TxPage = w.page1;
+    SSD1306_TxLastPage = w.page2;
+    SSD1306_TxBusy = 1;
+    ssd1306_SendNextPageDMA(SSD1306_Display);
+}
+
+/*
+ * Count the subframe time, call from a periodic interrupt (SysTick). After
+ * SSD1306_GRAY_TICKS calls the subframe is over and the switch is queued for
+ * ssd1306_GrayPoll(), the window commands are blocking bus writes.
+ */
+void ssd1306_GrayTick(void) {
+    if (!SSD1306_GrayOn || SSD1306_GrayDue) {
+        return;
+    }
+    if (++SSD1306_GrayTicks >= SSD1306_GRAY_TICKS) {
+        SSD1306_GrayDue = 1;
+    }
+}
+
+/* Start the next subframe once ssd1306_GrayTick() has queued it, call from the main loop */
+void ssd1306_GrayPoll(void) {
+    if (!SSD1306_GrayOn || !SSD1306_GrayDue) {
+        return;
+    }
+    if (SSD1306_GrayLock || ssd1306_BusBusy(SSD1306_GrayDisplay)) {
+        // Try again on the next call, this subframe lasts a bit longer
+        return;
+    }
+
+    // The caller may have another display selected
+    SSD1306_Display_t* selected = SSD1306_Display;
+    SSD1306_Display = SSD1306_GrayDisplay;
+    ssd1306_GrayNextSubframe();
+    SSD1306_Display = selected;
+    SSD1306_GrayDue = 0;
+}
+#endif
+
+/*
+ * Fill the area x1..x2, y1..y2 (inclusive, x1 <= x2, y1 <= y2) of the screenbuffer.
+ * The area is clipped to the clip rectangle, every page is written with one byte
+ * mask per column instead of pixel by pixel.
+ */
+static void ssd1306_FillArea(int32_t x1, int32_t y1, int32_t x2, int32_t y2, SSD1306_COLOR color) {
+    if (x1 < SSD1306.ClipX1) x1 = SSD1306.ClipX1;
+    if (y1 < SSD1306.ClipY1) y1 = SSD1306.ClipY1;
+    if (x2 > SSD1306.ClipX2) x2 = SSD1306.ClipX2;
+    if (y2 > SSD1306.ClipY2) y2 = SSD1306.ClipY2;
+    if (x1 > x2 || y1 > y2) {
+        return;
+    }
+
+    const uint32_t page1 = y1 / 8;
+    const uint32_t page2 = y2 / 8;
+    ssd1306_MarkDirty(x1, x2, page1, page2);
+
+    for (uint32_t page = page1; page <= page2; page++) {
+        uint8_t mask = 0xFF;
+        if (page == page1) mask &= 0xFF << (y1 % 8);
+        if (page == page2) mask &= 0xFF >> (7 - (y2 % 8));
+
+        uint8_t* p = SSD1306_PAGE(page) + x1;
+        uint8_t* end = SSD1306_PAGE(page) + x2;
+        if (color == White) {
+            if (mask == 0xFF) {
+                memset(p, 0xFF, end - p + 1);
+            } else {
+                for (; p <= end; p++) *p |= mask;
+            }
+        } else {
+            if (mask == 0xFF) {
+                memset(p, 0x00, end - p + 1);
+            } else {
+                for (; p <= end; p++) *p &= ~mask;
+            }
+        }
+    }
+}
+
+/*
+ * Apply a raster operation to n bytes of a page, 4 columns per 32 bit word.
+ * pat, if set, holds the pattern bytes of the first 11 columns and is ANDed
+ * into the source.
+ */
+static void ssd1306_RopRow(uint8_t* dst, const uint8_t* lo, const uint8_t* hi, const uint8_t* pat,
+                           uint32_t n, uint32_t shift, uint8_t rows, SSD1306_ROP rop) {
+    // f(d, s) = (d & fd) ^ (s & fs) ^ (d & s & fds), the coefficients are the bits of rop
+    const uint32_t fd = (rop & 0x01) ? 0xFFFFFFFF : 0;
+    const uint32_t fs = (rop & 0x02) ? 0xFFFFFFFF : 0;
+    const uint32_t fds = (rop & 0x04) ? 0xFFFFFFFF : 0;
+    // Same byte mask in every lane of a word
+    const uint32_t lanes = 0x01010101;
+    const uint32_t keep = rows * lanes;
+    const uint32_t low = (uint8_t)(0xFF << shift) * lanes; // bits a shifted lower source byte lands on
+    const int solid = (lo == NULL && hi == NULL);
+    uint32_t c = 0;
+
+    for (; c + 4 <= n; c += 4) {
+        uint32_t s = 0xFFFFFFFF;
+        uint32_t d, v;
+        if (!solid) {
+            s = 0;
+            if (lo) { memcpy(&v, lo + c, 4); s |= (v << shift) & low; }
+            if (hi) { memcpy(&v, hi + c, 4); s |= (v >> (8 - shift)) & ~low; }
+        }
+        if (pat) { memcpy(&v, pat + (c & 7), 4); s &= v; }
+        memcpy(&d, dst + c, 4);
+        const uint32_t f = (d & fd) ^ (s & fs) ^ (d & s & fds);
+        d = (d & ~keep) | (f & keep);
+        memcpy(dst + c, &d, 4);
+    }
+    for (; c < n; c++) {
+        uint8_t s = 0xFF;
+        if (!solid) {
+            s = 0;
+            if (lo) s |= lo[c] << shift;
+            if (hi) s |= hi[c] >> (8 - shift);
+        }
+        if (pat) s &= pat[c & 7];
+        const uint8_t d = dst[c];
+        const uint8_t f = (d & fd) ^ (s & fs) ^ (d & s & fds);
+        dst[c] = (d & ~rows) | (f & rows);
+    }
+}
+
+/*
+ * ssd1306_BitBlt() with the source ANDed with an 8x8 pattern (see ssd1306.h)
+ * anchored to the screen, so neighbouring fills line up. NULL pattern = solid.
+ */
+static void ssd1306_PatternBlt(int32_t x, int32_t y, const uint8_t* src, int32_t w, int32_t h,
+                               const uint8_t* pattern, SSD1306_ROP rop) {
+    const int32_t x1 = (x < SSD1306.ClipX1) ? SSD1306.ClipX1 : x;
+    const int32_t y1 = (y < SSD1306.ClipY1) ? SSD1306.ClipY1 : y;
+    const int32_t x2 = (x + w - 1 > SSD1306.ClipX2) ? SSD1306.ClipX2 : x + w - 1;
+    const int32_t y2 = (y + h - 1 > SSD1306.ClipY2) ? SSD1306.ClipY2 : y + h - 1;
+    if (x1 > x2 || y1 > y2) {
+        return;
+    }
+
+    // Floor division, y may be negative. Source page k lands shifted in pages page0 + k and page0 + k + 1.
+    const int32_t page0 = (y >= 0) ? y / 8 : -((7 - y) / 8);
+    const uint32_t shift = y - page0 * 8;
+    const int32_t pages = (h + 7) / 8;
+    ssd1306_MarkDirty(x1, x2, y1 / 8, y2 / 8);
+
+    // Pattern bytes from column x1 on, long enough for a word load at any c & 7
+    uint8_t pat[12];
+    if (pattern) {
+        for (uint32_t i = 0; i < sizeof(pat); i++) {
+            pat[i] = pattern[(x1 + i) & 7];
+        }
+    }
+
+    for (int32_t page = y1 / 8; page <= y2 / 8; page++) {
+        // Rows of the page inside the box and the clip rectangle
+        uint8_t rows = 0xFF;
+        if (page == y1 / 8) rows &= 0xFF << (y1 % 8);
+        if (page == y2 / 8) rows &= 0xFF >> (7 - (y2 % 8));
+
+        const int32_t sp = page - page0;
+        const uint8_t* lo = NULL;
+        const uint8_t* hi = NULL;
+        if (src) {
+            lo = (sp < pages) ? &src[sp * w + (x1 - x)] : NULL;
+            hi = (shift != 0 && sp > 0) ? &src[(sp - 1) * w + (x1 - x)] : NULL;
+            if (lo == NULL && hi == NULL) {
+                // Only padding rows of the source reach this page
+                continue;
+            }
+        }
+        ssd1306_RopRow(SSD1306_PAGE(page) + x1, lo, hi, pattern ? pat : NULL, x2 - x1 + 1, shift, rows, rop);
+    }
+}
+
+/* Combine a page layout source with the screenbuffer, see ssd1306.h */
+void ssd1306_BitBlt(int16_t x, int16_t y, const uint8_t* src, uint8_t w, uint8_t h, SSD1306_ROP rop) {
+    ssd1306_PatternBlt(x, y, src, w, h, NULL, rop);
+}
+
+/*
+ * Draw a mask stored in page layout (w columns, one byte per column and page,
+ * bit 0 = top row) with its top left corner at x, y. Set bits are drawn in color,
+ * clear bits are left alone.
+ */
+static void ssd1306_DrawMaskPages(const uint8_t* mask, uint8_t w, uint8_t pages, int32_t x, int32_t y, SSD1306_COLOR color) {
+    ssd1306_BitBlt(x, y, mask, w, pages * 8, (color == White) ? SSD1306_ROP_OR : SSD1306_ROP_ANDNOT);
+}
+
+/* Draw a circle from the precomputed tables, radius must be within SSD1306_CIRCLE_R_MIN..MAX */
+static void ssd1306_DrawCircleTable(const uint8_t* table, uint8_t par_x, uint8_t par_y, uint8_t par_r,
+                                    const uint8_t* pattern, SSD1306_COLOR color) {
+    const uint8_t d = 2 * par_r + 1;
+    ssd1306_PatternBlt((int32_t)par_x - par_r, (int32_t)par_y - par_r,
+                       &table[SSD1306_CircleOffsets[par_r - SSD1306_CIRCLE_R_MIN]], d, d, pattern,
+                       (color == White) ? SSD1306_ROP_OR : SSD1306_ROP_ANDNOT);
+}
+
+/* FillArea with an 8x8 pattern, set pattern bits in color, NULL = solid */
+static void ssd1306_FillAreaPattern(int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                                    const uint8_t* pattern, SSD1306_COLOR color) {
+    if (pattern == NULL) {
+        ssd1306_FillArea(x1, y1, x2, y2, color);
+        return;
+    }
+    ssd1306_PatternBlt(x1, y1, NULL, x2 - x1 + 1, y2 - y1 + 1, pattern,
+                       (color == White) ? SSD1306_ROP_OR : SSD1306_ROP_ANDNOT);
+}
+
+/*
+ * Draw a glyph stored in page layout (see Tools/gen_font_pages.py) at x, y.
+ * The glyph must fit on the screen. Unless transparent, the w x h box is cleared
+ * to the inverse color first, all in one read-modify-write per byte.
+ */
+static void ssd1306_DrawGlyphPages(const uint8_t* glyph, uint8_t w, uint8_t h, uint32_t x, uint32_t y, SSD1306_COLOR color) {
+    const uint32_t pages = (h + 7) / 8;
+    const uint32_t shift = y % 8;
+    const uint32_t page0 = y / 8;
+    const int opaque = !SSD1306.TransparentText;
+
+    ssd1306_MarkDirty(x, x + w - 1, page0, (y + h - 1) / 8);
+
+    for (uint32_t sp = 0; sp < pages; sp++) {
+        const uint8_t* src = &glyph[sp * w];
+        // Rows of the box covered by this source page
+        const uint8_t box = (sp == pages - 1 && (h % 8) != 0) ? (1 << (h % 8)) - 1 : 0xFF;
+        const uint16_t keep = ~((uint16_t)box << shift);
+        uint8_t* dst = SSD1306_PAGE(page0 + sp) + x;
+        // Only write the next page if the shifted box reaches into it
+        const int upper = ((uint16_t)box << shift) > 0xFF;
+
+        for (uint32_t c = 0; c < w; c++) {
+            uint16_t b = src[c];
+            if (opaque) {
+                // Foreground bits in color, the rest of the box in !color
+                if (color == Black) b = ~b & box;
+                b <<= shift;
+                dst[c] = (dst[c] & keep) | b;
+                if (upper) dst[c + SSD1306_WIDTH] = (dst[c + SSD1306_WIDTH] & (keep >> 8)) | (b >> 8);
+            } else if (b != 0) {
+                b <<= shift;
+                if (color == White) {
+                    dst[c] |= b;
+                    if (upper) dst[c + SSD1306_WIDTH] |= b >> 8;
+                } else {
+                    dst[c] &= ~b;
+                    if (upper) dst[c + SSD1306_WIDTH] &= ~(b >> 8);
+                }
+            }
+        }
+    }
+}
+
+/* Column c of a packed glyph, bit 0 = top row of the character cell */
+static uint32_t ssd1306_PackedColumn(const SSD1306_Font_t* Font, const SSD1306_PackedGlyph_t* g, uint32_t c) {
+    if (c < g->x || c >= (uint32_t)g->x + g->w) {
+        return 0;
+    }
+
+    // The box column is h bits at this position of the glyph, LSB first
+    uint32_t pos = (c - g->x) * g->h;
+    const uint8_t* src = &Font->packed[g->offset + pos / 8];
+    pos %= 8;
+    uint32_t bits = 0;
+    for (uint32_t got = 0; got < g->h; got += 8 - pos, pos = 0) {
+        bits |= (uint32_t)(*src++ >> pos) << got;
+    }
+    return (bits & ((1UL << g->h) - 1)) << g->y;
+}
+
+/*
+ * Draw a packed glyph at any position, straight from the font data. Opaque text
+ * covers the whole cell, transparent text only the box columns. Honours the
+ * clip rectangle.
+ */
+static void ssd1306_DrawGlyphPacked(const SSD1306_Font_t* Font, char ch, uint32_t x, uint32_t y, SSD1306_COLOR color) {
+    const SSD1306_PackedGlyph_t* g = &Font->glyphs[ch - 32];
+    const int opaque = !SSD1306.TransparentText;
+    const uint32_t page0 = y / 8;
+
+    // Columns to visit, in the cell and on the screen
+    int32_t c1 = opaque ? 0 : g->x;
+    int32_t c2 = opaque ? Font->width - 1 : g->x + g->w - 1;
+    if ((int32_t)x + c1 < SSD1306.ClipX1) c1 = SSD1306.ClipX1 - x;
+    if ((int32_t)x + c2 > SSD1306.ClipX2) c2 = SSD1306.ClipX2 - x;
+
+    // Rows of the cell inside the clip rectangle, bit 0 = top row of the cell
+    const int32_t lo = (SSD1306.ClipY1 > y) ? SSD1306.ClipY1 - y : 0;
+    const int32_t hi = (SSD1306.ClipY2 < y + Font->height - 1) ? SSD1306.ClipY2 - y : Font->height - 1;
+    if (c1 > c2 || lo > hi) {
+        return;
+    }
+    const uint32_t rows = ((2UL << hi) - 1) & ~((1UL << lo) - 1);
+
+    // Pages holding those rows, counted from page0
+    const uint32_t top = y % 8;
+    const uint32_t p1 = (top + lo) / 8;
+    const uint32_t p2 = (top + hi) / 8;
+
+    ssd1306_MarkDirty(x + c1, x + c2, page0 + p1, page0 + p2);
+
+    // The box columns are read in order, h bits each, from the first one visited
+    const uint32_t skip = (c1 > g->x) ? (c1 - g->x) * g->h : 0;
+    const uint8_t* src = &Font->packed[g->offset + skip / 8];
+    const uint32_t column = (1UL << g->h) - 1;
+    uint64_t acc = 0;
+    uint32_t have = 0;
+    if (skip % 8 && c1 < g->x + g->w) {
+        acc = *src++ >> (skip % 8);
+        have = 8 - skip % 8;
+    }
+
+    for (int32_t c = c1; c <= c2; c++) {
+        uint32_t b = 0;
+        if (c >= g->x && c < g->x + g->w) {
+            while (have < g->h) {
+                acc |= (uint64_t)*src++ << have;
+                have += 8;
+            }
+            b = ((uint32_t)acc & column) << g->y;
+            acc >>= g->h;
+            have -= g->h;
+        }
+        if (opaque && color == Black) {
+            b = ~b;
+        } else if (!opaque && b == 0) {
+            continue;
+        }
+        b &= rows;
+
+        // Only the pages with clipped rows, a display list strip holds no others
+        uint8_t* dst = SSD1306_PAGE(page0 + p1) + x + c;
+        for (uint32_t p = p1; p <= p2; p++, dst += SSD1306_WIDTH) {
+            // Cell rows p * 8 - top and on land in this page
+            const uint8_t bits = p ? b >> (p * 8 - top) : b << top;
+            if (opaque) {
+                const uint8_t mask = p ? rows >> (p * 8 - top) : rows << top;
+                *dst = (*dst & ~mask) | bits;
+            } else if (color == White) {
+                *dst |= bits;
+            } else {
+                *dst &= ~bits;
+            }
+        }
+    }
+}
+
+/*
+ * Draw one pixel in the screenbuffer
+ * X => X Coordinate
+ * Y => Y Coordinate
+ * color => Pixel color
+ */
+void ssd1306_DrawPixel(uint8_t x, uint8_t y, SSD1306_COLOR color) {
+    if(x < SSD1306.ClipX1 || x > SSD1306.ClipX2 || y < SSD1306.ClipY1 || y > SSD1306.ClipY2) {
+        // Don't write outside the buffer or the clip rectangle
+        return;
+    }
+
+    ssd1306_MarkDirty(x, x, y / 8, y / 8);
+
+    // Draw in the right color
+    if(color == White) {
+        SSD1306_PAGE(y / 8)[x] |= 1 << (y % 8);
+    } else {
+        SSD1306_PAGE(y / 8)[x] &= ~(1 << (y % 8));
+    }
+}
+
+/*
+ * Draw 1 char to the screen buffer
+ * ch       => char om weg te schrijven
+ * Font     => Font waarmee we gaan schrijven
+ * color    => Black or White
+ */
+char ssd1306_WriteChar(char ch, SSD1306_Font_t Font, SSD1306_COLOR color) {
+    uint32_t i, b, j;
+
+    // Check if character is valid
+    if (ch < 32 || ch > 126)
+        return 0;
+
+    // Check remaining space on current line
+    if (SSD1306_WIDTH < (SSD1306.CurrentX + Font.width) ||
+        SSD1306_HEIGHT < (SSD1306.CurrentY + Font.height))
+    {
+        // Not enough space on current line
+        return 0;
+    }
+
+    // Use the font to write, glyphs crossing the clip rectangle go pixel by pixel
+    if (Font.glyphs) {
+        ssd1306_DrawGlyphPacked(&Font, ch, SSD1306.CurrentX, SSD1306.CurrentY, color);
+    } else if (Font.page_data && SSD1306.CurrentX >= SSD1306.ClipX1 && SSD1306.CurrentX + Font.width - 1 <= SSD1306.ClipX2 &&
+        SSD1306.CurrentY >= SSD1306.ClipY1 && SSD1306.CurrentY + Font.height - 1 <= SSD1306.ClipY2) {
+        const uint32_t glyph_size = Font.width * ((Font.height + 7) / 8);
+        ssd1306_DrawGlyphPages(&Font.page_data[(ch - 32) * glyph_size], Font.width, Font.height,
+                               SSD1306.CurrentX, SSD1306.CurrentY, color);
+    } else {
+        for(i = 0; i < Font.height; i++) {
+            b = Font.data[(ch - 32) * Font.height + i];
+            for(j = 0; j < Font.width; j++) {
+                if((b << j) & 0x8000)  {
+                    ssd1306_DrawPixel(SSD1306.CurrentX + j, (SSD1306.CurrentY + i), (SSD1306_COLOR) color);
+                } else if (!SSD1306.TransparentText) {
+                    ssd1306_DrawPixel(SSD1306.CurrentX + j, (SSD1306.CurrentY + i), (SSD1306_COLOR)!color);
+                }
+            }
+        }
+    }
+
+    // The current space is now taken
+    SSD1306.CurrentX += Font.char_width ? Font.char_width[ch - 32] : Font.width;
+
+    // Return written char for validation
+    return ch;
+}
+
+/* Write full string to screenbuffer */
+char ssd1306_WriteString(char* str, SSD1306_Font_t Font, SSD1306_COLOR color) {
+    while (*str) {
+        if (ssd1306_WriteChar(*str, Font, color) != *str) {
+            // Char could not be written
+            return *str;
+        }
+        str++;
+    }
+
+    // Everything ok
+    return *str;
+}
+
+/* Write a character enlarged scale times, one blit per glyph column */
+char ssd1306_WriteCharScaled(char ch, SSD1306_Font_t Font, uint8_t scale, SSD1306_COLOR color) {
+    uint32_t i, j, p;
+
+    if (ch < 32 || ch > 126 || scale == 0 || scale > 8)
+        return 0;
+
+    // One expanded column is at most 8 pages, see column and tall below
+    const uint32_t w = Font.width * scale;
+    const uint32_t h = Font.height * scale;
+    if (h > 64 ||
+        SSD1306_WIDTH < (SSD1306.CurrentX + w) ||
+        SSD1306_Display->Height < (SSD1306.CurrentY + h))
+    {
+        return 0;
+    }
+
+    // Opaque text copies the glyph box, transparent text only touches the set pixels
+    SSD1306_ROP rop = SSD1306_ROP_COPY;
+    uint8_t invert = 0x00;
+    if (SSD1306.TransparentText) {
+        rop = (color == White) ? SSD1306_ROP_OR : SSD1306_ROP_ANDNOT;
+    } else if (color == Black) {
+        invert = 0xFF;
+    }
+
+    const uint32_t pages = (h + 7) / 8;
+    const uint32_t glyph_pages = (Font.height + 7) / 8;
+    const uint64_t run = (1U << scale) - 1;
+    uint8_t column[8 * 8]; // scale copies of one expanded column, page by page
+
+    for (j = 0; j < Font.width; j++) {
+        // Glyph column j, bit i = row i
+        uint32_t bits = 0;
+        if (Font.glyphs) {
+            bits = ssd1306_PackedColumn(&Font, &Font.glyphs[ch - 32], j);
+        } else if (Font.page_data) {
+            const uint8_t* glyph = &Font.page_data[(ch - 32) * Font.width * glyph_pages];
+            for (p = 0; p < glyph_pages; p++) {
+                bits |= (uint32_t)glyph[p * Font.width + j] << (p * 8);
+            }
+        } else {
+            for (i = 0; i < Font.height; i++) {
+                if ((Font.data[(ch - 32) * Font.height + i] << j) & 0x8000) {
+                    bits |= 1UL << i;
+                }
+            }
+        }
+
+        // Each row becomes scale rows
+        uint64_t tall = 0;
+        for (i = 0; bits; i++, bits >>= 1) {
+            if (bits & 1) {
+                tall |= run << (i * scale);
+            }
+        }
+        for (p = 0; p < pages; p++) {
+            memset(&column[p * scale], (uint8_t)(tall >> (p * 8)) ^ invert, scale);
+        }
+        ssd1306_BitBlt(SSD1306.CurrentX + j * scale, SSD1306.CurrentY, column, scale, h, rop);
+    }
+
+    // The current space is now taken
+    SSD1306.CurrentX += (Font.char_width ? Font.char_width[ch - 32] : Font.width) * scale;
+
+    return ch;
+}
+
+/* Write full string enlarged scale times */
+char ssd1306_WriteStringScaled(char* str, SSD1306_Font_t Font, uint8_t scale, SSD1306_COLOR color) {
+    while (*str) {
+        if (ssd1306_WriteCharScaled(*str, Font, scale, color) != *str) {
+            // Char could not be written
+            return *str;
+        }
+        str++;
+    }
+
+    // Everything ok
+    return *str;
 }
 
 /* Position the cursor */
@@ -272,31 +1517,119 @@ void ssd1306_SetCursor(uint8_t x, uint8_t y) {
     SSD1306.CurrentY = y;
 }
 
-/* Draw line by Bresenhem's algorithm */
-void ssd1306_Line(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1306_COLOR color) {
-    int32_t deltaX = abs(x2 - x1);
-    int32_t deltaY = abs(y2 - y1);
-    int32_t signX = ((x1 < x2) ? 1 : -1);
-    int32_t signY = ((y1 < y2) ? 1 : -1);
-    int32_t error = deltaX - deltaY;
-    int32_t error2;
+/* Cohen-Sutherland outcode of a point against the clip rectangle */
+static uint8_t ssd1306_OutCode(int32_t x, int32_t y) {
+    uint8_t code = 0;
+    if (x < SSD1306.ClipX1) code |= 0x01;
+    if (x > SSD1306.ClipX2) code |= 0x02;
+    if (y < SSD1306.ClipY1) code |= 0x04;
+    if (y > SSD1306.ClipY2) code |= 0x08;
+    return code;
+}
 
-    ssd1306_DrawPixel(x2, y2, color);
+/*
+ * Draw line by Bresenhem's algorithm, clipped to the clip rectangle.
+ *
+ * Step k along the major axis moves floor((2 * k * minor + major - 1) / (2 * major))
+ * along the minor one, which is what the error term works out to. A clipped
+ * line enters at the first step inside the clip rectangle with exactly that
+ * error, so it draws the same pixels as the unclipped one.
+ */
+void ssd1306_Line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, SSD1306_COLOR color) {
+    // Horizontal and vertical lines are spans
+    if (x1 == x2 || y1 == y2) {
+        ssd1306_FillArea((x1 < x2) ? x1 : x2, (y1 < y2) ? y1 : y2,
+                         (x1 < x2) ? x2 : x1, (y1 < y2) ? y2 : y1, color);
+        return;
+    }
+
+    const uint8_t code1 = ssd1306_OutCode(x1, y1);
+    const uint8_t code2 = ssd1306_OutCode(x2, y2);
+    if (code1 & code2) {
+        // Both ends on the same outer side
+        return;
+    }
 
-    while((x1 != x2) || (y1 != y2)) {
-        ssd1306_DrawPixel(x1, y1, color);
-        error2 = error * 2;
-        if(error2 > -deltaY) {
-            error -= deltaY;
-            x1 += signX;
+    const int32_t deltaX = abs(x2 - x1);
+    const int32_t deltaY = abs(y2 - y1);
+    const int xMajor = (deltaX >= deltaY);
+    const int32_t major = xMajor ? deltaX : deltaY;
+    const int32_t minor = xMajor ? deltaY : deltaX;
+    const int32_t signMajor = xMajor ? ((x1 < x2) ? 1 : -1) : ((y1 < y2) ? 1 : -1);
+    const int32_t signMinor = xMajor ? ((y1 < y2) ? 1 : -1) : ((x1 < x2) ? 1 : -1);
+    const int32_t major0 = xMajor ? x1 : y1;
+    const int32_t minor0 = xMajor ? y1 : x1;
+
+    int32_t k1 = 0;
+    int32_t k2 = major;
+    if (code1 | code2) {
+        const int32_t majorLo = xMajor ? SSD1306.ClipX1 : SSD1306.ClipY1;
+        const int32_t majorHi = xMajor ? SSD1306.ClipX2 : SSD1306.ClipY2;
+        const int32_t minorLo = xMajor ? SSD1306.ClipY1 : SSD1306.ClipX1;
+        const int32_t minorHi = xMajor ? SSD1306.ClipY2 : SSD1306.ClipX2;
+
+        // Steps that keep the major coordinate inside
+        const int32_t majorFrom = (signMajor > 0) ? majorLo - major0 : major0 - majorHi;
+        const int32_t majorTo   = (signMajor > 0) ? majorHi - major0 : major0 - majorLo;
+        if (majorFrom > k1) k1 = majorFrom;
+        if (majorTo < k2)   k2 = majorTo;
+
+        // Steps that keep the minor offset within lo..hi
+        const int32_t lo = (signMinor > 0) ? minorLo - minor0 : minor0 - minorHi;
+        const int32_t hi = (signMinor > 0) ? minorHi - minor0 : minor0 - minorLo;
+        if (hi < 0) {
+            return;
         }
+        if (lo > 0) {
+            const int64_t n = 2 * (int64_t)major * lo - major + 1;
+            const int32_t first = (n + 2 * minor - 1) / (2 * minor);
+            if (first > k1) k1 = first;
+        }
+        const int64_t last = (2 * (int64_t)major * (hi + 1) - major) / (2 * minor);
+        if (last < k2) k2 = last;
 
-        if(error2 < deltaX) {
-            error += deltaX;
-            y1 += signY;
+        if (k1 > k2) {
+            return;
         }
     }
-    return;
+
+    // Minor offset and error of the first step drawn
+    const int32_t wrap = 2 * major;
+    const int64_t error0 = 2 * (int64_t)k1 * minor + major - 1;
+    int32_t offset = error0 / wrap;
+    int32_t error = error0 % wrap;
+
+    // Mark the columns of each page once, when the line leaves it
+    int32_t runX = -1;
+    int32_t runPage = -1;
+    int32_t lastX = 0;
+
+    for (int32_t k = k1; k <= k2; k++) {
+        const int32_t x = xMajor ? major0 + signMajor * k : minor0 + signMinor * offset;
+        const int32_t y = xMajor ? minor0 + signMinor * offset : major0 + signMajor * k;
+
+        if (y / 8 != runPage) {
+            if (runPage >= 0) {
+                ssd1306_MarkDirty((runX < lastX) ? runX : lastX, (runX < lastX) ? lastX : runX, runPage, runPage);
+            }
+            runPage = y / 8;
+            runX = x;
+        }
+        lastX = x;
+
+        if (color == White) {
+            SSD1306_PAGE(y / 8)[x] |= 1 << (y % 8);
+        } else {
+            SSD1306_PAGE(y / 8)[x] &= ~(1 << (y % 8));
+        }
+
+        error += 2 * minor;
+        if (error >= wrap) {
+            error -= wrap;
+            offset++;
+        }
+    }
+    ssd1306_MarkDirty((runX < lastX) ? runX : lastX, (runX < lastX) ? lastX : runX, runPage, runPage);
 }
 
 /* Draw polyline */
@@ -313,9 +1646,40 @@ void ssd1306_Polyline(const SSD1306_VERTEX *par_vertex, uint16_t par_size, SSD13
     return;
 }
 
-/* Convert Degrees to Radians */
-static float ssd1306_DegToRad(float par_deg) {
-    return par_deg * (3.14f / 180.0f);
+/*
+ * Sine of angle (1/SSD1306_ANGLE_STEPS degree) times SSD1306_SINE_ONE, from the
+ * quarter wave table with linear interpolation, no radians or floats involved
+ */
+static int32_t ssd1306_Sin(uint32_t angle) {
+    angle %= 360 * SSD1306_ANGLE_STEPS;
+    const uint32_t quadrant = angle / (90 * SSD1306_ANGLE_STEPS);
+    uint32_t a = angle % (90 * SSD1306_ANGLE_STEPS);
+    if (quadrant & 1) {
+        a = 90 * SSD1306_ANGLE_STEPS - a;
+    }
+
+    // Linear interpolation between whole degrees
+    const uint32_t i = a / SSD1306_ANGLE_STEPS;
+    const uint32_t f = a % SSD1306_ANGLE_STEPS;
+    int32_t s = SSD1306_Sine[i];
+    if (f != 0) {
+        s += ((int32_t)SSD1306_Sine[i + 1] - s) * (int32_t)f / SSD1306_ANGLE_STEPS;
+    }
+    return (quadrant & 2) ? -s : s;
+}
+
+/* Point at radius and angle from x, y, angle 0 points down */
+static void ssd1306_ArcPoint(uint8_t x, uint8_t y, uint8_t radius, uint32_t angle, int16_t* px, int16_t* py) {
+    *px = x + ssd1306_Sin(angle) * radius / SSD1306_SINE_ONE;
+    *py = y + ssd1306_Sin(angle + 90 * SSD1306_ANGLE_STEPS) * radius / SSD1306_SINE_ONE;
+}
+
+/* Angle of segment count out of segments spread over sweep degrees */
+static uint32_t ssd1306_SegmentAngle(uint32_t count, uint32_t sweep, uint32_t segments) {
+    if (segments == 0) {
+        return 0;
+    }
+    return count * sweep * SSD1306_ANGLE_STEPS / segments;
 }
 
 /* Normalize degree to [0;360] */
@@ -337,32 +1701,21 @@ static uint16_t ssd1306_NormalizeTo0_360(uint16_t par_deg) {
  */
 void ssd1306_DrawArc(uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep, SSD1306_COLOR color) {
     static const uint8_t CIRCLE_APPROXIMATION_SEGMENTS = 36;
-    float approx_degree;
     uint32_t approx_segments;
-    uint8_t xp1,xp2;
-    uint8_t yp1,yp2;
+    int16_t xp1,xp2;
+    int16_t yp1,yp2;
     uint32_t count;
     uint32_t loc_sweep;
-    float rad;
 
     loc_sweep = ssd1306_NormalizeTo0_360(sweep);
 
     count = (ssd1306_NormalizeTo0_360(start_angle) * CIRCLE_APPROXIMATION_SEGMENTS) / 360;
     approx_segments = (loc_sweep * CIRCLE_APPROXIMATION_SEGMENTS) / 360;
-    approx_degree = loc_sweep / (float)approx_segments;
     while(count < approx_segments)
     {
-        rad = ssd1306_DegToRad(count*approx_degree);
-        xp1 = x + (int8_t)(sinf(rad)*radius);
-        yp1 = y + (int8_t)(cosf(rad)*radius);
+        ssd1306_ArcPoint(x, y, radius, ssd1306_SegmentAngle(count, loc_sweep, approx_segments), &xp1, &yp1);
         count++;
-        if(count != approx_segments) {
-            rad = ssd1306_DegToRad(count*approx_degree);
-        } else {
-            rad = ssd1306_DegToRad(loc_sweep);
-        }
-        xp2 = x + (int8_t)(sinf(rad)*radius);
-        yp2 = y + (int8_t)(cosf(rad)*radius);
+        ssd1306_ArcPoint(x, y, radius, ssd1306_SegmentAngle(count, loc_sweep, approx_segments), &xp2, &yp2);
         ssd1306_Line(xp1,yp1,xp2,yp2,color);
     }
 
@@ -377,37 +1730,26 @@ void ssd1306_DrawArc(uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle,
  */
 void ssd1306_DrawArcWithRadiusLine(uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep, SSD1306_COLOR color) {
     const uint32_t CIRCLE_APPROXIMATION_SEGMENTS = 36;
-    float approx_degree;
     uint32_t approx_segments;
-    uint8_t xp1;
-    uint8_t xp2 = 0;
-    uint8_t yp1;
-    uint8_t yp2 = 0;
+    int16_t xp1;
+    int16_t xp2 = 0;
+    int16_t yp1;
+    int16_t yp2 = 0;
+    int16_t first_point_x;
+    int16_t first_point_y;
     uint32_t count;
     uint32_t loc_sweep;
-    float rad;
 
     loc_sweep = ssd1306_NormalizeTo0_360(sweep);
 
     count = (ssd1306_NormalizeTo0_360(start_angle) * CIRCLE_APPROXIMATION_SEGMENTS) / 360;
     approx_segments = (loc_sweep * CIRCLE_APPROXIMATION_SEGMENTS) / 360;
-    approx_degree = loc_sweep / (float)approx_segments;
 
-    rad = ssd1306_DegToRad(count*approx_degree);
-    uint8_t first_point_x = x + (int8_t)(sinf(rad)*radius);
-    uint8_t first_point_y = y + (int8_t)(cosf(rad)*radius);
+    ssd1306_ArcPoint(x, y, radius, ssd1306_SegmentAngle(count, loc_sweep, approx_segments), &first_point_x, &first_point_y);
     while (count < approx_segments) {
-        rad = ssd1306_DegToRad(count*approx_degree);
-        xp1 = x + (int8_t)(sinf(rad)*radius);
-        yp1 = y + (int8_t)(cosf(rad)*radius);
+        ssd1306_ArcPoint(x, y, radius, ssd1306_SegmentAngle(count, loc_sweep, approx_segments), &xp1, &yp1);
         count++;
-        if (count != approx_segments) {
-            rad = ssd1306_DegToRad(count*approx_degree);
-        } else {
-            rad = ssd1306_DegToRad(loc_sweep);
-        }
-        xp2 = x + (int8_t)(sinf(rad)*radius);
-        yp2 = y + (int8_t)(cosf(rad)*radius);
+        ssd1306_ArcPoint(x, y, radius, ssd1306_SegmentAngle(count, loc_sweep, approx_segments), &xp2, &yp2);
         ssd1306_Line(xp1,yp1,xp2,yp2,color);
     }
 
@@ -428,6 +1770,11 @@ void ssd1306_DrawCircle(uint8_t par_x,uint8_t par_y,uint8_t par_r,SSD1306_COLOR
         return;
     }
 
+    if (par_r >= SSD1306_CIRCLE_R_MIN && par_r <= SSD1306_CIRCLE_R_MAX) {
+        ssd1306_DrawCircleTable(SSD1306_OutlineCircles, par_x, par_y, par_r, NULL, par_color);
+        return;
+    }
+
     do {
         ssd1306_DrawPixel(par_x - x, par_y + y, par_color);
         ssd1306_DrawPixel(par_x + x, par_y + y, par_color);
@@ -452,23 +1799,31 @@ void ssd1306_DrawCircle(uint8_t par_x,uint8_t par_y,uint8_t par_r,SSD1306_COLOR
     return;
 }
 
-/* Draw filled circle. Pixel positions calculated using Bresenham's algorithm */
-void ssd1306_FillCircle(uint8_t par_x,uint8_t par_y,uint8_t par_r,SSD1306_COLOR par_color) {
+/*
+ * Draw filled circle. Pixel positions calculated using Bresenham's algorithm,
+ * every column of the circle is filled as one vertical span.
+ */
+static void ssd1306_FillCircleArea(uint8_t par_x, uint8_t par_y, uint8_t par_r, const uint8_t* pattern, SSD1306_COLOR par_color) {
     int32_t x = -par_r;
     int32_t y = 0;
     int32_t err = 2 - 2 * par_r;
     int32_t e2;
+    int32_t span_x;
+    int32_t span_y;
+
+    if (par_x >= SSD1306_WIDTH || par_y >= SSD1306_HEIGHT) {
+        return;
+    }
 
-    if (par_x >= SSD1306_WIDTH || par_y >= SSD1306_HEIGHT) {
+    if (par_r >= SSD1306_CIRCLE_R_MIN && par_r <= SSD1306_CIRCLE_R_MAX) {
+        ssd1306_DrawCircleTable(SSD1306_FilledCircles, par_x, par_y, par_r, pattern, par_color);
         return;
     }
 
     do {
-        for (uint8_t _y = (par_y + y); _y >= (par_y - y); _y--) {
-            for (uint8_t _x = (par_x - x); _x >= (par_x + x); _x--) {
-                ssd1306_DrawPixel(_x, _y, par_color);
-            }
-        }
+        // y only grows, so a column's span is complete once x moves on
+        span_x = x;
+        span_y = y;
 
         e2 = err;
         if (e2 <= y) {
@@ -483,17 +1838,39 @@ void ssd1306_FillCircle(uint8_t par_x,uint8_t par_y,uint8_t par_r,SSD1306_COLOR
             x++;
             err = err + (x * 2 + 1);
         }
+
+        if (x != span_x) {
+            ssd1306_FillAreaPattern(par_x + span_x, par_y - span_y, par_x + span_x, par_y + span_y, pattern, par_color);
+            if (span_x != 0) {
+                ssd1306_FillAreaPattern(par_x - span_x, par_y - span_y, par_x - span_x, par_y + span_y, pattern, par_color);
+            }
+        }
     } while (x <= 0);
 
     return;
 }
 
+void ssd1306_FillCircle(uint8_t par_x,uint8_t par_y,uint8_t par_r,SSD1306_COLOR par_color) {
+    ssd1306_FillCircleArea(par_x, par_y, par_r, NULL, par_color);
+}
+
+/* Draw a filled circle shaded with an 8x8 pattern */
+void ssd1306_FillCirclePattern(uint8_t x, uint8_t y, uint8_t r, const uint8_t* pattern, SSD1306_COLOR color) {
+    ssd1306_FillCircleArea(x, y, r, pattern, color);
+}
+
 /* Draw a rectangle */
 void ssd1306_DrawRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1306_COLOR color) {
-    ssd1306_Line(x1,y1,x2,y1,color);
-    ssd1306_Line(x2,y1,x2,y2,color);
-    ssd1306_Line(x2,y2,x1,y2,color);
-    ssd1306_Line(x1,y2,x1,y1,color);
+    const uint8_t x_start = ((x1<=x2) ? x1 : x2);
+    const uint8_t x_end   = ((x1<=x2) ? x2 : x1);
+    const uint8_t y_start = ((y1<=y2) ? y1 : y2);
+    const uint8_t y_end   = ((y1<=y2) ? y2 : y1);
+
+    // Four spans, the same as the horizontal and vertical line paths
+    ssd1306_FillArea(x_start, y_start, x_end, y_start, color);
+    ssd1306_FillArea(x_start, y_end, x_end, y_end, color);
+    ssd1306_FillArea(x_start, y_start, x_start, y_end, color);
+    ssd1306_FillArea(x_end, y_start, x_end, y_end, color);
 
     return;
 }
@@ -505,12 +1882,43 @@ void ssd1306_FillRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD13
     uint8_t y_start = ((y1<=y2) ? y1 : y2);
     uint8_t y_end   = ((y1<=y2) ? y2 : y1);
 
-    for (uint8_t y= y_start; (y<= y_end)&&(y<SSD1306_HEIGHT); y++) {
-        for (uint8_t x= x_start; (x<= x_end)&&(x<SSD1306_WIDTH); x++) {
-            ssd1306_DrawPixel(x, y, color);
+    ssd1306_FillArea(x_start, y_start, x_end, y_end, color);
+    return;
+}
+
+/* Draw a rectangle shaded with an 8x8 pattern, same cost as a solid fill */
+void ssd1306_FillRectanglePattern(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, const uint8_t* pattern, SSD1306_COLOR color) {
+    const uint8_t x_start = ((x1<=x2) ? x1 : x2);
+    const uint8_t x_end   = ((x1<=x2) ? x2 : x1);
+    const uint8_t y_start = ((y1<=y2) ? y1 : y2);
+    const uint8_t y_end   = ((y1<=y2) ? y2 : y1);
+
+    ssd1306_FillAreaPattern(x_start, y_start, x_end, y_end, pattern, color);
+}
+
+/* Ordered dither matrix, a pixel is lit at gray levels above its threshold */
+static const uint8_t SSD1306_Bayer[8][8] = {
+    {  0, 32,  8, 40,  2, 34, 10, 42 },
+    { 48, 16, 56, 24, 50, 18, 58, 26 },
+    { 12, 44,  4, 36, 14, 46,  6, 38 },
+    { 60, 28, 52, 20, 62, 30, 54, 22 },
+    {  3, 35, 11, 43,  1, 33,  9, 41 },
+    { 51, 19, 59, 27, 49, 17, 57, 25 },
+    { 15, 47,  7, 39, 13, 45,  5, 37 },
+    { 63, 31, 55, 23, 61, 29, 53, 21 },
+};
+
+/* Build the 8x8 Bayer pattern for a gray level, see ssd1306.h */
+void ssd1306_BayerPattern(uint8_t level, uint8_t* pattern) {
+    for (uint32_t x = 0; x < 8; x++) {
+        uint8_t b = 0;
+        for (uint32_t y = 0; y < 8; y++) {
+            if (SSD1306_Bayer[y][x] < level) {
+                b |= 1 << y;
+            }
         }
+        pattern[x] = b;
     }
-    return;
 }
 
 SSD1306_Error_t ssd1306_InvertRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2) {
@@ -520,26 +1928,8 @@ SSD1306_Error_t ssd1306_InvertRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint
   if ((x1 > x2) || (y1 > y2)) {
     return SSD1306_ERR;
   }
-  uint32_t i;
-  if ((y1 / 8) != (y2 / 8)) {
-    /* if rectangle doesn't lie on one 8px row */
-    for (uint32_t x = x1; x <= x2; x++) {
-      i = x + (y1 / 8) * SSD1306_WIDTH;
-      SSD1306_Buffer[i] ^= 0xFF << (y1 % 8);
-      i += SSD1306_WIDTH;
-      for (; i < x + (y2 / 8) * SSD1306_WIDTH; i += SSD1306_WIDTH) {
-        SSD1306_Buffer[i] ^= 0xFF;
-      }
-      SSD1306_Buffer[i] ^= 0xFF >> (7 - (y2 % 8));
-    }
-  } else {
-    /* if rectangle lies on one 8px row */
-    const uint8_t mask = (0xFF << (y1 % 8)) & (0xFF >> (7 - (y2 % 8)));
-    for (i = x1 + (y1 / 8) * SSD1306_WIDTH;
-         i <= (uint32_t)x2 + (y2 / 8) * SSD1306_WIDTH; i++) {
-      SSD1306_Buffer[i] ^= mask;
-    }
-  }
+  /* XOR with solid ones, only the part inside the clip rectangle is inverted */
+  ssd1306_BitBlt(x1, y1, NULL, x2 - x1 + 1, y2 - y1 + 1, SSD1306_ROP_XOR);
   return SSD1306_OK;
 }
 
@@ -568,10 +1958,653 @@ void ssd1306_DrawBitmap(uint8_t x, uint8_t y, const unsigned char* bitmap, uint8
     return;
 }
 
+/* Draw a bitmap in page layout, set bits in color, clear bits are left alone */
+void ssd1306_DrawBitmapPages(uint8_t x, uint8_t y, const uint8_t* bitmap, uint8_t w, uint8_t h, SSD1306_COLOR color) {
+    if (x >= SSD1306_WIDTH || y >= SSD1306_HEIGHT) {
+        return;
+    }
+    ssd1306_DrawMaskPages(bitmap, w, (h + 7) / 8, x, y, color);
+}
+
+/* Copy a bitmap in page layout over the screenbuffer, set bits White, clear bits Black */
+void ssd1306_BlitBitmapPages(uint8_t x, uint8_t y, const uint8_t* bitmap, uint8_t w, uint8_t h) {
+    if (x >= SSD1306_WIDTH || y >= SSD1306_HEIGHT) {
+        return;
+    }
+
+    if (y % 8 != 0 || x < SSD1306.ClipX1 || x + w - 1 > SSD1306.ClipX2 ||
+        y < SSD1306.ClipY1 || y + h - 1 > SSD1306.ClipY2) {
+        // Not page aligned, every byte straddles two pages, or partly clipped
+        ssd1306_BitBlt(x, y, bitmap, w, h, SSD1306_ROP_COPY);
+        return;
+    }
+
+    const uint32_t page1 = y / 8;
+    const uint32_t cols = (x + w > SSD1306_WIDTH) ? SSD1306_WIDTH - x : w;
+    uint32_t pages = (h + 7) / 8;
+    if (page1 + pages > SSD1306_PAGES) {
+        pages = SSD1306_PAGES - page1;
+        h = pages * 8;
+    }
+    ssd1306_MarkDirty(x, x + cols - 1, page1, page1 + pages - 1);
+
+    // Whole pages, a full width image is a single copy
+    const uint32_t full = h / 8;
+    if (x == 0 && cols == SSD1306_WIDTH && w == SSD1306_WIDTH) {
+        memcpy(SSD1306_PAGE(page1), bitmap, full * SSD1306_WIDTH);
+    } else {
+        for (uint32_t p = 0; p < full; p++) {
+            memcpy(SSD1306_PAGE(page1 + p) + x, &bitmap[p * w], cols);
+        }
+    }
+
+    // Partial last page, keep the rows below the image
+    if (full < pages) {
+        const uint8_t mask = (1 << (h % 8)) - 1;
+        uint8_t* dst = SSD1306_PAGE(page1 + full) + x;
+        const uint8_t* src = &bitmap[full * w];
+        for (uint32_t c = 0; c < cols; c++) {
+            dst[c] = (dst[c] & ~mask) | (src[c] & mask);
+        }
+    }
+}
+
+/*
+ * Apply one animation delta (see Tools/gen_animation.py) to the screenbuffer,
+ * advances *delta past it. Returns the mask of the pages that changed.
+ */
+static uint16_t ssd1306_ApplyDelta(const uint8_t** delta) {
+    const uint8_t* src = *delta;
+    uint32_t pos = 0;
+    uint16_t changed = 0;
+    uint8_t token;
+
+    while ((token = *src++) != 0x00) {
+        if (token < 0x80) {
+            // Unchanged bytes
+            pos += token;
+            continue;
+        }
+
+        const uint32_t end = pos + token - 0x7F;
+        if (end > SSD1306_BUFFER_SIZE) {
+            // Not made for this screen size
+            break;
+        }
+        memcpy(&SSD1306_Buffer[pos], src, end - pos);
+        src += end - pos;
+
+        // The run may wrap into the next page
+        while (pos < end) {
+            const uint32_t page = pos / SSD1306_WIDTH;
+            const uint32_t stop = ((page + 1) * SSD1306_WIDTH < end) ? (page + 1) * SSD1306_WIDTH : end;
+            ssd1306_MarkDirty(pos % SSD1306_WIDTH, (stop - 1) % SSD1306_WIDTH, page, page);
+            changed |= 1 << page;
+            pos = stop;
+        }
+    }
+
+    *delta = src;
+    return changed;
+}
+
+void ssd1306_AnimationStart(SSD1306_AnimPlayer_t* player, const SSD1306_Animation_t* anim) {
+    player->anim = anim;
+    player->offset = 0;
+    player->restart = 0;
+    player->frame = 0;
+    ssd1306_Fill(Black);
+}
+
+uint16_t ssd1306_AnimationNextFrame(SSD1306_AnimPlayer_t* player) {
+    const SSD1306_Animation_t* anim = player->anim;
+    const uint32_t offset = player->offset;
+    const uint8_t* delta = &anim->data[offset];
+    const uint16_t changed = ssd1306_ApplyDelta(&delta);
+
+    if (offset == anim->loop) {
+        // Back at the first frame
+        player->offset = player->restart;
+    } else {
+        player->offset = delta - anim->data;
+        if (offset == 0) {
+            player->restart = player->offset;
+        }
+    }
+    player->frame++;
+
+    return changed;
+}
+
+void ssd1306_SaveLayer(uint32_t* layer) {
+    memcpy(layer, SSD1306_Plane, SSD1306_BUFFER_SIZE);
+}
+
+void ssd1306_ComposeLayers(const uint32_t* background, const uint32_t* foreground, const uint32_t* mask) {
+    const uint32_t words = SSD1306_WIDTH / 4; // per page
+    uint8_t* dst = SSD1306_Plane;
+
+    for (uint32_t page = 0; page < SSD1306_PAGES; page++) {
+        int32_t first = -1;
+        int32_t last = -1;
+        for (uint32_t i = page * words; i < (page + 1) * words; i++) {
+            uint32_t w = background[i];
+            if (mask) w &= ~mask[i];
+            if (foreground) w |= foreground[i];
+            // The plane is bytes, memcpy keeps the word access legal and compiles to one load or store
+            uint32_t old;
+            memcpy(&old, &dst[i * 4], 4);
+            if (w != old) {
+                memcpy(&dst[i * 4], &w, 4);
+                if (first < 0) first = i;
+                last = i;
+            }
+        }
+        if (first >= 0) {
+            ssd1306_MarkDirty((first - page * words) * 4, (last - page * words) * 4 + 3, page, page);
+        }
+    }
+}
+
+SSD1306_Error_t ssd1306_OverlayBegin(SSD1306_Overlay_t* overlay, uint8_t* save, uint16_t size,
+                                     uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2) {
+    if (x2 >= SSD1306_WIDTH)  x2 = SSD1306_WIDTH - 1;
+    if (y2 >= SSD1306_HEIGHT) y2 = SSD1306_HEIGHT - 1;
+    if (x1 > x2 || y1 > y2 || size < SSD1306_OVERLAY_SIZE(x1, y1, x2, y2)) {
+        return SSD1306_ERR;
+    }
+
+    overlay->save = save;
+    overlay->plane = SSD1306_Plane;
+    overlay->x1 = x1;
+    overlay->x2 = x2;
+    overlay->page1 = y1 / 8;
+    overlay->page2 = y2 / 8;
+    overlay->clipX1 = SSD1306.ClipX1;
+    overlay->clipY1 = SSD1306.ClipY1;
+    overlay->clipX2 = SSD1306.ClipX2;
+    overlay->clipY2 = SSD1306.ClipY2;
+    overlay->open = 1;
+
+    const uint8_t w = x2 - x1 + 1;
+    for (uint8_t page = overlay->page1; page <= overlay->page2; page++) {
+        memcpy(save, &overlay->plane[page * SSD1306_WIDTH + x1], w);
+        save += w;
+    }
+
+    ssd1306_SetClipRect(x1, y1, x2, y2);
+    return SSD1306_OK;
+}
+
+void ssd1306_OverlayEnd(SSD1306_Overlay_t* overlay) {
+    if (!overlay->open) {
+        return;
+    }
+
+    const uint8_t w = overlay->x2 - overlay->x1 + 1;
+    const uint8_t* save = overlay->save;
+    for (uint8_t page = overlay->page1; page <= overlay->page2; page++) {
+        memcpy(&overlay->plane[page * SSD1306_WIDTH + overlay->x1], save, w);
+        save += w;
+    }
+    ssd1306_MarkDirty(overlay->x1, overlay->x2, overlay->page1, overlay->page2);
+
+    ssd1306_SetClipRect(overlay->clipX1, overlay->clipY1, overlay->clipX2, overlay->clipY2);
+    overlay->open = 0;
+}
+
+void ssd1306_SpriteInit(SSD1306_Sprite_t* sprite, const uint8_t* mask, uint8_t w, uint8_t h, SSD1306_COLOR color) {
+    sprite->mask = mask;
+    sprite->w = w;
+    sprite->h = h;
+    sprite->x = 0;
+    sprite->y = 0;
+    sprite->color = color;
+    sprite->visible = 1;
+    sprite->dim = 0;
+    sprite->drawn = 0;
+}
+
+void ssd1306_SpriteSetImage(SSD1306_Sprite_t* sprite, const uint8_t* mask, uint8_t w, uint8_t h) {
+    sprite->mask = mask;
+    sprite->w = w;
+    sprite->h = h;
+}
+
+void ssd1306_SpriteMove(SSD1306_Sprite_t* sprite, int16_t x, int16_t y) {
+    sprite->x = x;
+    sprite->y = y;
+}
+
+/* Draw a sprite mask, in gray mode into the high plane and unless dim the low plane too */
+static void ssd1306_DrawSpriteMask(const uint8_t* mask, uint8_t w, uint8_t h, int16_t x, int16_t y, SSD1306_COLOR color, uint8_t dim) {
+#ifdef SSD1306_USE_GRAYSCALE
+    if (SSD1306_GRAY_ACTIVE()) {
+        SSD1306_Target = SSD1306_Buffer;
+        ssd1306_DrawMaskPages(mask, w, (h + 7) / 8, x, y, color);
+        SSD1306_Target = SSD1306_GrayBuffer;
+        ssd1306_DrawMaskPages(mask, w, (h + 7) / 8, x, y, dim ? (SSD1306_COLOR)!color : color);
+        SSD1306_Target = SSD1306_Plane;
+        return;
+    }
+#endif
+    (void)dim;
+    ssd1306_DrawMaskPages(mask, w, (h + 7) / 8, x, y, color);
+}
+
+/* Whether the boxes x1, y1, w1 x h1 and x2, y2, w2 x h2 share a pixel */
+static int ssd1306_BoxesOverlap(int32_t x1, int32_t y1, uint8_t w1, uint8_t h1, int32_t x2, int32_t y2, uint8_t w2, uint8_t h2) {
+    return x1 < x2 + w2 && x2 < x1 + w1 && y1 < y2 + h2 && y2 < y1 + h1;
+}
+
+/* Whether the visible sprite b overlaps sprite a where a is going to be drawn or was erased */
+static int ssd1306_SpritesOverlap(const SSD1306_Sprite_t* a, const SSD1306_Sprite_t* b) {
+    if (!b->visible) {
+        return 0;
+    }
+    if (a->visible && ssd1306_BoxesOverlap(a->x, a->y, a->w, a->h, b->x, b->y, b->w, b->h)) {
+        return 1;
+    }
+    return a->drawn && ssd1306_BoxesOverlap(a->drawnX, a->drawnY, a->drawnW, a->drawnH, b->x, b->y, b->w, b->h);
+}
+
+void ssd1306_UpdateSprites(SSD1306_Sprite_t* sprites, uint8_t count, SSD1306_COLOR background) {
+    for (uint8_t i = 0; i < count; i++) {
+        SSD1306_Sprite_t* s = &sprites[i];
+        s->redraw = s->drawn != s->visible ||
+                    (s->drawn && (s->drawnX != s->x || s->drawnY != s->y || s->drawnMask != s->mask ||
+                                  s->drawnW != s->w || s->drawnH != s->h));
+    }
+
+    // Sprites overlapping a redrawn one are redrawn too, until nothing is added
+    uint8_t added = 1;
+    while (added) {
+        added = 0;
+        for (uint8_t i = 0; i < count; i++) {
+            if (sprites[i].redraw) {
+                continue;
+            }
+            for (uint8_t j = 0; j < count; j++) {
+                if (sprites[j].redraw && ssd1306_SpritesOverlap(&sprites[j], &sprites[i])) {
+                    sprites[i].redraw = 1;
+                    added = 1;
+                    break;
+                }
+            }
+        }
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        SSD1306_Sprite_t* s = &sprites[i];
+        if (s->redraw && s->drawn) {
+            ssd1306_DrawSpriteMask(s->drawnMask, s->drawnW, s->drawnH, s->drawnX, s->drawnY, background, 0);
+            s->drawn = 0;
+        }
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        SSD1306_Sprite_t* s = &sprites[i];
+        if (s->redraw && s->visible) {
+            ssd1306_DrawSpriteMask(s->mask, s->w, s->h, s->x, s->y, s->color, s->dim);
+            s->drawnMask = s->mask;
+            s->drawnX = s->x;
+            s->drawnY = s->y;
+            s->drawnW = s->w;
+            s->drawnH = s->h;
+            s->drawn = 1;
+        }
+    }
+}
+
+void ssd1306_ForgetSprites(SSD1306_Sprite_t* sprites, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        sprites[i].drawn = 0;
+    }
+}
+
+#ifdef SSD1306_USE_DISPLAY_LIST
+void ssd1306_ListBegin(SSD1306_DrawList_t* list, SSD1306_DrawItem_t* items, uint16_t capacity, SSD1306_COLOR background) {
+    list->items = items;
+    list->capacity = capacity;
+    list->count = 0;
+    list->background = background;
+}
+
+/* Append an item inside columns x1..x2 and rows y1..y2, NULL if the list is full */
+static SSD1306_DrawItem_t* ssd1306_ListAdd(SSD1306_DrawList_t* list, uint8_t type, SSD1306_COLOR color,
+                                           int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    if (list->count >= list->capacity) {
+        return NULL;
+    }
+    SSD1306_DrawItem_t* item = &list->items[list->count++];
+    item->type = type;
+    item->color = color;
+    if (x2 < 0 || x1 >= SSD1306_WIDTH || y2 < 0 || y1 >= SSD1306_HEIGHT) {
+        // Off the screen, never drawn
+        item->page1 = 1;
+        item->page2 = 0;
+    } else {
+        item->page1 = (y1 < 0) ? 0 : y1 / 8;
+        item->page2 = (y2 >= SSD1306_HEIGHT) ? SSD1306_PAGES - 1 : y2 / 8;
+        item->col1 = (x1 < 0) ? 0 : x1;
+        item->col2 = (x2 >= SSD1306_WIDTH) ? SSD1306_WIDTH - 1 : x2;
+    }
+    return item;
+}
+
+SSD1306_Error_t ssd1306_ListPixel(SSD1306_DrawList_t* list, uint8_t x, uint8_t y, SSD1306_COLOR color) {
+    SSD1306_DrawItem_t* item = ssd1306_ListAdd(list, SSD1306_ITEM_PIXEL, color, x, y, x, y);
+    if (item == NULL) {
+        return SSD1306_ERR;
+    }
+    item->x1 = x;
+    item->y1 = y;
+    return SSD1306_OK;
+}
+
+SSD1306_Error_t ssd1306_ListLine(SSD1306_DrawList_t* list, int16_t x1, int16_t y1, int16_t x2, int16_t y2, SSD1306_COLOR color) {
+    SSD1306_DrawItem_t* item = ssd1306_ListAdd(list, SSD1306_ITEM_LINE, color, (x1 < x2) ? x1 : x2, (y1 < y2) ? y1 : y2,
+                                               (x1 < x2) ? x2 : x1, (y1 < y2) ? y2 : y1);
+    if (item == NULL) {
+        return SSD1306_ERR;
+    }
+    item->x1 = x1;
+    item->y1 = y1;
+    item->x2 = x2;
+    item->y2 = y2;
+    return SSD1306_OK;
+}
+
+SSD1306_Error_t ssd1306_ListCircle(SSD1306_DrawList_t* list, uint8_t x, uint8_t y, uint8_t r, SSD1306_COLOR color) {
+    SSD1306_DrawItem_t* item = ssd1306_ListAdd(list, SSD1306_ITEM_CIRCLE, color, x - r, y - r, x + r, y + r);
+    if (item == NULL) {
+        return SSD1306_ERR;
+    }
+    item->x1 = x;
+    item->y1 = y;
+    item->x2 = r;
+    return SSD1306_OK;
+}
+
+SSD1306_Error_t ssd1306_ListFillCircle(SSD1306_DrawList_t* list, uint8_t x, uint8_t y, uint8_t r, SSD1306_COLOR color) {
+    SSD1306_DrawItem_t* item = ssd1306_ListAdd(list, SSD1306_ITEM_FILL_CIRCLE, color, x - r, y - r, x + r, y + r);
+    if (item == NULL) {
+        return SSD1306_ERR;
+    }
+    item->x1 = x;
+    item->y1 = y;
+    item->x2 = r;
+    return SSD1306_OK;
+}
+
+SSD1306_Error_t ssd1306_ListFillRectangle(SSD1306_DrawList_t* list, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1306_COLOR color) {
+    SSD1306_DrawItem_t* item = ssd1306_ListAdd(list, SSD1306_ITEM_FILL_RECTANGLE, color, (x1 < x2) ? x1 : x2, (y1 < y2) ? y1 : y2,
+                                               (x1 < x2) ? x2 : x1, (y1 < y2) ? y2 : y1);
+    if (item == NULL) {
+        return SSD1306_ERR;
+    }
+    item->x1 = x1;
+    item->y1 = y1;
+    item->x2 = x2;
+    item->y2 = y2;
+    return SSD1306_OK;
+}
+
+SSD1306_Error_t ssd1306_ListText(SSD1306_DrawList_t* list, uint8_t x, uint8_t y, const char* str, const SSD1306_Font_t* font, SSD1306_COLOR color) {
+    // The string may change until the list is drawn, it can reach the right edge
+    SSD1306_DrawItem_t* item = ssd1306_ListAdd(list, SSD1306_ITEM_TEXT, color, x, y, SSD1306_WIDTH - 1, y + font->height - 1);
+    if (item == NULL) {
+        return SSD1306_ERR;
+    }
+    item->x1 = x;
+    item->y1 = y;
+    item->data = str;
+    item->font = font;
+    return SSD1306_OK;
+}
+
+SSD1306_Error_t ssd1306_ListBitmapPages(SSD1306_DrawList_t* list, uint8_t x, uint8_t y, const uint8_t* bitmap, uint8_t w, uint8_t h, SSD1306_COLOR color) {
+    // Whole source pages are drawn, padding rows included
+    SSD1306_DrawItem_t* item = ssd1306_ListAdd(list, SSD1306_ITEM_BITMAP, color, x, y, x + w - 1, y + (h + 7) / 8 * 8 - 1);
+    if (item == NULL) {
+        return SSD1306_ERR;
+    }
+    item->x1 = x;
+    item->y1 = y;
+    item->x2 = w;
+    item->y2 = h;
+    item->data = bitmap;
+    return SSD1306_OK;
+}
+
+/* Draw an item with the immediate mode function */
+static void ssd1306_DrawItem(const SSD1306_DrawItem_t* item) {
+    switch (item->type) {
+    case SSD1306_ITEM_PIXEL:
+        ssd1306_DrawPixel(item->x1, item->y1, item->color);
+        break;
+    case SSD1306_ITEM_LINE:
+        ssd1306_Line(item->x1, item->y1, item->x2, item->y2, item->color);
+        break;
+    case SSD1306_ITEM_CIRCLE:
+        ssd1306_DrawCircle(item->x1, item->y1, item->x2, item->color);
+        break;
+    case SSD1306_ITEM_FILL_CIRCLE:
+        ssd1306_FillCircle(item->x1, item->y1, item->x2, item->color);
+        break;
+    case SSD1306_ITEM_FILL_RECTANGLE:
+        ssd1306_FillRectangle(item->x1, item->y1, item->x2, item->y2, item->color);
+        break;
+    case SSD1306_ITEM_TEXT:
+        ssd1306_SetCursor(item->x1, item->y1);
+        ssd1306_WriteString((char*)item->data, *item->font, item->color);
+        break;
+    case SSD1306_ITEM_BITMAP:
+        ssd1306_DrawBitmapPages(item->x1, item->y1, item->data, item->x2, item->y2, item->color);
+        break;
+    }
+}
+
+/* Send columns x1..x2 of one finished strip */
+static void ssd1306_SendStrip(uint8_t* strip, uint8_t x1, uint8_t x2) {
+#ifdef SSD1306_USE_DMA
+    // The previous strip has to be out, the window continues where it stopped
+    SSD1306_WAIT_FOR_TRANSFER();
+    SSD1306_TxPage = 1;
+    SSD1306_TxLastPage = 0; // Nothing follows, the callback ends the transfer
+    SSD1306_TxBusy = 1;
+    if (!ssd1306_WriteDataDMA(SSD1306_Display, &strip[x1], x2 - x1 + 1)) {
+        ssd1306_EndDataDMA(SSD1306_Display);
+        SSD1306_TxBusy = 0;
+    }
+#else
+    ssd1306_WriteData(&strip[x1], x2 - x1 + 1);
+#endif
+}
+
+void ssd1306_RenderList(const SSD1306_DrawList_t* list) {
+    const uint8_t clipY1 = SSD1306.ClipY1;
+    const uint8_t clipY2 = SSD1306.ClipY2;
+
+    uint8_t start[SSD1306_PAGES];
+    uint8_t end[SSD1306_PAGES];
+    uint8_t sendStart[SSD1306_PAGES];
+    uint8_t sendEnd[SSD1306_PAGES];
+    uint8_t sending = 0;
+
+    SSD1306_WAIT_FOR_TRANSFER();
+    if (SSD1306.Scrolling) {
+        // No RAM access allowed
+        return;
+    }
+
+    // Columns the items touch per RAM page, the screen page in each one moves with ssd1306_ScrollPages()
+    memset(start, 0xFF, sizeof(start));
+    memset(end, 0, sizeof(end));
+    for (uint16_t i = 0; i < list->count; i++) {
+        const SSD1306_DrawItem_t* item = &list->items[i];
+        for (uint8_t page = item->page1; page <= item->page2; page++) {
+            const uint8_t ram = SSD1306_RAM_PAGE(page);
+            if (item->col1 < start[ram]) start[ram] = item->col1;
+            if (item->col2 > end[ram])   end[ram] = item->col2;
+        }
+    }
+
+    // Over the last list on the same background only the columns either list draws change
+    const uint8_t full = (SSD1306_ListBackground != list->background);
+    for (uint8_t ram = 0; ram < SSD1306_DisplayPages; ram++) {
+        if (full) {
+            sendStart[ram] = 0;
+            sendEnd[ram] = SSD1306_WIDTH - 1;
+        } else {
+            sendStart[ram] = (start[ram] < SSD1306_ListStart[ram]) ? start[ram] : SSD1306_ListStart[ram];
+            sendEnd[ram] = (end[ram] > SSD1306_ListEnd[ram]) ? end[ram] : SSD1306_ListEnd[ram];
+        }
+        sending |= (sendStart[ram] <= sendEnd[ram]);
+    }
+    memcpy(SSD1306_ListStart, start, sizeof(start));
+    memcpy(SSD1306_ListEnd, end, sizeof(end));
+    SSD1306_ListBackground = list->background;
+    if (!sending) {
+        return;
+    }
+
+    SSD1306_TRACE(SSD1306_Display, 'F', NULL, 0);
+    ssd1306_ApplyStartLine();
+    if (full) {
+        ssd1306_SetWindow(0, SSD1306_WIDTH - 1, 0, SSD1306_DisplayPages - 1);
+    }
+
+    // Strips go round by the ones sent, not by page: the strip before the
+    // last one has been sent once ssd1306_SendStrip() started the last one
+    uint8_t sent = 0;
+    for (uint8_t ram = 0; ram < SSD1306_DisplayPages; ram++) {
+        if (sendStart[ram] > sendEnd[ram]) {
+            continue;
+        }
+        const uint8_t page = SSD1306_BUFFER_PAGE(ram);
+        uint8_t* strip = SSD1306_Strips[sent++ % SSD1306_LIST_STRIPS];
+        memset(strip, (list->background == Black) ? 0x00 : 0xFF, SSD1306_WIDTH);
+
+        // Draw into the strip, clipped to the rows of this page
+        SSD1306_Target = strip;
+        SSD1306_TargetPage = page;
+        SSD1306.ClipY1 = (clipY1 > page * 8) ? clipY1 : page * 8;
+        SSD1306.ClipY2 = (clipY2 < page * 8 + 7) ? clipY2 : page * 8 + 7;
+        if (SSD1306.ClipY1 <= SSD1306.ClipY2) {
+            for (uint16_t i = 0; i < list->count; i++) {
+                const SSD1306_DrawItem_t* item = &list->items[i];
+                if (page >= item->page1 && page <= item->page2) {
+                    ssd1306_DrawItem(item);
+                }
+            }
+        }
+
+        if (!full) {
+            // Waits for the previous strip
+            ssd1306_SetWindow(sendStart[ram], sendEnd[ram], ram, ram);
+        }
+        ssd1306_SendStrip(strip, sendStart[ram], sendEnd[ram]);
+    }
+
+    SSD1306_Target = SSD1306_Plane;
+    SSD1306_TargetPage = 0;
+    SSD1306.ClipY1 = clipY1;
+    SSD1306.ClipY2 = clipY2;
+
+#ifdef SSD1306_USE_DIRTY_UPDATE
+    // The panel no longer shows the screenbuffer where the strips went
+    for (uint8_t ram = 0; ram < SSD1306_DisplayPages; ram++) {
+        const uint8_t page = SSD1306_BUFFER_PAGE(ram);
+        if (sendStart[ram] < SSD1306_DirtyStart[page]) SSD1306_DirtyStart[page] = sendStart[ram];
+        if (sendEnd[ram] > SSD1306_DirtyEnd[page])     SSD1306_DirtyEnd[page] = sendEnd[ram];
+    }
+#endif
+}
+#endif
+
 void ssd1306_SetContrast(const uint8_t value) {
     const uint8_t kSetContrastControlRegister = 0x81;
-    ssd1306_WriteCommand(kSetContrastControlRegister);
-    ssd1306_WriteCommand(value);
+    const uint8_t cmd[] = { kSetContrastControlRegister, value };
+    ssd1306_WriteCommands(cmd, sizeof(cmd));
+    SSD1306.Contrast = value;
+}
+
+/*
+ * Contrast fade. The ramp is linear in sqrt(contrast), so it spends more of
+ * its time in the low values than a linear one. Every step is one contrast
+ * command (2 bytes), sent only when the value changes.
+ */
+static uint8_t SSD1306_FadeActive;
+static uint8_t SSD1306_FadeOff;        // Display off at the end
+static uint8_t SSD1306_FadeFrom;       // Ramp ends in sqrt space, 0..255
+static uint8_t SSD1306_FadeTarget;
+static uint32_t SSD1306_FadeStart;
+static uint32_t SSD1306_FadeDuration;
+
+/* Integer square root of v <= 65025 */
+static uint8_t ssd1306_Sqrt(uint32_t v) {
+    uint32_t r = 0;
+    for (uint32_t bit = 0x80; bit != 0; bit >>= 1) {
+        if ((r | bit) * (r | bit) <= v) {
+            r |= bit;
+        }
+    }
+    return r;
+}
+
+/* Short pre-charge phases, the panel gets darker than contrast 0 alone */
+static void ssd1306_SetPrecharge(uint8_t value) {
+    const uint8_t cmd[] = { 0xD9, value };
+    ssd1306_WriteCommands(cmd, sizeof(cmd));
+}
+
+void ssd1306_FadeTo(uint8_t contrast, uint32_t duration, uint8_t off) {
+    if (!SSD1306.DisplayOn) {
+        // Start from black: darkest settings first, then the display on
+        ssd1306_SetPrecharge(SSD1306_PRECHARGE_DIM);
+        ssd1306_SetContrast(0);
+        ssd1306_SetDisplayOn(1);
+    }
+    SSD1306_FadeFrom = ssd1306_Sqrt(SSD1306.Contrast * 255);
+    SSD1306_FadeTarget = ssd1306_Sqrt(contrast * 255);
+    SSD1306_FadeOff = off;
+    SSD1306_FadeStart = HAL_GetTick();
+    SSD1306_FadeDuration = duration;
+    SSD1306_FadeActive = 1;
+    ssd1306_FadeUpdate();
+}
+
+uint8_t ssd1306_FadeUpdate(void) {
+    if (!SSD1306_FadeActive) {
+        return 0;
+    }
+
+    const uint32_t elapsed = HAL_GetTick() - SSD1306_FadeStart;
+    int32_t a = SSD1306_FadeTarget;
+    if (elapsed < SSD1306_FadeDuration) {
+        a = SSD1306_FadeFrom + ((int32_t)SSD1306_FadeTarget - SSD1306_FadeFrom) * (int32_t)elapsed / (int32_t)SSD1306_FadeDuration;
+    }
+    const uint8_t contrast = (a * a + 127) / 255;
+    if (contrast != SSD1306.Contrast) {
+        if (SSD1306.Contrast == 0) {
+            // Leaving the bottom of the ramp, back to the normal pre-charge
+            ssd1306_SetPrecharge(SSD1306_PRECHARGE);
+        }
+        ssd1306_SetContrast(contrast);
+    }
+    if (a != SSD1306_FadeTarget) {
+        return 1;
+    }
+
+    SSD1306_FadeActive = 0;
+    if (SSD1306_FadeOff) {
+        if (contrast == 0) {
+            ssd1306_SetPrecharge(SSD1306_PRECHARGE_DIM);
+        }
+        ssd1306_SetDisplayOn(0);
+    }
+    return 0;
 }
 
 void ssd1306_SetDisplayOn(const uint8_t on) {
@@ -589,3 +2622,153 @@ void ssd1306_SetDisplayOn(const uint8_t on) {
 uint8_t ssd1306_GetDisplayOn() {
     return SSD1306.DisplayOn;
 }
+
+void ssd1306_SetTransparentText(const uint8_t on) {
+    SSD1306.TransparentText = on ? 1 : 0;
+}
+
+void ssd1306_SetClipRect(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2) {
+    if (x2 >= SSD1306_WIDTH)  x2 = SSD1306_WIDTH - 1;
+    if (y2 >= SSD1306_Display->Height) y2 = SSD1306_Display->Height - 1;
+    SSD1306.ClipX1 = x1;
+    SSD1306.ClipY1 = y1;
+    SSD1306.ClipX2 = x2;
+    SSD1306.ClipY2 = y2;
+}
+
+void ssd1306_ResetClipRect(void) {
+    ssd1306_SetClipRect(0, 0, SSD1306_WIDTH - 1, SSD1306_Display->Height - 1);
+}
+
+#ifdef SSD1306_USE_DIRTY_UPDATE
+/* Move per page state along with the screenbuffer, exposed pages get value */
+static void ssd1306_ShiftPageState(uint8_t* state, int8_t pages, uint8_t value) {
+    const uint8_t n = abs(pages);
+    if (pages > 0) {
+        memmove(state, &state[n], SSD1306_PAGES - n);
+        memset(&state[SSD1306_PAGES - n], value, n);
+    } else {
+        memmove(&state[n], state, SSD1306_PAGES - n);
+        memset(state, value, n);
+    }
+}
+#endif
+
+SSD1306_Error_t ssd1306_ScrollPages(int8_t pages) {
+#if (SSD1306_HEIGHT != 64)
+    // The start line wraps at 64 rows, other heights would show stale RAM
+    return SSD1306_ERR;
+#else
+    if (pages == 0 || pages <= -SSD1306_PAGES || pages >= SSD1306_PAGES || SSD1306.Scrolling ||
+        SSD1306_Display->Height != SSD1306_HEIGHT) {
+        return SSD1306_ERR;
+    }
+
+    // What stays on screen is already in the RAM, the start line moves it
+    const uint8_t n = abs(pages);
+    if (pages > 0) {
+        memmove(SSD1306_Buffer, &SSD1306_Buffer[SSD1306_WIDTH*n], SSD1306_WIDTH*(SSD1306_PAGES - n));
+        memset(&SSD1306_Buffer[SSD1306_WIDTH*(SSD1306_PAGES - n)], 0x00, SSD1306_WIDTH*n);
+    } else {
+        memmove(&SSD1306_Buffer[SSD1306_WIDTH*n], SSD1306_Buffer, SSD1306_WIDTH*(SSD1306_PAGES - n));
+        memset(SSD1306_Buffer, 0x00, SSD1306_WIDTH*n);
+    }
+
+#ifdef SSD1306_USE_DIRTY_UPDATE
+    // Exposed pages still hold what scrolled out, they are cleared to Black
+    ssd1306_ShiftPageState(SSD1306_DirtyStart, pages, 0);
+    ssd1306_ShiftPageState(SSD1306_DirtyEnd, pages, SSD1306_WIDTH - 1);
+    ssd1306_ShiftPageState(SSD1306_InkStart, pages, (SSD1306_FillColor == Black) ? 0xFF : 0);
+    ssd1306_ShiftPageState(SSD1306_InkEnd, pages, (SSD1306_FillColor == Black) ? 0 : SSD1306_WIDTH - 1);
+#endif
+
+    // Sent by the next screen update, so the exposed pages are drawn by then
+    SSD1306_PageOffset = (SSD1306_PageOffset + SSD1306_PAGES + pages) % SSD1306_PAGES;
+    SSD1306_StartLinePending = 1;
+    return SSD1306_OK;
+#endif
+}
+
+SSD1306_Error_t ssd1306_StartScroll(SSD1306_SCROLL_DIR dir, uint8_t page1, uint8_t page2, uint8_t interval) {
+    const uint8_t ram1 = SSD1306_RAM_PAGE(page1);
+    const uint8_t ram2 = SSD1306_RAM_PAGE(page2);
+    if (page1 > page2 || page2 >= SSD1306_DisplayPages || ram1 > ram2 || interval > 7) {
+        // The controller can't scroll a range that wraps around the RAM
+        return SSD1306_ERR;
+    }
+
+    ssd1306_WriteCommand(0x2E); // Deactivate scroll before changing the setup
+    ssd1306_ApplyStartLine();
+    const uint8_t cmd[] = {
+        dir,        // Right/Left Horizontal Scroll
+        0x00,       // Dummy byte
+        ram1,       // Start page address
+        interval,
+        ram2,       // End page address
+        0x00,       // Dummy bytes
+        0xFF,
+        0x2F,       // Activate scroll
+    };
+    ssd1306_WriteCommands(cmd, sizeof(cmd));
+    SSD1306.Scrolling = 1;
+    return SSD1306_OK;
+}
+
+void ssd1306_StopScroll(void) {
+    ssd1306_WriteCommand(0x2E); // Deactivate scroll
+    SSD1306.Scrolling = 0;
+    // The scrolled RAM no longer matches the screenbuffer
+    ssd1306_MarkAllDirty();
+    SSD1306_LIST_FORGET();
+}
+
+#ifdef SSD1306_USE_BUS_STATS
+SSD1306_BusStats_t ssd1306_GetBusStats(void) {
+    return SSD1306_BusStats;
+}
+
+void ssd1306_ResetBusStats(void) {
+    SSD1306_BusStats.Bytes = 0;
+    SSD1306_BusStats.Transactions = 0;
+}
+#endif
+
+#ifdef SSD1306_USE_BUS_TRACE
+#ifdef SSD1306_TRACE_UART
+extern UART_HandleTypeDef SSD1306_TRACE_UART;
+#endif
+
+// Blocking, to the UART of SSD1306_TRACE_UART or else to ITM port 0 (SWO)
+static void ssd1306_TraceOut(const char* text, uint16_t len) {
+#ifdef SSD1306_TRACE_UART
+    HAL_UART_Transmit(&SSD1306_TRACE_UART, (uint8_t*)text, len, HAL_MAX_DELAY);
+#else
+    for (uint16_t i = 0; i < len; i++) {
+        ITM_SendChar(text[i]);
+    }
+#endif
+}
+
+/*
+ * One trace line per transaction, the kind and the bytes in hex as
+ * Tools/ssd1306_emu.py reads them: "C 21 00 7F". Long writes go out in
+ * pieces of one line. An application defining ssd1306_BusTrace() replaces it.
+ */
+__weak void ssd1306_BusTrace(const SSD1306_Display_t* display, char kind, const uint8_t* buffer, size_t buff_size) {
+    static const char hex[] = "0123456789ABCDEF";
+    char line[1 + 3 * 32 + 1];
+    uint16_t len = 0;
+    line[len++] = kind;
+    for (size_t i = 0; i < buff_size; i++) {
+        if (len + 3 > sizeof(line) - 1) {
+            ssd1306_TraceOut(line, len);
+            len = 0;
+        }
+        line[len++] = ' ';
+        line[len++] = hex[buffer[i] >> 4];
+        line[len++] = hex[buffer[i] & 0x0F];
+    }
+    line[len++] = '\n';
+    ssd1306_TraceOut(line, len);
+}
+#endif
@@ -1,6 +1,9 @@
 
 #include "ssd1306_fonts.h"
 
+// Rows and pages, Core/Src/ssd1306_fonts_packed.c replaces them
+#ifndef SSD1306_USE_PACKED_FONTS
+
 #ifdef SSD1306_INCLUDE_FONT_7x10
 static const uint16_t Font7x10 [] = {
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // sp
@@ -895,21 +898,26 @@ static const uint8_t char_width[] = {
 #endif
 
 #ifdef SSD1306_INCLUDE_FONT_6x8
-const SSD1306_Font_t Font_6x8 = {6, 8, Font6x8, NULL};
+extern const uint8_t Font6x8_pages[];
+const SSD1306_Font_t Font_6x8 = {6, 8, Font6x8, NULL, Font6x8_pages};
 #endif
 #ifdef SSD1306_INCLUDE_FONT_7x10
-const SSD1306_Font_t Font_7x10 = {7, 10, Font7x10, NULL};
+extern const uint8_t Font7x10_pages[];
+const SSD1306_Font_t Font_7x10 = {7, 10, Font7x10, NULL, Font7x10_pages};
 #endif
 #ifdef SSD1306_INCLUDE_FONT_11x18
-const SSD1306_Font_t Font_11x18 = {11, 18, Font11x18, NULL};
+extern const uint8_t Font11x18_pages[];
+const SSD1306_Font_t Font_11x18 = {11, 18, Font11x18, NULL, Font11x18_pages};
 #endif
 #ifdef SSD1306_INCLUDE_FONT_16x26
-const SSD1306_Font_t Font_16x26 = {16, 26, Font16x26, NULL};
+extern const uint8_t Font16x26_pages[];
+const SSD1306_Font_t Font_16x26 = {16, 26, Font16x26, NULL, Font16x26_pages};
 #endif
 
 /* see ./examples/custom-fonts/ */
 #ifdef SSD1306_INCLUDE_FONT_16x24
-const SSD1306_Font_t Font_16x24 = {16, 24, Font16x24, NULL};
+extern const uint8_t Font16x24_pages[];
+const SSD1306_Font_t Font_16x24 = {16, 24, Font16x24, NULL, Font16x24_pages};
 #endif
 
 #ifdef SSD1306_INCLUDE_FONT_16x15
@@ -917,5 +925,8 @@ const SSD1306_Font_t Font_16x24 = {16, 24, Font16x24, NULL};
  * @copyright Google https://github.com/googlefonts/roboto
  * @license This font is licensed under the Apache License, Version 2.0.
 */
-const SSD1306_Font_t Font_16x15 = {16, 15, Font16x15, char_width};
+extern const uint8_t Font16x15_pages[];
+const SSD1306_Font_t Font_16x15 = {16, 15, Font16x15, char_width, Font16x15_pages};
 #endif
+
+#endif // SSD1306_USE_PACKED_FONTS
@@ -0,0 +1,2029 @@
+/*
+ * Generated by Tools/gen_font_packed.py, do not edit.
+ * Fonts of ssd1306_fonts.c packed to the bounding box of each glyph.
+ */
+
+#include "ssd1306_fonts.h"
+
+#ifdef SSD1306_USE_PACKED_FONTS
+
+#ifdef SSD1306_INCLUDE_FONT_6x8
+static const uint8_t Font6x8_packed[] = {
+// '!'
+0x5F,
+// '"'
+0xC7, 0x01,
+// '#'
+0x94, 0x3F, 0xE5, 0x4F, 0x01,
+// '$'
+0x24, 0xD5, 0x5F, 0x25, 0x01,
+// '%'
+0xA3, 0x09, 0x82, 0x2C, 0x06,
+// '&'
+0xB6, 0xA4, 0x15, 0x04, 0x05,
+// "'"
+0x78, 0x03,
+// '('
+0x1C, 0x51, 0x10,
+// ')'
+0x41, 0x11, 0x07,
+// '*'
+0x2A, 0xCE, 0x9F, 0xA3, 0x02,
+// '+'
+0x84, 0x7C, 0x42, 0x00,
+// ','
+0x1F,
+// '-'
+0x1F,
+// '.'
+0x0F,
+// '/'
+0x10, 0x11, 0x11, 0x00,
+// '0'
+0xBE, 0x68, 0xB2, 0xE8, 0x03,
+// '1'
+0xC2, 0x3F, 0x10,
+// '2'
+0xF2, 0x64, 0x32, 0x69, 0x04,
+// '3'
+0xA1, 0x60, 0xB2, 0x39, 0x03,
+// '4'
+0x18, 0x8A, 0xE4, 0x0F, 0x01,
+// '5'
+0xA7, 0x62, 0xB1, 0x98, 0x03,
+// '6'
+0x3C, 0x65, 0x32, 0x19, 0x03,
+// '7'
+0xC1, 0x50, 0x24, 0x71, 0x00,
+// '8'
+0xB6, 0x64, 0x32, 0x69, 0x03,
+// '9'
+0xC6, 0x64, 0x32, 0xE5, 0x01,
+// ':'
+0x05,
+// ';'
+0xB0, 0x01,
+// '<'
+0x08, 0x8A, 0x28, 0x08,
+// '='
+0x6D, 0x5B,
+// '>'
+0x41, 0x11, 0x05, 0x01,
+// '?'
+0x82, 0x40, 0x36, 0x61, 0x00,
+// '@'
+0xBE, 0x60, 0x37, 0xEB, 0x04,
+// 'A'
+0x7C, 0x49, 0x44, 0xC2, 0x07,
+// 'B'
+0xFF, 0x64, 0x32, 0x69, 0x03,
+// 'C'
+0xBE, 0x60, 0x30, 0x28, 0x02,
+// 'D'
+0xFF, 0x60, 0x30, 0xE8, 0x03,
+// 'E'
+0xFF, 0x64, 0x32, 0x19, 0x04,
+// 'F'
+0xFF, 0x44, 0x22, 0x11, 0x00,
+// 'G'
+0xBE, 0x60, 0x30, 0x3A, 0x07,
+// 'H'
+0x7F, 0x04, 0x02, 0xF1, 0x07,
+// 'I'
+0xC1, 0x7F, 0x10,
+// 'J'
+0x20, 0x60, 0xF0, 0x17, 0x00,
+// 'K'
+0x7F, 0x04, 0x45, 0x14, 0x04,
+// 'L'
+0x7F, 0x20, 0x10, 0x08, 0x04,
+// 'M'
+0x7F, 0x01, 0x47, 0xF0, 0x07,
+// 'N'
+0x7F, 0x02, 0x02, 0xF2, 0x07,
+// 'O'
+0xBE, 0x60, 0x30, 0xE8, 0x03,
+// 'P'
+0xFF, 0x44, 0x22, 0x61, 0x00,
+// 'Q'
+0xBE, 0x60, 0x34, 0xE4, 0x05,
+// 'R'
+0xFF, 0x44, 0x26, 0x65, 0x04,
+// 'S'
+0xA6, 0x64, 0x32, 0x29, 0x03,
+// 'T'
+0x83, 0xC0, 0x3F, 0x30, 0x00,
+// 'U'
+0x3F, 0x20, 0x10, 0xF8, 0x03,
+// 'V'
+0x1F, 0x10, 0x10, 0xF4, 0x01,
+// 'W'
+0x3F, 0x20, 0x0E, 0xF8, 0x03,
+// 'X'
+0x63, 0x0A, 0x82, 0x32, 0x06,
+// 'Y'
+0x03, 0x02, 0x9E, 0x30, 0x00,
+// 'Z'
+0xE1, 0x6C, 0xB2, 0x39, 0x04,
+// '['
+0xFF, 0x60, 0x30, 0x08,
+// '\\'
+0x41, 0x10, 0x04, 0x01,
+// ']'
+0xC1, 0x60, 0xF0, 0x0F,
+// '^'
+0x54, 0x44,
+// '_'
+0x1F,
+// '`'
+0x73, 0x08,
+// 'a'
+0xA8, 0x56, 0x0F, 0x01,
+// 'b'
+0x7F, 0x14, 0x91, 0x88, 0x03,
+// 'c'
+0x2E, 0xC6, 0xA8, 0x00,
+// 'd'
+0x38, 0x22, 0x11, 0xF5, 0x07,
+// 'e'
+0xAE, 0xD6, 0x6A, 0x00,
+// 'f'
+0x08, 0x7F, 0x42, 0x00,
+// 'g'
+0x26, 0xA5, 0xE3, 0x01,
+// 'h'
+0x7F, 0x04, 0x81, 0x80, 0x07,
+// 'i'
+0xC4, 0x3E, 0x10,
+// 'j'
+0x20, 0x20, 0xB0, 0x07,
+// 'k'
+0x7F, 0x08, 0x8A, 0x08,
+// 'l'
+0xC1, 0x3F, 0x10,
+// 'm'
+0x3F, 0xF8, 0xE0, 0x01,
+// 'n'
+0x5F, 0x84, 0xE0, 0x01,
+// 'o'
+0x2E, 0xC6, 0xE8, 0x00,
+// 'p'
+0xDF, 0xA4, 0x64, 0x00,
+// 'q'
+0x26, 0x25, 0xF3, 0x01,
+// 'r'
+0x5F, 0x84, 0x20, 0x00,
+// 's'
+0xB2, 0xD6, 0x9A, 0x00,
+// 't'
+0x04, 0xC2, 0x8F, 0x48, 0x02,
+// 'u'
+0x0F, 0x42, 0xF4, 0x01,
+// 'v'
+0x07, 0x41, 0x74, 0x00,
+// 'w'
+0x0F, 0x32, 0xF8, 0x00,
+// 'x'
+0x51, 0x11, 0x15, 0x01,
+// 'y'
+0x93, 0x10, 0xF2, 0x01,
+// 'z'
+0x31, 0xD7, 0x19, 0x01,
+// '{'
+0x08, 0x5B, 0x10,
+// '|'
+0x77,
+// '}'
+0x41, 0x1B, 0x02,
+// '~'
+0x8A, 0x28,
+};
+static const SSD1306_PackedGlyph_t Font6x8_glyphs[] = {
+{0, 0, 0, 0, 0}, // ' '
+{0, 2, 0, 1, 7}, // '!'
+{1, 1, 0, 3, 3}, // '"'
+{3, 0, 0, 5, 7}, // '#'
+{8, 0, 0, 5, 7}, // '$'
+{13, 0, 0, 5, 7}, // '%'
+{18, 0, 0, 5, 7}, // '&'
+{23, 1, 0, 3, 4}, // "'"
+{25, 1, 0, 3, 7}, // '('
+{28, 1, 0, 3, 7}, // ')'
+{31, 0, 0, 5, 7}, // '*'
+{36, 0, 1, 5, 5}, // '+'
+{40, 2, 4, 2, 3}, // ','
+{41, 0, 3, 5, 1}, // '-'
+{42, 2, 5, 2, 2}, // '.'
+{43, 0, 1, 5, 5}, // '/'
+{47, 0, 0, 5, 7}, // '0'
+{52, 1, 0, 3, 7}, // '1'
+{55, 0, 0, 5, 7}, // '2'
+{60, 0, 0, 5, 7}, // '3'
+{65, 0, 0, 5, 7}, // '4'
+{70, 0, 0, 5, 7}, // '5'
+{75, 0, 0, 5, 7}, // '6'
+{80, 0, 0, 5, 7}, // '7'
+{85, 0, 0, 5, 7}, // '8'
+{90, 0, 0, 5, 7}, // '9'
+{95, 2, 2, 1, 3}, // ':'
+{96, 1, 2, 2, 5}, // ';'
+{98, 1, 0, 4, 7}, // '<'
+{102, 0, 2, 5, 3}, // '='
+{104, 1, 0, 4, 7}, // '>'
+{108, 0, 0, 5, 7}, // '?'
+{113, 0, 0, 5, 7}, // '@'
+{118, 0, 0, 5, 7}, // 'A'
+{123, 0, 0, 5, 7}, // 'B'
+{128, 0, 0, 5, 7}, // 'C'
+{133, 0, 0, 5, 7}, // 'D'
+{138, 0, 0, 5, 7}, // 'E'
+{143, 0, 0, 5, 7}, // 'F'
+{148, 0, 0, 5, 7}, // 'G'
+{153, 0, 0, 5, 7}, // 'H'
+{158, 1, 0, 3, 7}, // 'I'
+{161, 0, 0, 5, 7}, // 'J'
+{166, 0, 0, 5, 7}, // 'K'
+{171, 0, 0, 5, 7}, // 'L'
+{176, 0, 0, 5, 7}, // 'M'
+{181, 0, 0, 5, 7}, // 'N'
+{186, 0, 0, 5, 7}, // 'O'
+{191, 0, 0, 5, 7}, // 'P'
+{196, 0, 0, 5, 7}, // 'Q'
+{201, 0, 0, 5, 7}, // 'R'
+{206, 0, 0, 5, 7}, // 'S'
+{211, 0, 0, 5, 7}, // 'T'
+{216, 0, 0, 5, 7}, // 'U'
+{221, 0, 0, 5, 7}, // 'V'
+{226, 0, 0, 5, 7}, // 'W'
+{231, 0, 0, 5, 7}, // 'X'
+{236, 0, 0, 5, 7}, // 'Y'
+{241, 0, 0, 5, 7}, // 'Z'
+{246, 1, 0, 4, 7}, // '['
+{250, 0, 1, 5, 5}, // '\\'
+{254, 1, 0, 4, 7}, // ']'
+{258, 0, 0, 5, 3}, // '^'
+{260, 0, 6, 5, 1}, // '_'
+{261, 1, 0, 3, 4}, // '`'
+{263, 0, 2, 5, 5}, // 'a'
+{267, 0, 0, 5, 7}, // 'b'
+{272, 0, 2, 5, 5}, // 'c'
+{276, 0, 0, 5, 7}, // 'd'
+{281, 0, 2, 5, 5}, // 'e'
+{285, 1, 0, 4, 7}, // 'f'
+{289, 0, 2, 5, 5}, // 'g'
+{293, 0, 0, 5, 7}, // 'h'
+{298, 1, 0, 3, 7}, // 'i'
+{301, 0, 0, 4, 7}, // 'j'
+{305, 0, 0, 4, 7}, // 'k'
+{309, 1, 0, 3, 7}, // 'l'
+{312, 0, 2, 5, 5}, // 'm'
+{316, 0, 2, 5, 5}, // 'n'
+{320, 0, 2, 5, 5}, // 'o'
+{324, 0, 2, 5, 5}, // 'p'
+{328, 0, 2, 5, 5}, // 'q'
+{332, 0, 2, 5, 5}, // 'r'
+{336, 0, 2, 5, 5}, // 's'
+{340, 0, 0, 5, 7}, // 't'
+{345, 0, 2, 5, 5}, // 'u'
+{349, 0, 2, 5, 5}, // 'v'
+{353, 0, 2, 5, 5}, // 'w'
+{357, 0, 2, 5, 5}, // 'x'
+{361, 0, 2, 5, 5}, // 'y'
+{365, 0, 2, 5, 5}, // 'z'
+{369, 1, 0, 3, 7}, // '{'
+{372, 2, 0, 1, 7}, // '|'
+{373, 1, 0, 3, 7}, // '}'
+{376, 0, 0, 5, 3}, // '~'
+};
+const SSD1306_Font_t Font_6x8 = {6, 8, NULL, NULL, NULL, Font6x8_glyphs, Font6x8_packed};
+#endif
+
+#ifdef SSD1306_INCLUDE_FONT_7x10
+static const uint8_t Font7x10_packed[] = {
+// '!'
+0xBF,
+// '"'
+0xC7, 0x01,
+// '#'
+0xF4, 0x2F, 0x24, 0xF4, 0x2F,
+// '$'
+0x66, 0x12, 0xFD, 0x4F, 0x24, 0x07,
+// '%'
+0x26, 0x19, 0x6E, 0x94, 0x62,
+// '&'
+0x60, 0x96, 0x99, 0x66, 0x90,
+// "'"
+0x07,
+// '('
+0xFC, 0x08, 0x14, 0x20,
+// ')'
+0x01, 0x0A, 0xC4, 0x0F,
+// '*'
+0x7A, 0x0A,
+// '+'
+0x84, 0x7C, 0x42, 0x00,
+// ','
+0x07,
+// '-'
+0x07,
+// '.'
+0x01,
+// '/'
+0xC0, 0x3C, 0x03,
+// '0'
+0x7E, 0x81, 0x89, 0x81, 0x7E,
+// '1'
+0x04, 0x02, 0xFF,
+// '2'
+0x86, 0xC1, 0xA1, 0x91, 0x8E,
+// '3'
+0x42, 0x81, 0x89, 0x89, 0x76,
+// '4'
+0x30, 0x2C, 0x22, 0xFF, 0x20,
+// '5'
+0x4F, 0x89, 0x89, 0x89, 0x71,
+// '6'
+0x7E, 0x89, 0x89, 0x89, 0x72,
+// '7'
+0x01, 0xE1, 0x19, 0x05, 0x03,
+// '8'
+0x76, 0x89, 0x89, 0x89, 0x76,
+// '9'
+0x4E, 0x91, 0x91, 0x91, 0x7E,
+// ':'
+0x21,
+// ';'
+0x71,
+// '<'
+0x44, 0xA9, 0x18, 0x01,
+// '='
+0x6D, 0x5B,
+// '>'
+0x31, 0x2A, 0x45, 0x00,
+// '?'
+0x02, 0x01, 0xB1, 0x09, 0x06,
+// '@'
+0x7E, 0x81, 0x99, 0x95, 0x1E,
+// 'A'
+0xE0, 0x3E, 0x21, 0x3E, 0xE0,
+// 'B'
+0xFF, 0x89, 0x89, 0x89, 0x76,
+// 'C'
+0x7E, 0x81, 0x81, 0x81, 0x42,
+// 'D'
+0xFF, 0x81, 0x81, 0x42, 0x3C,
+// 'E'
+0xFF, 0x89, 0x89, 0x89, 0x89,
+// 'F'
+0xFF, 0x09, 0x09, 0x09, 0x01,
+// 'G'
+0x7E, 0x81, 0x91, 0x91, 0x72,
+// 'H'
+0xFF, 0x08, 0x08, 0x08, 0xFF,
+// 'I'
+0x81, 0xFF, 0x81,
+// 'J'
+0x40, 0x80, 0x80, 0x80, 0x7F,
+// 'K'
+0xFF, 0x08, 0x14, 0x62, 0x81,
+// 'L'
+0xFF, 0x80, 0x80, 0x80, 0x80,
+// 'M'
+0xFF, 0x06, 0x08, 0x06, 0xFF,
+// 'N'
+0xFF, 0x06, 0x18, 0x60, 0xFF,
+// 'O'
+0x7E, 0x81, 0x81, 0x81, 0x7E,
+// 'P'
+0xFF, 0x11, 0x11, 0x11, 0x0E,
+// 'Q'
+0x7E, 0x02, 0x05, 0x0B, 0xE4, 0x17,
+// 'R'
+0xFF, 0x11, 0x11, 0x71, 0x8E,
+// 'S'
+0x46, 0x89, 0x89, 0x91, 0x62,
+// 'T'
+0x01, 0x01, 0xFF, 0x01, 0x01,
+// 'U'
+0x7F, 0x80, 0x80, 0x80, 0x7F,
+// 'V'
+0x07, 0x38, 0xC0, 0x38, 0x07,
+// 'W'
+0x3F, 0xE0, 0x1C, 0xE0, 0x3F,
+// 'X'
+0x81, 0x66, 0x18, 0x66, 0x81,
+// 'Y'
+0x03, 0x0C, 0xF0, 0x0C, 0x03,
+// 'Z'
+0xC1, 0xA1, 0x99, 0x85, 0x83,
+// '['
+0xFF, 0x07, 0x08,
+// '\\'
+0x03, 0x3C, 0xC0,
+// ']'
+0x01, 0xFE, 0x0F,
+// '^'
+0x68, 0x61, 0x08,
+// '_'
+0x7F,
+// '`'
+0x09,
+// 'a'
+0x5A, 0x59, 0x56, 0x3E,
+// 'b'
+0xFF, 0x48, 0x84, 0x84, 0x78,
+// 'c'
+0x5E, 0x18, 0x86, 0x12,
+// 'd'
+0x78, 0x84, 0x84, 0x48, 0xFF,
+// 'e'
+0x5E, 0x59, 0x96, 0x16,
+// 'f'
+0x04, 0x04, 0xFE, 0x05, 0x05,
+// 'g'
+0x9E, 0xA1, 0xA1, 0x92, 0x7F,
+// 'h'
+0xFF, 0x08, 0x04, 0x04, 0xF8,
+// 'i'
+0x04, 0x04, 0xFD,
+// 'j'
+0x00, 0x12, 0x48, 0x60, 0x7F,
+// 'k'
+0xFF, 0x10, 0x28, 0x44, 0x80,
+// 'l'
+0x01, 0x01, 0xFF,
+// 'm'
+0x7F, 0xF0, 0x07, 0x3E,
+// 'n'
+0xBF, 0x10, 0x04, 0x3E,
+// 'o'
+0x5E, 0x18, 0x86, 0x1E,
+// 'p'
+0xFF, 0x12, 0x21, 0x21, 0x1E,
+// 'q'
+0x1E, 0x21, 0x21, 0x12, 0xFF,
+// 'r'
+0xBF, 0x10, 0x04, 0x02,
+// 's'
+0x52, 0x59, 0xA6, 0x12,
+// 't'
+0x04, 0x7F, 0x84, 0x84,
+// 'u'
+0x1F, 0x08, 0x42, 0x3F,
+// 'v'
+0x03, 0x07, 0x72, 0x03,
+// 'w'
+0x0F, 0x7E, 0xE0, 0x0F,
+// 'x'
+0xA1, 0xC4, 0x48, 0x21,
+// 'y'
+0x83, 0x8C, 0x70, 0x0C, 0x03,
+// 'z'
+0x71, 0x5A, 0x8E, 0x21,
+// '{'
+0x30, 0x3C, 0x1F, 0x20,
+// '|'
+0xFF, 0x03,
+// '}'
+0x01, 0x3E, 0x0F, 0x03,
+// '~'
+0x97, 0x03,
+};
+static const SSD1306_PackedGlyph_t Font7x10_glyphs[] = {
+{0, 0, 0, 0, 0}, // ' '
+{0, 3, 0, 1, 8}, // '!'
+{1, 2, 0, 3, 3}, // '"'
+{3, 1, 0, 5, 8}, // '#'
+{8, 1, 0, 5, 9}, // '$'
+{14, 1, 0, 5, 8}, // '%'
+{19, 1, 0, 5, 8}, // '&'
+{24, 3, 0, 1, 3}, // "'"
+{25, 2, 0, 3, 10}, // '('
+{29, 2, 0, 3, 10}, // ')'
+{33, 2, 0, 3, 4}, // '*'
+{35, 1, 2, 5, 5}, // '+'
+{39, 3, 7, 1, 3}, // ','
+{40, 2, 5, 3, 1}, // '-'
+{41, 3, 7, 1, 1}, // '.'
+{42, 2, 0, 3, 8}, // '/'
+{45, 1, 0, 5, 8}, // '0'
+{50, 1, 0, 3, 8}, // '1'
+{53, 1, 0, 5, 8}, // '2'
+{58, 1, 0, 5, 8}, // '3'
+{63, 1, 0, 5, 8}, // '4'
+{68, 1, 0, 5, 8}, // '5'
+{73, 1, 0, 5, 8}, // '6'
+{78, 1, 0, 5, 8}, // '7'
+{83, 1, 0, 5, 8}, // '8'
+{88, 1, 0, 5, 8}, // '9'
+{93, 3, 2, 1, 6}, // ':'
+{94, 3, 3, 1, 7}, // ';'
+{95, 1, 2, 5, 5}, // '<'
+{99, 1, 3, 5, 3}, // '='
+{101, 1, 2, 5, 5}, // '>'
+{105, 1, 0, 5, 8}, // '?'
+{110, 1, 0, 5, 8}, // '@'
+{115, 1, 0, 5, 8}, // 'A'
+{120, 1, 0, 5, 8}, // 'B'
+{125, 1, 0, 5, 8}, // 'C'
+{130, 1, 0, 5, 8}, // 'D'
+{135, 1, 0, 5, 8}, // 'E'
+{140, 1, 0, 5, 8}, // 'F'
+{145, 1, 0, 5, 8}, // 'G'
+{150, 1, 0, 5, 8}, // 'H'
+{155, 2, 0, 3, 8}, // 'I'
+{158, 1, 0, 5, 8}, // 'J'
+{163, 1, 0, 5, 8}, // 'K'
+{168, 1, 0, 5, 8}, // 'L'
+{173, 1, 0, 5, 8}, // 'M'
+{178, 1, 0, 5, 8}, // 'N'
+{183, 1, 0, 5, 8}, // 'O'
+{188, 1, 0, 5, 8}, // 'P'
+{193, 1, 0, 5, 9}, // 'Q'
+{199, 1, 0, 5, 8}, // 'R'
+{204, 1, 0, 5, 8}, // 'S'
+{209, 1, 0, 5, 8}, // 'T'
+{214, 1, 0, 5, 8}, // 'U'
+{219, 1, 0, 5, 8}, // 'V'
+{224, 1, 0, 5, 8}, // 'W'
+{229, 1, 0, 5, 8}, // 'X'
+{234, 1, 0, 5, 8}, // 'Y'
+{239, 1, 0, 5, 8}, // 'Z'
+{244, 3, 0, 2, 10}, // '['
+{247, 2, 0, 3, 8}, // '\\'
+{250, 2, 0, 2, 10}, // ']'
+{253, 1, 0, 5, 4}, // '^'
+{256, 0, 9, 7, 1}, // '_'
+{257, 2, 0, 2, 2}, // '`'
+{258, 1, 2, 5, 6}, // 'a'
+{262, 1, 0, 5, 8}, // 'b'
+{267, 1, 2, 5, 6}, // 'c'
+{271, 1, 0, 5, 8}, // 'd'
+{276, 1, 2, 5, 6}, // 'e'
+{280, 1, 0, 5, 8}, // 'f'
+{285, 1, 2, 5, 8}, // 'g'
+{290, 1, 0, 5, 8}, // 'h'
+{295, 1, 0, 3, 8}, // 'i'
+{298, 0, 0, 4, 10}, // 'j'
+{303, 1, 0, 5, 8}, // 'k'
+{308, 1, 0, 3, 8}, // 'l'
+{311, 1, 2, 5, 6}, // 'm'
+{315, 1, 2, 5, 6}, // 'n'
+{319, 1, 2, 5, 6}, // 'o'
+{323, 1, 2, 5, 8}, // 'p'
+{328, 1, 2, 5, 8}, // 'q'
+{333, 1, 2, 5, 6}, // 'r'
+{337, 1, 2, 5, 6}, // 's'
+{341, 1, 0, 4, 8}, // 't'
+{345, 1, 2, 5, 6}, // 'u'
+{349, 1, 2, 5, 6}, // 'v'
+{353, 1, 2, 5, 6}, // 'w'
+{357, 1, 2, 5, 6}, // 'x'
+{361, 1, 2, 5, 8}, // 'y'
+{366, 1, 2, 5, 6}, // 'z'
+{370, 2, 0, 3, 10}, // '{'
+{374, 3, 0, 1, 10}, // '|'
+{376, 2, 0, 3, 10}, // '}'
+{380, 1, 3, 5, 2}, // '~'
+};
+const SSD1306_Font_t Font_7x10 = {7, 10, NULL, NULL, NULL, Font7x10_glyphs, Font7x10_packed};
+#endif
+
+#ifdef SSD1306_INCLUDE_FONT_11x18
+static const uint8_t Font11x18_packed[] = {
+// '!'
+0xFF, 0xF7, 0xFF, 0x0D,
+// '"'
+0xFF, 0x83, 0xFF, 0x01,
+// '#'
+0x30, 0x03, 0xEC, 0xFF, 0xFF, 0xFF, 0x0D, 0x30, 0x03, 0xEC, 0xFF, 0xFF, 0xFF, 0x0D, 0x30, 0x03,
+// '$'
+0x1C, 0x0E, 0x3E, 0x1E, 0x77, 0x38, 0x63, 0x30, 0xFF, 0xFF, 0xC3, 0x30, 0x8E, 0x1F, 0x0C, 0x0F,
+// '%'
+0x1E, 0xC0, 0x0F, 0x13, 0x62, 0xFC, 0x0C, 0x9E, 0x01, 0xB0, 0x07, 0xF6, 0xC3, 0x84, 0x18, 0x3F,
+0x83, 0x07,
+// '&'
+0x00, 0x8F, 0xE7, 0xF7, 0x0B, 0x8F, 0xC3, 0xE3, 0xF1, 0xCF, 0xE6, 0xE1, 0x00, 0xFE, 0x80, 0x11,
+// "'"
+0xFF, 0x03,
+// '('
+0xC0, 0x0F, 0xE0, 0xFF, 0xC1, 0x01, 0x8E, 0x01, 0x60, 0x01, 0x00, 0x02,
+// ')'
+0x01, 0x00, 0x1A, 0x00, 0xC6, 0x01, 0x0E, 0xFE, 0x1F, 0xC0, 0x0F, 0x00,
+// '*'
+0x96, 0xBF, 0xC7, 0x2D,
+// '+'
+0x30, 0xC0, 0x00, 0x03, 0x0C, 0xFF, 0xFF, 0x0F, 0x03, 0x0C, 0x30, 0xC0, 0x00,
+// ','
+0xF3, 0x01,
+// '-'
+0xFF,
+// '.'
+0x0F,
+// '/'
+0x00, 0x38, 0xE0, 0x8F, 0x7F, 0xFC, 0x01, 0x07, 0x00,
+// '0'
+0xF8, 0x87, 0xFF, 0x77, 0x80, 0x0F, 0xC3, 0xC3, 0xF0, 0x01, 0xEE, 0xFF, 0xE1, 0x1F,
+// '1'
+0x18, 0x00, 0x03, 0x60, 0x00, 0xFC, 0xFF, 0xFF, 0x3F,
+// '2'
+0x1C, 0xB8, 0x07, 0x7F, 0x60, 0x0F, 0xCC, 0x83, 0xF1, 0x31, 0xEC, 0x07, 0xF3, 0xC0,
+// '3'
+0x0C, 0x8C, 0x03, 0x37, 0x80, 0x8F, 0xC1, 0x63, 0xB0, 0x3F, 0xCE, 0xF9, 0x01, 0x3C,
+// '4'
+0x00, 0x07, 0xF0, 0x81, 0x6F, 0x78, 0x18, 0xFF, 0xFF, 0xFF, 0x0F, 0x60, 0x00, 0x18,
+// '5'
+0xFF, 0xCC, 0x3F, 0x37, 0x84, 0x8F, 0xC1, 0x63, 0xF0, 0x38, 0x3E, 0xFC, 0x01, 0x3E,
+// '6'
+0xF8, 0x87, 0xFF, 0x77, 0x8C, 0x8F, 0xC1, 0x63, 0xF0, 0x39, 0xEE, 0xFC, 0x31, 0x3E,
+// '7'
+0x03, 0xC0, 0x00, 0x30, 0x80, 0x0F, 0xFE, 0xE3, 0xC3, 0x1E, 0xF0, 0x01, 0x1C, 0x00,
+// '8'
+0x1C, 0x8F, 0xEF, 0x37, 0x0C, 0x0F, 0xC3, 0xC3, 0xF0, 0x31, 0xEC, 0xFB, 0x71, 0x3C,
+// '9'
+0x7C, 0x8C, 0x3F, 0x77, 0x9C, 0x0F, 0xC6, 0x83, 0xF1, 0x31, 0xEE, 0xFF, 0xE1, 0x1F,
+// ':'
+0x03, 0x0F, 0x0C,
+// ';'
+0x83, 0x39, 0x78,
+// '<'
+0x10, 0x70, 0xA0, 0x60, 0x43, 0xC4, 0x98, 0xA0, 0xC1,
+// '='
+0xF3, 0x3C, 0xCF, 0xF3, 0x3C, 0xCF,
+// '>'
+0x83, 0x05, 0x19, 0x23, 0xC2, 0x06, 0x05, 0x0E, 0x08,
+// '?'
+0x0C, 0x80, 0x03, 0x70, 0x00, 0x0C, 0xDC, 0x83, 0xF7, 0x70, 0x70, 0x0E, 0xF8, 0x01, 0x3C, 0x00,
+// '@'
+0xF8, 0x87, 0xFF, 0xF7, 0x80, 0x8F, 0xC7, 0xE3, 0xF3, 0xCC, 0xE6, 0x3F, 0xF0, 0x0F,
+// 'A'
+0x00, 0x38, 0xF0, 0xCF, 0x7F, 0xFC, 0x0C, 0x03, 0xC3, 0xCF, 0xC0, 0x7F, 0x00, 0xFF, 0x00, 0x38,
+// 'B'
+0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x0F, 0xC3, 0xC3, 0xB0, 0x7F, 0xCE, 0xF3, 0x01, 0x38,
+// 'C'
+0xF8, 0x87, 0xFF, 0x77, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xEC, 0xC0, 0x31, 0x30,
+// 'D'
+0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xB0, 0x03, 0xE7, 0xFF, 0xE0, 0x0F,
+// 'E'
+0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x0F, 0xC3, 0xC3, 0xF0, 0x30, 0x3C, 0x0C, 0x0F, 0xC0,
+// 'F'
+0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x0C, 0x03, 0xC3, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x00,
+// 'G'
+0xF8, 0x87, 0xFF, 0x77, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x60, 0xEC, 0xF8, 0x31, 0x7E,
+// 'H'
+0xFF, 0xFF, 0xFF, 0x0F, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x30, 0xF0, 0xFF, 0xFF, 0xFF,
+// 'I'
+0x03, 0xF0, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0x00, 0x0C,
+// 'J'
+0x00, 0x0E, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x30, 0x00, 0xFE, 0xFF, 0xFD, 0x3F,
+// 'K'
+0xFF, 0xFF, 0xFF, 0x0F, 0x0C, 0x80, 0x03, 0xB8, 0x03, 0xC7, 0x61, 0xC0, 0x0D, 0xE0, 0x01, 0x20,
+// 'L'
+0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0xC0,
+// 'M'
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x01, 0xC0, 0x00, 0x1F, 0x70, 0x00, 0xFC, 0xFF, 0xFF, 0x3F,
+// 'N'
+0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF0, 0x03, 0xE0, 0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+// 'O'
+0xF8, 0x87, 0xFF, 0x77, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xEE, 0xFF, 0xE1, 0x1F,
+// 'P'
+0xFF, 0xFF, 0xFF, 0x3F, 0x18, 0x0C, 0x06, 0x83, 0xC1, 0x71, 0xE0, 0x0F, 0xF0, 0x01,
+// 'Q'
+0xF8, 0x87, 0xFF, 0x77, 0x80, 0x0F, 0xC0, 0x03, 0xF6, 0x01, 0xEF, 0xFF, 0xE1, 0x5F, 0x00, 0x20,
+// 'R'
+0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x0C, 0x03, 0xC3, 0xC1, 0xF9, 0xE1, 0xE7, 0xF1, 0xE0, 0x00, 0x20,
+// 'S'
+0x00, 0x06, 0x8F, 0xE7, 0x87, 0x8F, 0xC1, 0xC3, 0xF0, 0x70, 0xEC, 0xF8, 0x31, 0x3C,
+// 'T'
+0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x0C, 0x00, 0x03, 0xC0,
+0x00, 0x00,
+// 'U'
+0xFF, 0xCF, 0xFF, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x30, 0x00, 0xFE, 0xFF, 0xFD, 0x3F,
+// 'V'
+0x07, 0xC0, 0x0F, 0x80, 0x3F, 0x00, 0x7F, 0x00, 0x3C, 0xF0, 0x87, 0x3F, 0xFC, 0x00, 0x07, 0x00,
+// 'W'
+0x3F, 0xC0, 0xFF, 0x0F, 0x80, 0x03, 0x3C, 0xE0, 0x01, 0x78, 0x00, 0xF0, 0x00, 0xE0, 0xFF, 0xFF,
+0x0F, 0x00,
+// 'X'
+0x01, 0xE0, 0x01, 0xEE, 0xC1, 0xE1, 0x3C, 0xF0, 0x07, 0xF8, 0x80, 0x73, 0x70, 0x78, 0x07, 0x78,
+0x00, 0x08,
+// 'Y'
+0x01, 0xC0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x3F, 0xF8, 0x8F, 0x07, 0x78, 0x00, 0x07, 0x40,
+0x00, 0x00,
+// 'Z'
+0x00, 0xF8, 0x00, 0x3F, 0x70, 0x0F, 0xCF, 0xE3, 0xF0, 0x0E, 0xFC, 0x01, 0x1F, 0xC0,
+// '['
+0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF0, 0x00, 0xC0,
+// '\\'
+0x07, 0xC0, 0x1F, 0x80, 0x7F, 0x00, 0xFE, 0x00, 0x38,
+// ']'
+0x03, 0x00, 0x0F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+// '^'
+0xC0, 0xF0, 0x3C, 0x07, 0x07, 0x3C, 0xF0, 0xC0,
+// '_'
+0xFF, 0x07,
+// '`'
+0xD9, 0x09,
+// 'a'
+0xC4, 0x99, 0x3F, 0xF3, 0xCC, 0x33, 0xCD, 0xF6, 0x9F, 0xFF, 0x00, 0x02,
+// 'b'
+0xFF, 0xFF, 0xFF, 0x0F, 0x86, 0xC1, 0xC0, 0x30, 0x30, 0x1C, 0x0E, 0xFE, 0x01, 0x3F,
+// 'c'
+0xFC, 0xF8, 0x77, 0xF8, 0xC0, 0x03, 0x1F, 0xEE, 0x1C, 0x33,
+// 'd'
+0xC0, 0x0F, 0xF8, 0x07, 0x87, 0xC3, 0xC0, 0x30, 0x30, 0x18, 0xF6, 0xFF, 0xFF, 0xFF,
+// 'e'
+0xFC, 0xF8, 0x77, 0xFB, 0xCC, 0x33, 0xDF, 0xEC, 0x1B, 0x2E,
+// 'f'
+0x30, 0x00, 0x0C, 0x00, 0x03, 0xF8, 0xFF, 0xFF, 0xFF, 0x0C, 0x30, 0x03, 0xCC, 0x00, 0x03, 0x00,
+// 'g'
+0xFC, 0x98, 0x7F, 0x7E, 0x38, 0x0F, 0xCC, 0x03, 0xB3, 0x61, 0xFE, 0xFF, 0xFD, 0x3F,
+// 'h'
+0xFF, 0xFF, 0xFF, 0x0F, 0x06, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0xFF, 0x83, 0xFF,
+// 'i'
+0x30, 0x00, 0x0C, 0x00, 0x03, 0xCC, 0xFF, 0xF3, 0x3F,
+// 'j'
+0x00, 0x80, 0xC1, 0x00, 0x0C, 0x03, 0x30, 0x0C, 0xC0, 0xF3, 0xFF, 0xCF, 0xFF, 0x07,
+// 'k'
+0xFF, 0xFF, 0xFF, 0x0F, 0x30, 0x00, 0x06, 0xC0, 0x03, 0x98, 0x03, 0xC3, 0x41, 0xC0, 0x00, 0x20,
+// 'l'
+0x03, 0xC0, 0x00, 0x30, 0x00, 0xFC, 0xFF, 0xFF, 0x3F,
+// 'm'
+0xFF, 0xFF, 0x2F, 0xC0, 0x00, 0xFF, 0xFF, 0x6F, 0xC0, 0x00, 0xFF, 0xFB, 0x0F,
+// 'n'
+0xFF, 0xFF, 0x6F, 0xC0, 0x00, 0x03, 0x0C, 0xF0, 0xBF, 0xFF,
+// 'o'
+0xFC, 0xF8, 0x77, 0xF8, 0xC0, 0x03, 0x1F, 0xEE, 0x1F, 0x3F,
+// 'p'
+0xFF, 0xFF, 0xFF, 0x6F, 0x18, 0x0C, 0x0C, 0x03, 0xC3, 0xE1, 0xE0, 0x1F, 0xF0, 0x03,
+// 'q'
+0xFC, 0x80, 0x7F, 0x70, 0x38, 0x0C, 0x0C, 0x03, 0x83, 0x61, 0xF0, 0xFF, 0xFF, 0xFF,
+// 'r'
+0x01, 0xFC, 0xEF, 0xBF, 0x01, 0x03, 0x0C, 0x70, 0x80, 0x00,
+// 's'
+0x9C, 0xF9, 0x36, 0xF3, 0xCC, 0x33, 0xCF, 0x6C, 0x9F, 0x39,
+// 't'
+0x18, 0x00, 0x03, 0xF8, 0xBF, 0xFF, 0x8F, 0x81, 0x31, 0x30, 0x06, 0x06, 0xC0,
+// 'u'
+0xFF, 0xFD, 0x0F, 0x30, 0xC0, 0x00, 0x03, 0xF6, 0xFF, 0xFF,
+// 'v'
+0x01, 0x3C, 0xE0, 0x07, 0x7C, 0x80, 0xC3, 0xEF, 0xC7, 0x03, 0x01, 0x00,
+// 'w'
+0x07, 0xFC, 0x03, 0xFC, 0x3F, 0x07, 0xFC, 0x03, 0xFC, 0x3F, 0x07, 0x00,
+// 'x'
+0x01, 0x1E, 0xEE, 0x1C, 0x1E, 0x78, 0x38, 0x77, 0x78, 0x80,
+// 'y'
+0x03, 0xF0, 0x07, 0xCC, 0x8F, 0x83, 0x7F, 0x00, 0x1F, 0xFE, 0xF1, 0x0F, 0x1C, 0x00,
+// 'z'
+0x03, 0x0F, 0x3E, 0xFC, 0xD8, 0x33, 0x6F, 0xFC, 0xF0, 0xC1, 0x03, 0x03,
+// '{'
+0x00, 0x03, 0x00, 0x1E, 0xE0, 0xFF, 0xDF, 0x3F, 0xFF, 0x03, 0x00, 0x0F, 0x00, 0x0C,
+// '|'
+0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+// '}'
+0x03, 0x00, 0x0F, 0x00, 0xFC, 0xCF, 0xBF, 0xFF, 0x7F, 0x80, 0x07, 0x00, 0x0C, 0x00,
+// '~'
+0xDE, 0x66, 0x7B,
+};
+static const SSD1306_PackedGlyph_t Font11x18_glyphs[] = {
+{0, 0, 0, 0, 0}, // ' '
+{0, 4, 1, 2, 14}, // '!'
+{4, 3, 1, 5, 5}, // '"'
+{8, 1, 1, 9, 14}, // '#'
+{24, 1, 1, 8, 16}, // '$'
+{40, 0, 1, 10, 14}, // '%'
+{58, 1, 1, 9, 14}, // '&'
+{74, 4, 1, 2, 5}, // "'"
+{76, 4, 0, 5, 18}, // '('
+{88, 2, 0, 5, 18}, // ')'
+{100, 2, 1, 6, 5}, // '*'
+{104, 0, 3, 10, 10}, // '+'
+{117, 4, 13, 2, 5}, // ','
+{119, 3, 9, 4, 2}, // '-'
+{120, 4, 13, 2, 2}, // '.'
+{121, 3, 1, 5, 14}, // '/'
+{130, 1, 1, 8, 14}, // '0'
+{144, 2, 1, 5, 14}, // '1'
+{153, 1, 1, 8, 14}, // '2'
+{167, 1, 1, 8, 14}, // '3'
+{181, 1, 1, 8, 14}, // '4'
+{195, 1, 1, 8, 14}, // '5'
+{209, 1, 1, 8, 14}, // '6'
+{223, 1, 1, 8, 14}, // '7'
+{237, 1, 1, 8, 14}, // '8'
+{251, 1, 1, 8, 14}, // '9'
+{265, 4, 5, 2, 10}, // ':'
+{268, 4, 6, 2, 12}, // ';'
+{271, 1, 4, 8, 9}, // '<'
+{280, 1, 5, 8, 6}, // '='
+{286, 1, 4, 8, 9}, // '>'
+{295, 1, 1, 9, 14}, // '?'
+{311, 1, 1, 8, 14}, // '@'
+{325, 1, 1, 9, 14}, // 'A'
+{341, 1, 1, 8, 14}, // 'B'
+{355, 1, 1, 8, 14}, // 'C'
+{369, 1, 1, 8, 14}, // 'D'
+{383, 1, 1, 8, 14}, // 'E'
+{397, 1, 1, 8, 14}, // 'F'
+{411, 1, 1, 8, 14}, // 'G'
+{425, 1, 1, 8, 14}, // 'H'
+{439, 2, 1, 6, 14}, // 'I'
+{450, 1, 1, 8, 14}, // 'J'
+{464, 1, 1, 9, 14}, // 'K'
+{480, 1, 1, 8, 14}, // 'L'
+{494, 1, 1, 9, 14}, // 'M'
+{510, 1, 1, 8, 14}, // 'N'
+{524, 1, 1, 8, 14}, // 'O'
+{538, 1, 1, 8, 14}, // 'P'
+{552, 1, 1, 9, 14}, // 'Q'
+{568, 1, 1, 9, 14}, // 'R'
+{584, 1, 1, 8, 14}, // 'S'
+{598, 0, 1, 10, 14}, // 'T'
+{616, 1, 1, 8, 14}, // 'U'
+{630, 1, 1, 9, 14}, // 'V'
+{646, 0, 1, 10, 14}, // 'W'
+{664, 0, 1, 10, 14}, // 'X'
+{682, 0, 1, 10, 14}, // 'Y'
+{700, 1, 1, 8, 14}, // 'Z'
+{714, 4, 0, 4, 18}, // '['
+{723, 3, 1, 5, 14}, // '\\'
+{732, 3, 0, 4, 18}, // ']'
+{741, 1, 1, 8, 8}, // '^'
+{749, 0, 16, 11, 1}, // '_'
+{751, 2, 1, 4, 3}, // '`'
+{753, 1, 5, 9, 10}, // 'a'
+{765, 1, 1, 8, 14}, // 'b'
+{779, 1, 5, 8, 10}, // 'c'
+{789, 1, 1, 8, 14}, // 'd'
+{803, 1, 5, 8, 10}, // 'e'
+{813, 1, 1, 9, 14}, // 'f'
+{829, 1, 4, 8, 14}, // 'g'
+{843, 1, 1, 8, 14}, // 'h'
+{857, 2, 1, 5, 14}, // 'i'
+{866, 1, 0, 6, 18}, // 'j'
+{880, 1, 1, 9, 14}, // 'k'
+{896, 2, 1, 5, 14}, // 'l'
+{905, 0, 5, 10, 10}, // 'm'
+{918, 1, 5, 8, 10}, // 'n'
+{928, 1, 5, 8, 10}, // 'o'
+{938, 1, 4, 8, 14}, // 'p'
+{952, 1, 4, 8, 14}, // 'q'
+{966, 1, 5, 8, 10}, // 'r'
+{976, 1, 5, 8, 10}, // 's'
+{986, 1, 2, 8, 13}, // 't'
+{999, 1, 5, 8, 10}, // 'u'
+{1009, 1, 5, 9, 10}, // 'v'
+{1021, 0, 5, 9, 10}, // 'w'
+{1033, 1, 5, 8, 10}, // 'x'
+{1043, 1, 4, 8, 14}, // 'y'
+{1057, 1, 5, 9, 10}, // 'z'
+{1069, 3, 0, 6, 18}, // '{'
+{1083, 5, 0, 2, 18}, // '|'
+{1088, 2, 0, 6, 18}, // '}'
+{1102, 1, 7, 8, 3}, // '~'
+};
+const SSD1306_Font_t Font_11x18 = {11, 18, NULL, NULL, NULL, Font11x18_glyphs, Font11x18_packed};
+#endif
+
+#ifdef SSD1306_INCLUDE_FONT_16x26
+static const uint8_t Font16x26_packed[] = {
+// '!'
+0xFF, 0x03, 0xFC, 0xFF, 0x8F, 0xFF, 0xFF, 0xF1, 0xFF, 0x3F, 0xFE, 0x0F, 0xC0, 0x01,
+// '"'
+0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x1F,
+// '#'
+0x00, 0x60, 0x00, 0x10, 0x0C, 0x00, 0x83, 0x71, 0x60, 0xF0, 0x0F, 0xEC, 0xFF, 0xC1, 0xFF, 0x9F,
+0xFF, 0x3F, 0xF8, 0x7F, 0xC3, 0xFF, 0xE0, 0xFF, 0x98, 0xFF, 0x03, 0xFF, 0x7F, 0xFE, 0xFF, 0xF0,
+0xFF, 0x07, 0xFE, 0xC1, 0xC0, 0x33, 0x18, 0x00, 0x06, 0x03,
+// '$'
+0x00, 0x00, 0x0C, 0x7E, 0x00, 0x86, 0x7F, 0x00, 0xC7, 0x7F, 0x80, 0xF3, 0x7F, 0x80, 0x39, 0xFC,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xCF, 0x01, 0xFE, 0xE3,
+0x00, 0xFF, 0x61, 0x00, 0x7F, 0x00,
+// '%'
+0xFE, 0x01, 0xD8, 0x3F, 0x80, 0xFF, 0x0F, 0xFC, 0x81, 0xC1, 0x17, 0x20, 0x7C, 0x9E, 0xE7, 0xC3,
+0xFF, 0x3E, 0xF0, 0xFF, 0x03, 0xFC, 0xFF, 0x07, 0xF0, 0xFF, 0x81, 0xEF, 0x7F, 0xF8, 0xFC, 0xCF,
+0x8F, 0x81, 0x7D, 0x30, 0xF0, 0x07, 0xFE, 0x3F, 0xC0, 0xFF,
+// '&'
+0x00, 0xF8, 0x03, 0x80, 0xFF, 0x00, 0xF0, 0x3F, 0x1C, 0xFF, 0xEF, 0xFF, 0xE0, 0xFF, 0x0F, 0xF8,
+0xFF, 0x07, 0xFE, 0xFF, 0xC1, 0x83, 0xFF, 0xF8, 0xBF, 0xBF, 0xFF, 0xC7, 0x7F, 0x7F, 0xF0, 0xE7,
+0x07, 0xF8, 0x01, 0xE0, 0x3F, 0x00, 0xFF, 0x07, 0xE0, 0xEF,
+// "'"
+0xBF, 0xFF, 0xFF, 0xFF, 0x01,
+// '('
+0x00, 0xFF, 0x00, 0xC0, 0xFF, 0x0F, 0xC0, 0xFF, 0x3F, 0xE0, 0xFF, 0xFF, 0xC1, 0x1F, 0xF8, 0xC3,
+0x07, 0x80, 0xCF, 0x03, 0x00, 0xBC, 0x03, 0x00, 0x70, 0x03, 0x00, 0xC0, 0x07, 0x00, 0x80, 0x07,
+0x00, 0x00, 0x0E, 0x00, 0x00, 0x0C,
+// ')'
+0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xEE,
+0x01, 0x00, 0x9E, 0x0F, 0x00, 0x1F, 0xFE, 0xC0, 0x1F, 0xFC, 0xFF, 0x3F, 0xE0, 0xFF, 0x1F, 0x80,
+0xFF, 0x1F, 0x00, 0xF8, 0x07, 0x00,
+// '*'
+0x38, 0x80, 0x43, 0x38, 0x06, 0xF3, 0xF3, 0xFF, 0x7F, 0x1F, 0xF1, 0x3B, 0xF1, 0x0F, 0xFB, 0x38,
+0x8F, 0x43, 0x38, 0x00, 0x03,
+// '+'
+0x80, 0x01, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0xFE, 0xFF, 0xFF,
+0xFF, 0xFF, 0x3F, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03,
+// ','
+0x0F, 0xFF, 0xFF, 0xFF, 0xF7, 0x07,
+// '-'
+0xFF, 0xFF, 0xFF, 0x03,
+// '.'
+0xFF, 0xFF, 0x0F,
+// '/'
+0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x07, 0x00, 0xE0, 0x0F, 0x00, 0xF0, 0x0F,
+0x00, 0xF8, 0x07, 0x00, 0xFC, 0x03, 0x00, 0xFE, 0x01, 0x00, 0xFF, 0x00, 0x80, 0x7F, 0x00, 0xC0,
+0x3F, 0x00, 0xE0, 0x1F, 0x00, 0xF0, 0x0F, 0x00, 0xE0, 0x07, 0x00, 0xC0, 0x03, 0x00, 0x80, 0x01,
+0x00, 0x00,
+// '0'
+0xE0, 0xFF, 0x00, 0xFF, 0x7F, 0xF0, 0xFF, 0x1F, 0xFF, 0xFF, 0xF7, 0x07, 0xFC, 0x1F, 0x00, 0xFC,
+0x01, 0x00, 0x1F, 0x00, 0xC0, 0x07, 0x00, 0xFC, 0x01, 0xC0, 0xFF, 0x01, 0x7F, 0xFF, 0xFF, 0xC7,
+0xFF, 0x7F, 0xF0, 0xFF, 0x07, 0xF8, 0x3F, 0x00,
+// '1'
+0x0C, 0x00, 0x98, 0x01, 0x00, 0x33, 0x00, 0x60, 0x07, 0x00, 0xEC, 0x00, 0x80, 0xFD, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x60, 0x00, 0x00, 0x0C,
+0x00, 0x80, 0x01, 0x00, 0x30,
+// '2'
+0x06, 0x00, 0xDE, 0x00, 0xE0, 0x1F, 0x00, 0xFE, 0x03, 0xF0, 0x3F, 0x00, 0xBF, 0x07, 0xF0, 0xF1,
+0x00, 0x1F, 0x3E, 0xF0, 0xC1, 0xFF, 0x1F, 0xD8, 0xFF, 0x01, 0xFB, 0x1F, 0x60, 0xFE, 0x01, 0x0C,
+0x07, 0x80, 0x01,
+// '3'
+0x06, 0x00, 0xFC, 0xC0, 0x80, 0x1F, 0x18, 0xF0, 0x01, 0x03, 0x3C, 0x60, 0x80, 0x07, 0x0E, 0xF0,
+0xC1, 0x03, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xCF, 0xBF, 0xFF, 0xF1, 0xE3, 0x1F, 0x1C, 0xF8, 0x01,
+// '4'
+0x00, 0x60, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x01, 0x80, 0x3F, 0x00, 0xF8, 0x07, 0xC0, 0xCF, 0x00,
+0xFC, 0x18, 0xC0, 0x07, 0x03, 0x7E, 0x60, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0x01, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x03,
+// '5'
+0xFF, 0x03, 0xFC, 0x7F, 0x80, 0xFF, 0x0F, 0xF0, 0xFF, 0x01, 0x7C, 0x30, 0x80, 0x0F, 0x0E, 0xF0,
+0xC1, 0x03, 0x3F, 0xF8, 0xFD, 0x07, 0xFE, 0xEF, 0xC0, 0xFF, 0x1D, 0xF0, 0x1F, 0x00, 0xF8, 0x00,
+// '6'
+0x00, 0x0C, 0x00, 0xFC, 0x3F, 0xE0, 0xFF, 0x1F, 0xFE, 0xFF, 0xE7, 0xFF, 0xFF, 0x7C, 0x1C, 0xFE,
+0xC3, 0x01, 0x3F, 0x18, 0xC0, 0x03, 0x03, 0x78, 0xE0, 0x80, 0x0F, 0x3C, 0xF8, 0x83, 0xFF, 0x77,
+0xE0, 0xFF, 0x0C, 0xF8, 0x0F, 0x00, 0xFE, 0x00,
+// '7'
+0x07, 0x00, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x03, 0xC0, 0x7F, 0x00, 0xFE, 0x0F, 0xF0, 0xFF,
+0x81, 0xFF, 0x38, 0xF8, 0x03, 0xC7, 0x1F, 0xE0, 0xFE, 0x00, 0xFC, 0x07, 0x80, 0x3F, 0x00, 0xF0,
+0x03, 0x00, 0x1E, 0x00, 0x00,
+// '8'
+0x00, 0xC0, 0x01, 0x06, 0xFE, 0xF0, 0xE3, 0x3F, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0x3F, 0xF8,
+0xE1, 0x01, 0x1F, 0x78, 0xC0, 0x03, 0x0F, 0xF8, 0xF0, 0x83, 0xFF, 0xFF, 0xF9, 0xFF, 0xFE, 0xE7,
+0x8F, 0xFF, 0xF8, 0xE0, 0x0F, 0x00, 0xF8, 0x00,
+// '9'
+0xE0, 0x01, 0x00, 0xFF, 0x80, 0xF1, 0x3F, 0x70, 0xFF, 0x07, 0xFE, 0xFF, 0x81, 0x0F, 0x38, 0xF0,
+0x00, 0x06, 0x1E, 0xC0, 0xE0, 0x07, 0x18, 0xFC, 0x81, 0xE3, 0xFF, 0xBF, 0x3F, 0xFF, 0xFF, 0xC3,
+0xFF, 0x3F, 0xF0, 0xFF, 0x03, 0xF8, 0x0F, 0x00,
+// ':'
+0x0F, 0xF8, 0x07, 0xFC, 0x03, 0xFE, 0x01, 0xFF, 0x80, 0x07,
+// ';'
+0x0F, 0x78, 0xFC, 0x80, 0xFF, 0x0F, 0xF8, 0xFF, 0x80, 0x7F, 0x0F, 0xF8, 0x03,
+// '<'
+0x80, 0x00, 0x40, 0x00, 0x70, 0x00, 0x38, 0x00, 0x3E, 0x00, 0x1F, 0xC0, 0x1F, 0xE0, 0x0E, 0x38,
+0x0E, 0x1C, 0x07, 0x07, 0x87, 0x83, 0xE3, 0x80, 0x73, 0xC0, 0x1D, 0xC0, 0x0F, 0xE0,
+// '='
+0xE3, 0xF1, 0x78, 0x3C, 0x1E, 0x8F, 0xC7, 0xE3, 0xF1, 0x78, 0x3C, 0x1E, 0x8F, 0xC7,
+// '>'
+0x03, 0xE0, 0x03, 0xF8, 0x01, 0xDC, 0x01, 0xE7, 0x80, 0xE3, 0xE0, 0x70, 0x70, 0x70, 0x1C, 0x38,
+0x0E, 0xB8, 0x03, 0xDC, 0x01, 0x7C, 0x00, 0x3E, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x01,
+// '?'
+0x1E, 0x00, 0xE0, 0x03, 0x00, 0x7C, 0x00, 0x80, 0x01, 0x30, 0x3E, 0x80, 0xC7, 0x07, 0xF8, 0xF8,
+0x80, 0x1F, 0x1F, 0xF8, 0xE3, 0x87, 0x07, 0xE0, 0x7F, 0x00, 0xF8, 0x07, 0x00, 0x7F, 0x00, 0xC0,
+0x07, 0x00, 0x30, 0x00, 0x00,
+// '@'
+0x00, 0x3F, 0x00, 0xFC, 0x3F, 0xE0, 0xFF, 0x0F, 0xFE, 0xFF, 0xE3, 0x07, 0xF8, 0x3C, 0x00, 0xDC,
+0xE3, 0x3F, 0x3F, 0xFE, 0xEF, 0xE3, 0xFF, 0x79, 0x3E, 0x38, 0xCF, 0x01, 0xE7, 0x1B, 0xF8, 0xFE,
+0xE7, 0xCF, 0xFD, 0xFF, 0x9B, 0xFF, 0x7F, 0xC0, 0xFF, 0x0F,
+// 'A'
+0x00, 0x80, 0x03, 0x80, 0x0F, 0xC0, 0x3F, 0xC0, 0xFF, 0xE0, 0x7F, 0xF0, 0x7F, 0xF0, 0xBF, 0xC1,
+0x1F, 0x06, 0x1F, 0x18, 0xFC, 0x63, 0xF0, 0xFF, 0x01, 0xFF, 0x0F, 0xE0, 0xFF, 0x00, 0xFE, 0x0F,
+0xC0, 0x3F, 0x00, 0xFC,
+// 'B'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x0F, 0x0C, 0x3C, 0x30, 0xF0,
+0xE0, 0xC1, 0xC7, 0x07, 0xFF, 0x7F, 0xFE, 0xEF, 0xBF, 0x3F, 0x7F, 0x7C, 0xFC, 0x01, 0xE0, 0x03,
+// 'C'
+0xE0, 0x1F, 0xE0, 0xFF, 0xC1, 0xFF, 0x0F, 0xFF, 0x3F, 0x3E, 0xF8, 0x39, 0x80, 0x77, 0x00, 0xFC,
+0x01, 0xE0, 0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x07, 0x00, 0x1F, 0x00, 0x7E,
+0x00, 0x38,
+// 'D'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+0x00, 0xC0, 0x07, 0x80, 0x1F, 0x00, 0xFE, 0x01, 0x9E, 0xFF, 0x7F, 0xFE, 0xFF, 0xF0, 0xFF, 0x83,
+0xFF, 0x03,
+// 'E'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0C, 0x3C, 0x30, 0xF0,
+0xC0, 0xC0, 0x03, 0x03, 0x0F, 0x0C, 0x3C, 0x30, 0xF0, 0xC0, 0xC0, 0x03, 0x03, 0x0F, 0x00, 0x0C,
+// 'F'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0,
+0xC0, 0x00, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC0, 0x00, 0x03, 0x03, 0x00,
+// 'G'
+0x80, 0x07, 0xC0, 0xFF, 0x80, 0xFF, 0x07, 0xFF, 0x3F, 0xFE, 0xFF, 0xF9, 0xC0, 0xF7, 0x00, 0xFC,
+0x01, 0xE0, 0x07, 0x80, 0x0F, 0x18, 0x3C, 0x60, 0xF0, 0x80, 0xC1, 0x03, 0xFE, 0x1F, 0xF8, 0x7F,
+0xE0, 0xBF, 0x81, 0x7F,
+// 'H'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x0C, 0x00, 0x30, 0x00,
+0xC0, 0x00, 0x00, 0x03, 0x00, 0x0C, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0x3F,
+// 'I'
+0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0,
+// 'J'
+0x00, 0x80, 0x0F, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xF7, 0xFF, 0xCF, 0xFF, 0x07,
+// 'K'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0x80, 0x3F, 0x00, 0xFF, 0x01,
+0xBE, 0x1F, 0x7C, 0xFC, 0x7C, 0xE0, 0xF7, 0x00, 0xFE, 0x01, 0xF0, 0x03, 0x80, 0x07, 0x00, 0x0C,
+// 'L'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x0C, 0x00, 0x30,
+0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0,
+// 'M'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0x1F, 0x80, 0xFF, 0x03,
+0xF0, 0x0F, 0x00, 0x3E, 0x00, 0xFF, 0x80, 0xFF, 0xC1, 0xFF, 0x00, 0x7F, 0x00, 0xFC, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF,
+// 'N'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x07, 0x80, 0x7F, 0x00,
+0xF8, 0x07, 0x80, 0x3F, 0x00, 0xFC, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0x3F,
+// 'O'
+0xC0, 0x0F, 0xE0, 0xFF, 0xC1, 0xFF, 0x8F, 0xFF, 0x7F, 0xFE, 0xFF, 0x3D, 0x00, 0x7F, 0x00, 0xF8,
+0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0xF8, 0x03, 0xF0, 0xFE, 0xFF, 0xF9, 0xFF, 0xC7,
+0xFF, 0x0F, 0xFE, 0x1F,
+// 'P'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x18, 0x30, 0x60, 0xC0,
+0x80, 0x01, 0x03, 0x07, 0x1C, 0x1E, 0xF0, 0x3F, 0xC0, 0xFF, 0x00, 0xFE, 0x01, 0xF8, 0x07, 0x00,
+// 'Q'
+0xC0, 0x0F, 0x00, 0xFE, 0x1F, 0xC0, 0xFF, 0x0F, 0xF8, 0xFF, 0x07, 0xFE, 0xFF, 0xC1, 0x03, 0xF0,
+0x70, 0x00, 0x38, 0x0C, 0x00, 0x0C, 0x03, 0x00, 0xC3, 0x00, 0xC0, 0x71, 0x00, 0xF8, 0x3C, 0x00,
+0x3F, 0xFE, 0xFF, 0x9F, 0xFF, 0x7F, 0xC7, 0xFF, 0x8F, 0xE3, 0xFF, 0xE1,
+// 'R'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x06, 0x0C, 0x38, 0x30, 0xF0, 0xC1,
+0xC1, 0x0F, 0xCF, 0x7F, 0xFC, 0xEF, 0xE7, 0x1F, 0xBF, 0x7F, 0xF8, 0x7C, 0xC0, 0x03, 0x00, 0x0C,
+// 'S'
+0x7C, 0xC0, 0xF9, 0x03, 0xEE, 0x1F, 0xF8, 0x7F, 0xE0, 0xC7, 0x03, 0x0F, 0x0E, 0x3C, 0x38, 0xF0,
+0xE0, 0xC1, 0x03, 0x87, 0x0F, 0x3C, 0x7F, 0xF0, 0xDF, 0x81, 0x7F, 0x06, 0xFE, 0x00, 0xF0, 0x01,
+// 'T'
+0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0xF0, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x30,
+0x00, 0xC0, 0x00, 0x00,
+// 'U'
+0xFF, 0x1F, 0xFC, 0xFF, 0xF3, 0xFF, 0xDF, 0xFF, 0x7F, 0xFF, 0xFF, 0x03, 0x00, 0x0E, 0x00, 0x30,
+0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x0E, 0x00, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xF3,
+0xFF, 0x01,
+// 'V'
+0x07, 0x00, 0x7C, 0x00, 0xF0, 0x0F, 0xC0, 0xFF, 0x01, 0xFC, 0x1F, 0xC0, 0xFF, 0x03, 0xF8, 0x3F,
+0x80, 0xFF, 0x00, 0xF0, 0x03, 0xF0, 0x0F, 0xF0, 0x3F, 0xF8, 0x3F, 0xF8, 0x1F, 0xFC, 0x0F, 0xF0,
+0x0F, 0xC0, 0x07, 0x00,
+// 'W'
+0x7F, 0x00, 0xFC, 0xFF, 0xF0, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0xFF, 0x03, 0xF8, 0x0F, 0xFF, 0x3F,
+0xFC, 0x1F, 0xF0, 0x07, 0xC0, 0xFF, 0x01, 0xFF, 0x3F, 0xC0, 0xFF, 0x00, 0xFC, 0xE3, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0x07,
+// 'X'
+0x01, 0x00, 0x0E, 0x00, 0xFE, 0x00, 0xFC, 0x07, 0xF8, 0x3F, 0xF8, 0xF9, 0xF3, 0xC1, 0xFF, 0x03,
+0xFC, 0x07, 0xE0, 0x0F, 0x80, 0xFF, 0x80, 0xFF, 0x07, 0x1F, 0x3F, 0x3E, 0xF8, 0x7F, 0xC0, 0xFF,
+0x00, 0xFC, 0x00, 0xE0,
+// 'Y'
+0x01, 0x00, 0x1C, 0x00, 0xF0, 0x01, 0xC0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x07, 0x00, 0xFF, 0x3F,
+0xF8, 0xFF, 0x80, 0xFF, 0x03, 0xFF, 0x0F, 0xFE, 0x3F, 0x7E, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xF0,
+0x01, 0xC0, 0x01, 0x00,
+// 'Z'
+0x03, 0x80, 0x0F, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0xFE, 0x03, 0xFC, 0x0F, 0xF8, 0x3D, 0xF0, 0xF1,
+0xF0, 0xC3, 0xE3, 0x07, 0xCF, 0x0F, 0xBC, 0x0F, 0xF0, 0x1F, 0xC0, 0x3F, 0x00, 0x7F, 0x00, 0xFC,
+0x00, 0x30,
+// '['
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x38,
+0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x07,
+0x00, 0x00, 0x06,
+// '\\'
+0x03, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x07, 0x00, 0xC0, 0x3F, 0x00, 0x00,
+0xFE, 0x01, 0x00, 0xF0, 0x0F, 0x00, 0x80, 0x7F, 0x00, 0x00, 0xFC, 0x03, 0x00, 0xE0, 0x1F, 0x00,
+0x00, 0xFF, 0x00, 0x00, 0xF8, 0x07, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x70,
+// ']'
+0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38,
+0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0x07,
+// '^'
+0x00, 0x80, 0x01, 0xE0, 0x03, 0xF0, 0x07, 0xF8, 0x0F, 0xFE, 0x03, 0xFF, 0x81, 0xFF, 0x80, 0x3F,
+0x00, 0xFF, 0x01, 0xF0, 0x1F, 0x80, 0xFF, 0x00, 0xFC, 0x07, 0xC0, 0x1F, 0x00, 0x3E, 0x00, 0x70,
+// '_'
+0xFF, 0xFF, 0xFF, 0xFF,
+// '`'
+0x0F,
+// 'a'
+0x00, 0x1E, 0x83, 0x9F, 0xE1, 0xFF, 0xF0, 0x7F, 0xBC, 0x1F, 0x0E, 0x0F, 0x83, 0x87, 0xC1, 0xC7,
+0xF0, 0xFF, 0xDF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xC7, 0xFF, 0x03, 0x80, 0x01,
+// 'b'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x38, 0xC0, 0x81, 0x03, 0x38,
+0x30, 0x00, 0x06, 0x06, 0xC0, 0xC0, 0x01, 0x1C, 0x78, 0xE0, 0x03, 0xFF, 0x3F, 0xC0, 0xFF, 0x07,
+0xF8, 0x7F, 0x00, 0xFC, 0x03,
+// 'c'
+0xC0, 0x01, 0xFC, 0x07, 0xFF, 0xC7, 0xFF, 0xE7, 0xFF, 0xFB, 0xE0, 0x1F, 0xC0, 0x0F, 0xE0, 0x03,
+0xE0, 0x01, 0xF0, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x3F, 0x80, 0x1B, 0xC0, 0x00,
+// 'd'
+0x00, 0xFC, 0x01, 0xE0, 0xFF, 0x00, 0xFE, 0x3F, 0xC0, 0xFF, 0x0F, 0xFC, 0xF9, 0x81, 0x03, 0x38,
+0x30, 0x00, 0x06, 0x06, 0xC0, 0xC0, 0x00, 0x1C, 0x38, 0xC0, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+// 'e'
+0xE0, 0x03, 0xFC, 0x07, 0xFF, 0xC7, 0xFF, 0xE7, 0xFF, 0x7B, 0xC6, 0x1F, 0xC3, 0x87, 0xC1, 0xC3,
+0xE0, 0x63, 0xF0, 0x3F, 0xF8, 0x1F, 0xEC, 0x0F, 0xE7, 0x87, 0xC3, 0xC3, 0x00,
+// 'f'
+0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x03, 0x00, 0x60, 0x00, 0x80, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x18, 0x00, 0x04, 0x03, 0x80, 0x60, 0x00, 0x10,
+0x0C, 0x00, 0x82, 0x01, 0xC0, 0x30, 0x00, 0x00,
+// 'g'
+0xF0, 0x07, 0xC0, 0xFF, 0xC1, 0xFE, 0x3F, 0xEC, 0xFF, 0xC7, 0x3F, 0x7E, 0x78, 0x00, 0x87, 0x03,
+0x60, 0x38, 0x00, 0x86, 0x07, 0x70, 0x7C, 0x80, 0xC3, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF7, 0xFF, 0x3F, 0xFF, 0x7F, 0x00,
+// 'h'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x78, 0x00, 0x80, 0x07, 0x00,
+0x70, 0x00, 0x00, 0x06, 0x00, 0xC0, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0xFF, 0x7F, 0xE0, 0xFF, 0x0F,
+0xF8, 0xFF, 0x01, 0xFC, 0x3F,
+// 'i'
+0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x03, 0x00, 0x60, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x01, 0xC0,
+0xF0, 0xFF, 0x1F, 0xFE, 0xFF, 0xC3, 0xFF, 0x7F, 0xF8, 0xFF, 0x0F, 0x00, 0x00,
+// 'j'
+0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x0C, 0x0C, 0x00, 0x30, 0x30, 0x00, 0x80, 0xC0, 0x00, 0x00,
+0x02, 0x03, 0x00, 0x08, 0x0C, 0x00, 0xF0, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+0x3F, 0xFC, 0xFF, 0xDF, 0xF0, 0xFF, 0x1F,
+// 'k'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x07, 0x00, 0xF8, 0x01,
+0x80, 0x7F, 0x00, 0xF8, 0x1F, 0x80, 0xCF, 0x07, 0xF8, 0xF0, 0x03, 0x0F, 0x7C, 0xE0, 0x00, 0x0F,
+0x0C, 0xC0, 0x81, 0x00, 0x30,
+// 'l'
+0x01, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0x00, 0xC0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+// 'm'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x78, 0x00, 0x7C, 0x00, 0xFE, 0xFF, 0xFF,
+0x7F, 0xFF, 0xBF, 0x0F, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
+// 'n'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x78, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x03,
+0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xC7, 0xFF, 0x03,
+// 'o'
+0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xCF, 0xFF, 0xF7, 0xC1, 0x3F, 0x80, 0x0F, 0x80, 0x07, 0xC0, 0x03,
+0xE0, 0x03, 0xF8, 0x07, 0xDF, 0xFF, 0xE7, 0xFF, 0xE3, 0xFF, 0xE0, 0x3F, 0x00,
+// 'p'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x78, 0x70, 0x00, 0x07, 0x03,
+0x60, 0x30, 0x00, 0x06, 0x07, 0x70, 0xF0, 0xC0, 0x07, 0xFF, 0x7F, 0xE0, 0xFF, 0x03, 0xFE, 0x1F,
+0x80, 0x7F, 0x00,
+// 'q'
+0xF0, 0x0F, 0xC0, 0xFF, 0x01, 0xFE, 0x3F, 0xE0, 0xFF, 0x07, 0x1F, 0x7C, 0x70, 0x00, 0x07, 0x03,
+0x60, 0x30, 0x00, 0x06, 0x07, 0x70, 0x70, 0x80, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF,
+// 'r'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x03,
+0x80, 0x01, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0x00,
+// 's'
+0x38, 0x30, 0x3F, 0xB8, 0x1F, 0xFC, 0x1F, 0xFE, 0x0F, 0x1E, 0x07, 0x0F, 0x87, 0x87, 0xC3, 0xC3,
+0xF3, 0xC1, 0xFF, 0xE1, 0xEF, 0xF0, 0x67, 0xF0, 0x01,
+// 't'
+0x18, 0x00, 0x60, 0x00, 0x80, 0x01, 0x00, 0x06, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xF7, 0xFF, 0xFF,
+0xFF, 0xFF, 0x18, 0x80, 0x63, 0x00, 0x8C, 0x01, 0x30, 0x06, 0xC0, 0x18, 0x00, 0x63, 0x00, 0x8C,
+0x01, 0x30,
+// 'u'
+0xFF, 0x9F, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x07, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00,
+0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+// 'v'
+0x01, 0x80, 0x03, 0xC0, 0x0F, 0xE0, 0x1F, 0xE0, 0x7F, 0xC0, 0xFF, 0x80, 0xFF, 0x01, 0xFE, 0x00,
+0x7C, 0x80, 0x3F, 0xF0, 0x1F, 0xFF, 0xE3, 0x3F, 0xF8, 0x07, 0xFC, 0x00, 0x0E, 0x00,
+// 'w'
+0x3F, 0x80, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFC, 0x07, 0xFE, 0xF3, 0xFF, 0xFD, 0x0F, 0x7E,
+0x00, 0xFF, 0x83, 0xFF, 0x1F, 0xFE, 0x0F, 0xF0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+// 'x'
+0x01, 0xC0, 0x03, 0xF8, 0x03, 0xFE, 0x83, 0xFF, 0xF7, 0xF3, 0xFF, 0xE0, 0x1F, 0xE0, 0x0F, 0xF0,
+0x0F, 0xFE, 0x8F, 0xDF, 0xFF, 0xC3, 0xFF, 0x80, 0x1F, 0x80, 0x07, 0x80, 0x01,
+// 'y'
+0x01, 0x00, 0x70, 0x00, 0x80, 0x1F, 0x00, 0xF8, 0x0F, 0x80, 0xFF, 0x03, 0xCC, 0xFF, 0xE0, 0xE0,
+0xFF, 0x0F, 0xF8, 0xFF, 0x00, 0xFE, 0x07, 0xF0, 0x1F, 0xE0, 0x3F, 0x80, 0xFF, 0x00, 0xFE, 0x03,
+0xF0, 0x0F, 0x00, 0x1F, 0x00, 0x70, 0x00, 0x00,
+// 'z'
+0x00, 0xE0, 0x01, 0xF8, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x1F, 0x7C, 0x0F, 0x9F, 0xC7, 0xC7, 0xF3,
+0xE1, 0x7D, 0xF0, 0x1F, 0xF8, 0x07, 0xFC, 0x01, 0x7E, 0x00, 0x1F, 0x80, 0x01,
+// '{'
+0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0xC3, 0xC3, 0xE7,
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xF3, 0xFF, 0xC3, 0x81, 0xC3, 0x03, 0x00, 0x00, 0x07,
+0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x18,
+// '|'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+// '}'
+0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x3C, 0x18, 0x18, 0xFC,
+0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0x3E, 0x3C, 0x7C, 0x00, 0x30, 0x00, 0x00,
+0x60, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x01, 0x00,
+// '~'
+0xD8, 0xFF, 0x3F, 0xC6, 0x79, 0xCE, 0x73, 0x8C, 0xFF, 0x7F,
+};
+static const SSD1306_PackedGlyph_t Font16x26_glyphs[] = {
+{0, 0, 0, 0, 0}, // ' '
+{0, 6, 0, 5, 21}, // '!'
+{14, 3, 0, 11, 7}, // '"'
+{24, 0, 0, 16, 21}, // '#'
+{66, 2, 0, 13, 23}, // '$'
+{104, 0, 0, 16, 21}, // '%'
+{146, 0, 0, 16, 21}, // '&'
+{188, 6, 0, 5, 7}, // "'"
+{193, 4, 0, 12, 25}, // '('
+{231, 1, 0, 12, 25}, // ')'
+{269, 2, 0, 14, 12}, // '*'
+{290, 0, 6, 16, 15}, // '+'
+{320, 6, 17, 5, 9}, // ','
+{326, 2, 11, 13, 2}, // '-'
+{330, 6, 17, 5, 4}, // '.'
+{333, 0, 0, 16, 25}, // '/'
+{383, 1, 0, 15, 21}, // '0'
+{423, 2, 0, 14, 21}, // '1'
+{460, 2, 0, 13, 21}, // '2'
+{495, 3, 0, 12, 21}, // '3'
+{527, 0, 0, 16, 21}, // '4'
+{569, 3, 0, 12, 21}, // '5'
+{601, 1, 0, 15, 21}, // '6'
+{641, 2, 0, 14, 21}, // '7'
+{678, 1, 0, 15, 21}, // '8'
+{718, 1, 0, 15, 21}, // '9'
+{758, 6, 6, 5, 15}, // ':'
+{768, 6, 6, 5, 20}, // ';'
+{781, 0, 6, 16, 15}, // '<'
+{811, 0, 10, 16, 7}, // '='
+{825, 0, 6, 16, 15}, // '>'
+{855, 2, 0, 14, 21}, // '?'
+{892, 0, 0, 16, 21}, // '@'
+{934, 0, 3, 16, 18}, // 'A'
+{970, 2, 3, 14, 18}, // 'B'
+{1002, 1, 3, 15, 18}, // 'C'
+{1036, 1, 3, 15, 18}, // 'D'
+{1070, 2, 3, 14, 18}, // 'E'
+{1102, 3, 3, 13, 18}, // 'F'
+{1132, 0, 3, 16, 18}, // 'G'
+{1168, 1, 3, 15, 18}, // 'H'
+{1202, 2, 3, 12, 18}, // 'I'
+{1229, 2, 3, 12, 18}, // 'J'
+{1256, 2, 3, 14, 18}, // 'K'
+{1288, 2, 3, 12, 18}, // 'L'
+{1315, 0, 3, 16, 18}, // 'M'
+{1351, 1, 3, 15, 18}, // 'N'
+{1385, 0, 3, 16, 18}, // 'O'
+{1421, 2, 3, 14, 18}, // 'P'
+{1453, 0, 3, 16, 22}, // 'Q'
+{1497, 2, 3, 14, 18}, // 'R'
+{1529, 2, 3, 14, 18}, // 'S'
+{1561, 0, 3, 16, 18}, // 'T'
+{1597, 1, 3, 15, 18}, // 'U'
+{1631, 0, 3, 16, 18}, // 'V'
+{1667, 0, 3, 16, 18}, // 'W'
+{1703, 0, 3, 16, 18}, // 'X'
+{1739, 0, 3, 16, 18}, // 'Y'
+{1775, 1, 3, 15, 18}, // 'Z'
+{1809, 5, 0, 11, 25}, // '['
+{1844, 1, 0, 15, 25}, // '\\'
+{1891, 1, 0, 11, 25}, // ']'
+{1926, 1, 0, 15, 17}, // '^'
+{1958, 0, 21, 16, 2}, // '_'
+{1962, 8, 0, 4, 1}, // '`'
+{1963, 1, 6, 15, 15}, // 'a'
+{1992, 2, 0, 14, 21}, // 'b'
+{2029, 1, 6, 15, 15}, // 'c'
+{2058, 1, 0, 15, 21}, // 'd'
+{2098, 1, 6, 15, 15}, // 'e'
+{2127, 1, 0, 15, 21}, // 'f'
+{2167, 1, 6, 15, 20}, // 'g'
+{2205, 2, 0, 14, 21}, // 'h'
+{2242, 1, 0, 11, 21}, // 'i'
+{2271, 1, 0, 12, 26}, // 'j'
+{2310, 2, 0, 14, 21}, // 'k'
+{2347, 1, 0, 11, 21}, // 'l'
+{2376, 0, 6, 16, 15}, // 'm'
+{2406, 2, 6, 14, 15}, // 'n'
+{2433, 1, 6, 15, 15}, // 'o'
+{2462, 2, 6, 14, 20}, // 'p'
+{2497, 1, 6, 14, 20}, // 'q'
+{2532, 3, 6, 13, 15}, // 'r'
+{2557, 2, 6, 13, 15}, // 's'
+{2582, 1, 3, 15, 18}, // 't'
+{2616, 2, 6, 13, 15}, // 'u'
+{2641, 0, 6, 16, 15}, // 'v'
+{2671, 0, 6, 16, 15}, // 'w'
+{2701, 1, 6, 15, 15}, // 'x'
+{2730, 0, 6, 16, 20}, // 'y'
+{2770, 1, 6, 15, 15}, // 'z'
+{2799, 2, 0, 13, 25}, // '{'
+{2840, 7, 0, 3, 25}, // '|'
+{2850, 2, 0, 13, 25}, // '}'
+{2891, 0, 11, 16, 5}, // '~'
+};
+const SSD1306_Font_t Font_16x26 = {16, 26, NULL, NULL, NULL, Font16x26_glyphs, Font16x26_packed};
+#endif
+
+#ifdef SSD1306_INCLUDE_FONT_16x24
+static const uint8_t Font16x24_packed[] = {
+// '!'
+0xFF, 0x0F, 0xFC, 0xFF, 0x81, 0xFF, 0x3F, 0x70,
+// '"'
+0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x01,
+// '#'
+0xC0, 0x71, 0x00, 0x38, 0x0E, 0x00, 0xC7, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+0x70, 0x1C, 0x00, 0x8E, 0x03, 0xC0, 0x71, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+0x1C, 0x07, 0x80, 0xE3, 0x00, 0x70, 0x1C, 0x00,
+// '$'
+0xC0, 0x81, 0x03, 0x38, 0x70, 0x00, 0x07, 0x0E, 0x1C, 0xC7, 0x81, 0xE3, 0x38, 0x70, 0x1C, 0xC7,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xC7, 0x71, 0xE0, 0x38, 0x0E, 0x1C, 0xC7, 0x81,
+0x03, 0x07, 0x70, 0xE0, 0x00, 0x0E, 0x1C, 0x00,
+// '%'
+0x3F, 0x80, 0xE3, 0x07, 0x70, 0xFC, 0x00, 0x8E, 0x1F, 0x38, 0xF0, 0x03, 0x07, 0x7E, 0xE0, 0x00,
+0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x38, 0xF0, 0x03, 0x07, 0x7E, 0xE0, 0xC0, 0x8F,
+0x03, 0xF8, 0x71, 0x00, 0x3F, 0x0E, 0xE0, 0x07,
+// '&'
+0xF8, 0xF1, 0x03, 0x3F, 0x7E, 0xE0, 0xC7, 0x8F, 0x03, 0x07, 0x7E, 0xE0, 0xC0, 0x0F, 0x1C, 0xF8,
+0x71, 0x1C, 0x3F, 0x8E, 0xE3, 0xC7, 0x71, 0x1C, 0x07, 0x70, 0xE0, 0x00, 0x0E, 0x1C, 0xC0, 0x01,
+0x00, 0xC7, 0x01, 0xE0, 0x38, 0x00, 0x1C, 0x07,
+// "'"
+0xC7, 0x8F, 0x1F, 0xFF, 0xF1, 0xE3, 0x07,
+// '('
+0xC0, 0x7F, 0x00, 0xF8, 0x0F, 0x00, 0xFF, 0x01, 0x1C, 0xC0, 0x81, 0x03, 0x38, 0x70, 0x00, 0xC7,
+0x01, 0x00, 0x3F, 0x00, 0xE0, 0x07, 0x00, 0x1C,
+// ')'
+0x07, 0x00, 0xFC, 0x00, 0x80, 0x1F, 0x00, 0x70, 0x1C, 0xC0, 0x81, 0x03, 0x38, 0x70, 0x00, 0x07,
+0xF0, 0x1F, 0x00, 0xFE, 0x03, 0xC0, 0x7F, 0x00,
+// '*'
+0x38, 0x0E, 0x1C, 0x07, 0x8E, 0x03, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+0x7F, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x80, 0xE3, 0xC0, 0x71, 0xE0, 0x38, 0x00,
+// '+'
+0xC0, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+0x7F, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00,
+// ','
+0xC7, 0x8F, 0x1F, 0xFF, 0xF1, 0xE3, 0x07,
+// '-'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
+// '.'
+0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+// '/'
+0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0xC0, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x07, 0x80, 0x03, 0xC0,
+0x01, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x00,
+// '0'
+0xF8, 0xFF, 0x03, 0xFF, 0x7F, 0xE0, 0xFF, 0x8F, 0x03, 0x38, 0x7E, 0x00, 0xC7, 0x0F, 0xE0, 0xF8,
+0x81, 0x03, 0x3F, 0x70, 0xE0, 0x07, 0x0E, 0xFC, 0x38, 0x80, 0x1F, 0x07, 0xF0, 0xE3, 0x00, 0x8E,
+0xFF, 0x3F, 0xF0, 0xFF, 0x07, 0xFE, 0xFF, 0x00,
+// '1'
+0x38, 0x00, 0x1C, 0x07, 0x80, 0xE3, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+0x00, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x1C,
+// '2'
+0x38, 0x00, 0x1C, 0x07, 0x80, 0xE3, 0x00, 0xF0, 0x03, 0xC0, 0x7F, 0x00, 0xF8, 0x0F, 0x00, 0xFF,
+0x01, 0x1C, 0x3F, 0x80, 0xE3, 0x07, 0x70, 0xFC, 0xC0, 0x81, 0x1F, 0x38, 0xF0, 0x03, 0x07, 0x8E,
+0x1F, 0xC0, 0xF1, 0x03, 0x38, 0x7E, 0x00, 0x07,
+// '3'
+0x07, 0x80, 0xE3, 0x00, 0x70, 0x1C, 0x00, 0x8E, 0x03, 0x00, 0x7E, 0x00, 0xC0, 0x0F, 0x00, 0xF8,
+0x71, 0x00, 0x3F, 0x0E, 0xE0, 0xC7, 0x01, 0xFC, 0xC7, 0x81, 0xFF, 0x38, 0xF0, 0x1F, 0x07, 0x7E,
+0x00, 0x3F, 0x0E, 0xE0, 0xC7, 0x01, 0xFC, 0x00,
+// '4'
+0x00, 0x7E, 0x00, 0xC0, 0x0F, 0x00, 0xF8, 0x01, 0xE0, 0x38, 0x00, 0x1C, 0x07, 0x80, 0xE3, 0x00,
+0x0E, 0x1C, 0xC0, 0x81, 0x03, 0x38, 0x70, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+0x00, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00,
+// '5'
+0xFF, 0x81, 0xE3, 0x3F, 0x70, 0xFC, 0x07, 0x8E, 0xE3, 0x00, 0x7E, 0x1C, 0xC0, 0x8F, 0x03, 0xF8,
+0x71, 0x00, 0x3F, 0x0E, 0xE0, 0xC7, 0x01, 0xFC, 0x38, 0x80, 0x1F, 0x07, 0xF0, 0xE3, 0x00, 0x7E,
+0xE0, 0x3F, 0x0E, 0xFC, 0xC7, 0x81, 0xFF, 0x00,
+// '6'
+0xC0, 0xFF, 0x03, 0xF8, 0x7F, 0x00, 0xFF, 0x0F, 0x1C, 0x07, 0x8E, 0xE3, 0xC0, 0x71, 0x1C, 0xF8,
+0x81, 0x03, 0x3F, 0x70, 0xE0, 0x07, 0x0E, 0xFC, 0xC0, 0x81, 0x1F, 0x38, 0xF0, 0x03, 0x07, 0x0E,
+0x00, 0x3F, 0x00, 0xE0, 0x07, 0x00, 0xFC, 0x00,
+// '7'
+0x3F, 0x00, 0xE0, 0x07, 0x00, 0xFC, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0xC0,
+0x01, 0xFC, 0x3F, 0x80, 0xFF, 0x07, 0xF0, 0xFF, 0xC0, 0x01, 0x1C, 0x38, 0x80, 0x03, 0x07, 0xF0,
+0x1F, 0x00, 0xFE, 0x03, 0xC0, 0x7F, 0x00, 0x00,
+// '8'
+0xF8, 0xF1, 0x03, 0x3F, 0x7E, 0xE0, 0xC7, 0x8F, 0x03, 0x07, 0x7E, 0xE0, 0xC0, 0x0F, 0x1C, 0xF8,
+0x81, 0x03, 0x3F, 0x70, 0xE0, 0x07, 0x0E, 0xFC, 0xC0, 0x81, 0x1F, 0x38, 0xF0, 0x03, 0x07, 0x8E,
+0x1F, 0x3F, 0xF0, 0xE3, 0x07, 0x7E, 0xFC, 0x00,
+// '9'
+0xF8, 0x01, 0x00, 0x3F, 0x00, 0xE0, 0x07, 0x80, 0x03, 0x07, 0x7E, 0xE0, 0xC0, 0x0F, 0x1C, 0xF8,
+0x81, 0x03, 0x3F, 0x70, 0xE0, 0x07, 0x0E, 0xFC, 0xC0, 0x71, 0x1C, 0x38, 0x8E, 0x03, 0xC7, 0x81,
+0xFF, 0x07, 0xF0, 0xFF, 0x00, 0xFE, 0x1F, 0x00,
+// ':'
+0x3F, 0xFE, 0x1F, 0xFF, 0x8F, 0xFF, 0xC7, 0xFF, 0xE3, 0xFF, 0xF1, 0x03,
+// ';'
+0x3F, 0x8E, 0xFF, 0x38, 0xFE, 0xE3, 0xF8, 0x8F, 0x1F, 0x3F, 0x7E, 0xFC, 0xF8, 0x01,
+// '<'
+0x00, 0x0E, 0x00, 0xC0, 0x01, 0x00, 0x38, 0x00, 0xE0, 0x38, 0x00, 0x1C, 0x07, 0x80, 0xE3, 0x00,
+0x0E, 0xE0, 0xC0, 0x01, 0x1C, 0x38, 0x80, 0xE3, 0x00, 0x80, 0x1F, 0x00, 0xF0, 0x03, 0x00, 0x0E,
+// '='
+0xC7, 0x8F, 0x1F, 0x3F, 0x7E, 0xFC, 0xF8, 0xF1, 0xE3, 0xC7, 0x8F, 0x1F, 0x3F, 0x7E, 0xFC, 0xF8,
+0x71,
+// '>'
+0x07, 0x00, 0xFC, 0x00, 0x80, 0x1F, 0x00, 0x70, 0x1C, 0xC0, 0x81, 0x03, 0x38, 0x70, 0x00, 0x07,
+0x70, 0x1C, 0x00, 0x8E, 0x03, 0xC0, 0x71, 0x00, 0xC0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00,
+// '?'
+0x38, 0x00, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0xC0,
+0x01, 0x1C, 0x3F, 0x80, 0xE3, 0x07, 0x70, 0xFC, 0xC0, 0x01, 0x1C, 0x38, 0x80, 0x03, 0x07, 0x80,
+0x1F, 0x00, 0xF0, 0x03, 0x00, 0x7E, 0x00, 0x00,
+// '@'
+0x38, 0xF0, 0x03, 0x07, 0x7E, 0xE0, 0xC0, 0x8F, 0x03, 0x07, 0x7E, 0xE0, 0xC0, 0x0F, 0x1C, 0xF8,
+0x81, 0xFF, 0x3F, 0xF0, 0xFF, 0x07, 0xFE, 0xFF, 0x00, 0x80, 0x1F, 0x00, 0xF0, 0x03, 0x00, 0x8E,
+0xFF, 0x3F, 0xF0, 0xFF, 0x07, 0xFE, 0xFF, 0x00,
+// 'A'
+0xC0, 0xFF, 0x1F, 0xF8, 0xFF, 0x03, 0xFF, 0x7F, 0x1C, 0x38, 0x80, 0x03, 0x07, 0x70, 0xE0, 0xC0,
+0x01, 0x1C, 0x38, 0x80, 0x03, 0x07, 0x70, 0x00, 0x07, 0x0E, 0xE0, 0xC0, 0x01, 0x1C, 0x38, 0x00,
+0xFC, 0xFF, 0x81, 0xFF, 0x3F, 0xF0, 0xFF, 0x07,
+// 'B'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x07, 0x7E, 0xE0, 0xC0, 0x0F, 0x1C, 0xF8,
+0x81, 0x03, 0x3F, 0x70, 0xE0, 0x07, 0x0E, 0xFC, 0xC0, 0x81, 0x1F, 0x38, 0xF0, 0x03, 0x07, 0x8E,
+0x1F, 0x3F, 0xF0, 0xE3, 0x07, 0x7E, 0xFC, 0x00,
+// 'C'
+0xF8, 0xFF, 0x03, 0xFF, 0x7F, 0xE0, 0xFF, 0x8F, 0x03, 0x00, 0x7E, 0x00, 0xC0, 0x0F, 0x00, 0xF8,
+0x01, 0x00, 0x3F, 0x00, 0xE0, 0x07, 0x00, 0xFC, 0x00, 0x80, 0x1F, 0x00, 0xF0, 0x03, 0x00, 0x8E,
+0x03, 0x38, 0x70, 0x00, 0x07, 0x0E, 0xE0, 0x00,
+// 'D'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x7E, 0x00, 0xC0, 0x0F, 0x00, 0xF8,
+0x01, 0x00, 0x3F, 0x00, 0xE0, 0x07, 0x00, 0x1C, 0x07, 0x70, 0xE0, 0x00, 0x0E, 0x1C, 0xC0, 0x01,
+0xFC, 0x07, 0x80, 0xFF, 0x00, 0xF0, 0x1F, 0x00,
+// 'E'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x07, 0x7E, 0xE0, 0xC0, 0x0F, 0x1C, 0xF8,
+0x81, 0x03, 0x3F, 0x70, 0xE0, 0x07, 0x0E, 0xFC, 0xC0, 0x81, 0x1F, 0x38, 0xF0, 0x03, 0x07, 0x7E,
+0x00, 0xC0, 0x0F, 0x00, 0xF8, 0x01, 0x00, 0x07,
+// 'F'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x07, 0x70, 0xE0, 0x00, 0x0E, 0x1C, 0xC0,
+0x81, 0x03, 0x38, 0x70, 0x00, 0x07, 0x0E, 0xE0, 0xC0, 0x01, 0x1C, 0x38, 0x80, 0x03, 0x07, 0x70,
+0x00, 0x00, 0x0E, 0x00, 0xC0, 0x01, 0x00, 0x00,
+// 'G'
+0xF8, 0xFF, 0x03, 0xFF, 0x7F, 0xE0, 0xFF, 0x8F, 0x03, 0x00, 0x7E, 0x00, 0xC0, 0x0F, 0x00, 0xF8,
+0x81, 0x03, 0x3F, 0x70, 0xE0, 0x07, 0x0E, 0xFC, 0xC0, 0x81, 0x1F, 0x38, 0xF0, 0x03, 0x07, 0x8E,
+0xE3, 0xFF, 0x71, 0xFC, 0x3F, 0x8E, 0xFF, 0x07,
+// 'H'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00,
+0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0xC0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0xF0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+// 'I'
+0x07, 0x00, 0xFC, 0x00, 0x80, 0x1F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x01, 0x00, 0x3F, 0x00, 0xE0, 0x07, 0x00, 0x1C,
+// 'J'
+0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0xC0, 0x01, 0x00, 0xF8,
+0x01, 0x00, 0x3F, 0x00, 0xE0, 0x07, 0x00, 0xFC, 0xFF, 0x7F, 0xFC, 0xFF, 0x8F, 0xFF, 0xFF, 0x71,
+0x00, 0x00, 0x0E, 0x00, 0xC0, 0x01, 0x00, 0x00,
+// 'K'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00,
+0x70, 0x1C, 0x00, 0x8E, 0x03, 0xC0, 0x71, 0x00, 0x07, 0x70, 0xE0, 0x00, 0x0E, 0x1C, 0xC0, 0x71,
+0x00, 0xC0, 0x0F, 0x00, 0xF8, 0x01, 0x00, 0x07,
+// 'L'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x0E, 0x00, 0xC0, 0x01, 0x00, 0x38,
+0x00, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0E,
+0x00, 0xC0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07,
+// 'M'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1C, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00,
+0xF0, 0x03, 0x00, 0x7E, 0x00, 0xC0, 0x0F, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0xF0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+// 'N'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x80, 0x03, 0x00,
+0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0xC0, 0x01, 0x00, 0x38, 0xF0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+// 'O'
+0xF8, 0xFF, 0x03, 0xFF, 0x7F, 0xE0, 0xFF, 0x8F, 0x03, 0x00, 0x7E, 0x00, 0xC0, 0x0F, 0x00, 0xF8,
+0x01, 0x00, 0x3F, 0x00, 0xE0, 0x07, 0x00, 0xFC, 0x00, 0x80, 0x1F, 0x00, 0xF0, 0x03, 0x00, 0x8E,
+0xFF, 0x3F, 0xF0, 0xFF, 0x07, 0xFE, 0xFF, 0x00,
+// 'P'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x07, 0x70, 0xE0, 0x00, 0x0E, 0x1C, 0xC0,
+0x81, 0x03, 0x38, 0x70, 0x00, 0x07, 0x0E, 0xE0, 0xC0, 0x01, 0x1C, 0x38, 0x80, 0x03, 0x07, 0x80,
+0x1F, 0x00, 0xF0, 0x03, 0x00, 0x7E, 0x00, 0x00,
+// 'Q'
+0xF8, 0xFF, 0x03, 0xFF, 0x7F, 0xE0, 0xFF, 0x8F, 0x03, 0x00, 0x7E, 0x00, 0xC0, 0x0F, 0x00, 0xF8,
+0x01, 0x1C, 0x3F, 0x80, 0xE3, 0x07, 0x70, 0xFC, 0x00, 0x70, 0x1C, 0x00, 0x8E, 0x03, 0xC0, 0x81,
+0xFF, 0xC7, 0xF1, 0xFF, 0x38, 0xFE, 0x1F, 0x07,
+// 'R'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x07, 0x70, 0xE0, 0x00, 0x0E, 0x1C, 0xC0,
+0x81, 0x1F, 0x38, 0xF0, 0x03, 0x07, 0x7E, 0xE0, 0xC0, 0x71, 0x1C, 0x38, 0x8E, 0x03, 0xC7, 0x81,
+0x1F, 0xC0, 0xF1, 0x03, 0x38, 0x7E, 0x00, 0x07,
+// 'S'
+0xF8, 0x81, 0x03, 0x3F, 0x70, 0xE0, 0x07, 0x8E, 0x03, 0x07, 0x7E, 0xE0, 0xC0, 0x0F, 0x1C, 0xF8,
+0x81, 0x03, 0x3F, 0x70, 0xE0, 0x07, 0x0E, 0xFC, 0xC0, 0x81, 0x1F, 0x38, 0xF0, 0x03, 0x07, 0x8E,
+0x03, 0x3F, 0x70, 0xE0, 0x07, 0x0E, 0xFC, 0x00,
+// 'T'
+0x07, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0xC0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1C, 0x00, 0x80, 0x03, 0x00, 0x70,
+0x00, 0x00, 0x0E, 0x00, 0xC0, 0x01, 0x00, 0x00,
+// 'U'
+0xFF, 0xFF, 0xE3, 0xFF, 0x7F, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0xC0, 0x01, 0x00, 0x38,
+0x00, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0xFE,
+0xFF, 0x3F, 0xFE, 0xFF, 0xC7, 0xFF, 0xFF, 0x00,
+// 'V'
+0xFF, 0x7F, 0xE0, 0xFF, 0x0F, 0xFC, 0xFF, 0x01, 0x00, 0xC0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07,
+0x00, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0xC0, 0xF1,
+0xFF, 0x07, 0xFE, 0xFF, 0xC0, 0xFF, 0x1F, 0x00,
+// 'W'
+0xFF, 0xFF, 0xE3, 0xFF, 0x7F, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0xC0, 0x01, 0x00, 0x38,
+0x80, 0xFF, 0x00, 0xF0, 0x1F, 0x00, 0xFE, 0x03, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0xFE,
+0xFF, 0x3F, 0xFE, 0xFF, 0xC7, 0xFF, 0xFF, 0x00,
+// 'X'
+0x3F, 0x80, 0xFF, 0x07, 0xF0, 0xFF, 0x00, 0x7E, 0xE0, 0x38, 0x00, 0x1C, 0x07, 0x80, 0xE3, 0x00,
+0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0xC7, 0x01, 0xE0, 0x38, 0xF0,
+0x03, 0xF8, 0x7F, 0x00, 0xFF, 0x0F, 0xE0, 0x07,
+// 'Y'
+0xFF, 0x01, 0xE0, 0x3F, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00,
+0x00, 0xFC, 0x07, 0x80, 0xFF, 0x00, 0xF0, 0x1F, 0xC0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0xF0,
+0x1F, 0x00, 0xFE, 0x03, 0xC0, 0x7F, 0x00, 0x00,
+// 'Z'
+0x07, 0x80, 0xFF, 0x00, 0xF0, 0x1F, 0x00, 0xFE, 0x03, 0x38, 0x7E, 0x00, 0xC7, 0x0F, 0xE0, 0xF8,
+0x81, 0x03, 0x3F, 0x70, 0xE0, 0x07, 0x0E, 0xFC, 0x38, 0x80, 0x1F, 0x07, 0xF0, 0xE3, 0x00, 0xFE,
+0x03, 0xC0, 0x7F, 0x00, 0xF8, 0x0F, 0x00, 0x07,
+// '['
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x7E, 0x00, 0xC0, 0x0F, 0x00, 0xF8,
+0x01, 0x00, 0x3F, 0x00, 0xE0, 0x07, 0x00, 0x1C,
+// '\\'
+0x07, 0x80, 0x03, 0xC0, 0x01, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0x00, 0x07, 0x80, 0x03, 0xC0,
+0x01, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01,
+// ']'
+0x07, 0x00, 0xFC, 0x00, 0x80, 0x1F, 0x00, 0xF0, 0x03, 0x00, 0x7E, 0x00, 0xC0, 0x0F, 0x00, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
+// '^'
+0xC0, 0x81, 0x03, 0xC7, 0x81, 0x03, 0xC7, 0x81, 0x03, 0x07, 0x70, 0xE0, 0xC0, 0x01, 0x1C, 0x38,
+0x70,
+// '_'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
+// '`'
+0x07, 0x0E, 0x1C, 0xC0, 0x81, 0x03, 0x07, 0x70, 0xE0, 0xC0, 0x01,
+// 'a'
+0x00, 0x0E, 0x00, 0x07, 0x80, 0xE3, 0x38, 0x7E, 0x1C, 0x3F, 0x8E, 0x1F, 0xC7, 0x8F, 0xE3, 0xC7,
+0xF1, 0xE3, 0xF8, 0x71, 0xFC, 0x38, 0x8E, 0xFF, 0xC7, 0xFF, 0xE3, 0xFF, 0x01,
+// 'b'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x07, 0x0E, 0xE0, 0xC0, 0x01, 0x1C, 0x38,
+0x70, 0x00, 0x07, 0x0E, 0xE0, 0xC0, 0x01, 0x1C, 0x38, 0x80, 0x03, 0x07, 0x70, 0xE0, 0x00, 0x0E,
+0xE0, 0x3F, 0x00, 0xFC, 0x07, 0x80, 0xFF, 0x00,
+// 'c'
+0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0xE3, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x07,
+0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0x0E, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00,
+// 'd'
+0x00, 0xFE, 0x03, 0xC0, 0x7F, 0x00, 0xF8, 0x0F, 0xE0, 0x00, 0x0E, 0x1C, 0xC0, 0x81, 0x03, 0x38,
+0x70, 0x00, 0x07, 0x0E, 0xE0, 0xC0, 0x01, 0x1C, 0xC0, 0x81, 0x03, 0x38, 0x70, 0x00, 0x07, 0xFE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+// 'e'
+0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0xE3, 0x38, 0x7E, 0x1C, 0x3F, 0x8E, 0x1F, 0xC7, 0x8F, 0xE3, 0xC7,
+0xF1, 0xE3, 0xF8, 0x71, 0xFC, 0x38, 0x8E, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0x00,
+// 'f'
+0x00, 0x0E, 0x00, 0xC0, 0x01, 0x00, 0x38, 0x00, 0xFC, 0xFF, 0x8F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
+0x81, 0x03, 0x38, 0x70, 0x00, 0x07, 0x0E, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x80, 0x03, 0x00, 0x80,
+0x03, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x00,
+// 'g'
+0x38, 0x00, 0x1C, 0x00, 0x0E, 0xE0, 0x38, 0x7E, 0x1C, 0x3F, 0x8E, 0x1F, 0xC7, 0x8F, 0xE3, 0xC7,
+0xF1, 0xE3, 0xF8, 0x71, 0xFC, 0x38, 0xFE, 0xFF, 0xF8, 0x7F, 0xFC, 0x3F, 0x00,
+// 'h'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00,
+0x70, 0x00, 0x00, 0x0E, 0x00, 0xC0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x00,
+0xE0, 0xFF, 0x01, 0xFC, 0x3F, 0x80, 0xFF, 0x07,
+// 'i'
+0x00, 0x0E, 0x1C, 0xC0, 0x81, 0x03, 0x38, 0xF0, 0xE3, 0xFF, 0x7F, 0xFC, 0xFF, 0x8F, 0xFF, 0x3F,
+0x00, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x1C,
+// 'j'
+0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0xC0, 0x01, 0x00, 0x38,
+0x70, 0x00, 0x07, 0x0E, 0xE0, 0xC0, 0x01, 0xFC, 0xF8, 0x7F, 0x1C, 0xFF, 0x8F, 0xE3, 0xFF, 0x01,
+// 'k'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0xE0, 0x00,
+0x80, 0xE3, 0x00, 0x70, 0x1C, 0x00, 0x8E, 0x03, 0x38, 0x80, 0x03, 0x07, 0x70, 0xE0, 0x00, 0x0E,
+// 'l'
+0x07, 0x00, 0xFC, 0x00, 0x80, 0x1F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+0x00, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x1C,
+// 'm'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x70, 0x00, 0x38, 0x00, 0xE0, 0xFF, 0xF1, 0xFF, 0xF8,
+0xFF, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x80, 0xFF, 0xC7, 0xFF, 0xE3, 0xFF, 0x01,
+// 'n'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x07, 0x80, 0x03, 0xC0, 0x01, 0x1C, 0x00, 0x0E, 0x00, 0x07,
+0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x80, 0xFF, 0xC7, 0xFF, 0xE3, 0xFF, 0x01,
+// 'o'
+0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0xE3, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x07,
+0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0x8E, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0x00,
+// 'p'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x70, 0x1C, 0x38, 0x0E, 0x1C, 0x07, 0x8E, 0x03, 0xC7,
+0x81, 0xE3, 0xC0, 0x71, 0xE0, 0x38, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x00,
+// 'q'
+0x38, 0x00, 0x1C, 0x00, 0x0E, 0xE0, 0x38, 0x70, 0x1C, 0x38, 0x0E, 0x1C, 0x07, 0x8E, 0x03, 0xC7,
+0x01, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+// 'r'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x07, 0x80, 0x03, 0xC0, 0x01, 0x1C, 0x00, 0x0E, 0x00, 0x07,
+0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x00,
+// 's'
+0x38, 0x70, 0x1C, 0x38, 0x0E, 0xFC, 0x38, 0x7E, 0x1C, 0x3F, 0x8E, 0x1F, 0xC7, 0x8F, 0xE3, 0xC7,
+0xF1, 0xE3, 0xF8, 0x71, 0xFC, 0x38, 0x0E, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00,
+// 't'
+0xC0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0x80, 0xFF, 0xFF, 0xF1, 0xFF, 0x3F, 0xFE, 0xFF, 0x07,
+0x70, 0x00, 0x07, 0x0E, 0xE0, 0xC0, 0x01, 0x1C, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0E,
+0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0xE0, 0x00,
+// 'u'
+0xFF, 0x8F, 0xFF, 0xC7, 0xFF, 0x03, 0x00, 0x0E, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00,
+0x70, 0x00, 0x07, 0x80, 0x03, 0xC0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+// 'v'
+0xFF, 0x81, 0xFF, 0xC0, 0x7F, 0x00, 0xC0, 0x01, 0xE0, 0x00, 0x70, 0x00, 0xC0, 0x01, 0xE0, 0x00,
+0x70, 0x00, 0x07, 0x80, 0x03, 0xC0, 0xF1, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0x00,
+// 'w'
+0xFF, 0x8F, 0xFF, 0xC7, 0xFF, 0x03, 0x00, 0x0E, 0x00, 0x07, 0x80, 0x03, 0x3F, 0x80, 0x1F, 0xC0,
+0x0F, 0x00, 0x38, 0x00, 0x1C, 0x00, 0xFE, 0xFF, 0xF8, 0x7F, 0xFC, 0x3F, 0x00,
+// 'x'
+0x07, 0xF0, 0x03, 0xF8, 0x01, 0x1C, 0xC7, 0x81, 0xE3, 0xC0, 0x71, 0x00, 0x07, 0x80, 0x03, 0xC0,
+0x01, 0x1C, 0x07, 0x8E, 0x03, 0xC7, 0x71, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x01,
+// 'y'
+0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0x00, 0x38, 0x0E, 0x1C, 0x07, 0x8E, 0x03, 0xC7, 0x81, 0xE3, 0xC0,
+0x71, 0xE0, 0x38, 0x70, 0x1C, 0x38, 0xFE, 0xFF, 0xF8, 0x7F, 0xFC, 0x3F, 0x00,
+// 'z'
+0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xC7, 0x8F, 0xE3, 0xC7,
+0xF1, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0x7E, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x01,
+// '{'
+0x00, 0x0E, 0x00, 0xC0, 0x01, 0x00, 0x38, 0x00, 0xFC, 0xF8, 0x81, 0x1F, 0x3F, 0xF0, 0xE3, 0xC7,
+0x01, 0x00, 0x3F, 0x00, 0xE0, 0x07, 0x00, 0x1C,
+// '|'
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+// '}'
+0x07, 0x00, 0xFC, 0x00, 0x80, 0x1F, 0x00, 0x70, 0xFC, 0xF8, 0x81, 0x1F, 0x3F, 0xF0, 0xE3, 0x07,
+0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00,
+// '~'
+0x38, 0x8E, 0x1F, 0xC7, 0x71, 0x1C, 0x07, 0x8E, 0xE3, 0xC7, 0x71, 0x00,
+};
+static const SSD1306_PackedGlyph_t Font16x24_glyphs[] = {
+{0, 0, 0, 0, 0}, // ' '
+{0, 6, 0, 3, 21}, // '!'
+{8, 3, 0, 9, 9}, // '"'
+{19, 0, 0, 15, 21}, // '#'
+{59, 0, 0, 15, 21}, // '$'
+{99, 0, 0, 15, 21}, // '%'
+{139, 0, 0, 15, 21}, // '&'
+{179, 6, 0, 6, 9}, // "'"
+{186, 3, 0, 9, 21}, // '('
+{210, 3, 0, 9, 21}, // ')'
+{234, 0, 3, 15, 15}, // '*'
+{263, 0, 3, 15, 15}, // '+'
+{292, 6, 12, 6, 9}, // ','
+{299, 0, 9, 15, 3}, // '-'
+{305, 6, 15, 6, 6}, // '.'
+{310, 0, 3, 15, 15}, // '/'
+{339, 0, 0, 15, 21}, // '0'
+{379, 3, 0, 9, 21}, // '1'
+{403, 0, 0, 15, 21}, // '2'
+{443, 0, 0, 15, 21}, // '3'
+{483, 0, 0, 15, 21}, // '4'
+{523, 0, 0, 15, 21}, // '5'
+{563, 0, 0, 15, 21}, // '6'
+{603, 0, 0, 15, 21}, // '7'
+{643, 0, 0, 15, 21}, // '8'
+{683, 0, 0, 15, 21}, // '9'
+{723, 3, 3, 6, 15}, // ':'
+{735, 3, 3, 6, 18}, // ';'
+{749, 0, 0, 12, 21}, // '<'
+{781, 0, 6, 15, 9}, // '='
+{798, 0, 0, 12, 21}, // '>'
+{830, 0, 0, 15, 21}, // '?'
+{870, 0, 0, 15, 21}, // '@'
+{910, 0, 0, 15, 21}, // 'A'
+{950, 0, 0, 15, 21}, // 'B'
+{990, 0, 0, 15, 21}, // 'C'
+{1030, 0, 0, 15, 21}, // 'D'
+{1070, 0, 0, 15, 21}, // 'E'
+{1110, 0, 0, 15, 21}, // 'F'
+{1150, 0, 0, 15, 21}, // 'G'
+{1190, 0, 0, 15, 21}, // 'H'
+{1230, 3, 0, 9, 21}, // 'I'
+{1254, 0, 0, 15, 21}, // 'J'
+{1294, 0, 0, 15, 21}, // 'K'
+{1334, 0, 0, 15, 21}, // 'L'
+{1374, 0, 0, 15, 21}, // 'M'
+{1414, 0, 0, 15, 21}, // 'N'
+{1454, 0, 0, 15, 21}, // 'O'
+{1494, 0, 0, 15, 21}, // 'P'
+{1534, 0, 0, 15, 21}, // 'Q'
+{1574, 0, 0, 15, 21}, // 'R'
+{1614, 0, 0, 15, 21}, // 'S'
+{1654, 0, 0, 15, 21}, // 'T'
+{1694, 0, 0, 15, 21}, // 'U'
+{1734, 0, 0, 15, 21}, // 'V'
+{1774, 0, 0, 15, 21}, // 'W'
+{1814, 0, 0, 15, 21}, // 'X'
+{1854, 0, 0, 15, 21}, // 'Y'
+{1894, 0, 0, 15, 21}, // 'Z'
+{1934, 3, 0, 9, 21}, // '['
+{1958, 0, 3, 15, 15}, // '\\'
+{1987, 3, 0, 9, 21}, // ']'
+{2011, 0, 0, 15, 9}, // '^'
+{2028, 0, 18, 15, 3}, // '_'
+{2034, 3, 0, 9, 9}, // '`'
+{2045, 0, 6, 15, 15}, // 'a'
+{2074, 0, 0, 15, 21}, // 'b'
+{2114, 0, 6, 15, 15}, // 'c'
+{2143, 0, 0, 15, 21}, // 'd'
+{2183, 0, 6, 15, 15}, // 'e'
+{2212, 0, 0, 15, 21}, // 'f'
+{2252, 0, 6, 15, 15}, // 'g'
+{2281, 0, 0, 15, 21}, // 'h'
+{2321, 3, 0, 9, 21}, // 'i'
+{2345, 3, 0, 12, 21}, // 'j'
+{2377, 0, 0, 12, 21}, // 'k'
+{2409, 6, 0, 9, 21}, // 'l'
+{2433, 0, 6, 15, 15}, // 'm'
+{2462, 0, 6, 15, 15}, // 'n'
+{2491, 0, 6, 15, 15}, // 'o'
+{2520, 0, 6, 15, 15}, // 'p'
+{2549, 0, 6, 15, 15}, // 'q'
+{2578, 0, 6, 15, 15}, // 'r'
+{2607, 0, 6, 15, 15}, // 's'
+{2636, 0, 0, 15, 21}, // 't'
+{2676, 0, 6, 15, 15}, // 'u'
+{2705, 0, 6, 15, 15}, // 'v'
+{2734, 0, 6, 15, 15}, // 'w'
+{2763, 0, 6, 15, 15}, // 'x'
+{2792, 0, 6, 15, 15}, // 'y'
+{2821, 0, 6, 15, 15}, // 'z'
+{2850, 3, 0, 9, 21}, // '{'
+{2874, 6, 0, 3, 21}, // '|'
+{2882, 3, 0, 9, 21}, // '}'
+{2906, 0, 6, 15, 6}, // '~'
+};
+const SSD1306_Font_t Font_16x24 = {16, 24, NULL, NULL, NULL, Font16x24_glyphs, Font16x24_packed};
+#endif
+
+#ifdef SSD1306_INCLUDE_FONT_16x15
+static const uint8_t Font16x15_packed[] = {
+// '!'
+0xFF, 0x04,
+// '"'
+0x3F,
+// '#'
+0x80, 0x40, 0x34, 0x7E, 0x1E, 0x81, 0x68, 0xFC, 0x3C, 0x02, 0x11,
+// '$'
+0x1C, 0x46, 0x04, 0x0D, 0x61, 0x21, 0x24, 0x84, 0x18, 0x0F,
+// '%'
+0x1F, 0x88, 0x50, 0x64, 0x9C, 0x00, 0x03, 0xC6, 0x09, 0x11, 0x88, 0xC0, 0x07,
+// '&'
+0xCC, 0x93, 0x61, 0x0C, 0x93, 0x68, 0x48, 0x80, 0x01, 0x17, 0x80,
+// "'"
+0x07,
+// '('
+0xFC, 0x1F, 0x01, 0x50, 0x00, 0x10,
+// ')'
+0x01, 0x40, 0x01, 0x10, 0x8F, 0x07, 0x38, 0x00,
+// '*'
+0x04, 0xFE, 0x60, 0x28, 0x01,
+// '+'
+0x10, 0x20, 0x40, 0xF8, 0x0F, 0x01, 0x02, 0x04, 0x08,
+// ','
+0x07,
+// '-'
+0x0F,
+// '.'
+0x01,
+// '/'
+0x00, 0x0F, 0x0E, 0x1C, 0x30, 0x00,
+// '0'
+0xFE, 0x0B, 0x60, 0x00, 0x03, 0x18, 0x40, 0xFF, 0x01,
+// '1'
+0x02, 0x10, 0x40, 0x00, 0xFE, 0x0F,
+// '2'
+0x06, 0x0E, 0x68, 0x20, 0x83, 0x18, 0x43, 0x07, 0x02,
+// '3'
+0x06, 0x0B, 0x60, 0x08, 0x43, 0x18, 0x46, 0xEF, 0x01,
+// '4'
+0x80, 0x01, 0x0A, 0x4C, 0x18, 0x22, 0x90, 0xFF, 0x03, 0x04, 0x20,
+// '5'
+0x2E, 0x89, 0x50, 0x04, 0x23, 0x18, 0xC1, 0xF0, 0x01,
+// '6'
+0xFC, 0x93, 0xA0, 0x04, 0x23, 0x18, 0x41, 0xF0, 0x01,
+// '7'
+0x01, 0x08, 0x40, 0x80, 0x03, 0x13, 0x86, 0x0E, 0x0C, 0x00,
+// '8'
+0xDE, 0x0B, 0x63, 0x08, 0x43, 0x18, 0x46, 0xEF, 0x01,
+// '9'
+0x3E, 0x08, 0x62, 0x10, 0x83, 0x18, 0x24, 0xFF, 0x00,
+// ':'
+0x81,
+// ';'
+0x81, 0x03,
+// '<'
+0x08, 0x0A, 0x45, 0x24, 0x0A, 0x02,
+// '='
+0x99, 0x99, 0x99,
+// '>'
+0x41, 0x91, 0x88, 0x42, 0x41, 0x00,
+// '?'
+0x06, 0x08, 0x40, 0x30, 0x43, 0xE0, 0x01,
+// '@'
+0xF8, 0x83, 0x80, 0x08, 0x20, 0xF1, 0x18, 0x21, 0x13, 0x64, 0x82, 0xCC, 0x4F, 0x01, 0x42, 0x40,
+0x18, 0x0C, 0x7C, 0x00,
+// 'A'
+0x00, 0x06, 0x0A, 0x2E, 0x0E, 0x31, 0x08, 0x4E, 0x80, 0x03, 0x60, 0x00, 0x04,
+// 'B'
+0xFF, 0x0F, 0x61, 0x08, 0x43, 0x18, 0xC2, 0x29, 0x32, 0x0F,
+// 'C'
+0xFC, 0x11, 0x50, 0x00, 0x03, 0x18, 0xC0, 0x00, 0x0A, 0x88, 0x20,
+// 'D'
+0xFF, 0x0F, 0x60, 0x00, 0x03, 0x18, 0x40, 0x83, 0xE1, 0x03,
+// 'E'
+0xFF, 0x0F, 0x61, 0x08, 0x43, 0x18, 0xC2, 0x00, 0x02,
+// 'F'
+0xFF, 0x0F, 0x41, 0x08, 0x42, 0x10, 0x82, 0x00, 0x00,
+// 'G'
+0xFC, 0x11, 0x50, 0x00, 0x03, 0x18, 0xC4, 0x20, 0x0A, 0x91, 0x78,
+// 'H'
+0xFF, 0x07, 0x01, 0x08, 0x40, 0x00, 0x02, 0x10, 0xFC, 0x1F,
+// 'I'
+0xFF, 0x07,
+// 'J'
+0x80, 0x03, 0x20, 0x00, 0x01, 0x08, 0xA0, 0xFF, 0x00,
+// 'K'
+0xFF, 0x87, 0x00, 0x1A, 0x08, 0x21, 0x90, 0x00, 0x05, 0x10,
+// 'L'
+0xFF, 0x07, 0x20, 0x00, 0x01, 0x08, 0x40,
+// 'M'
+0xFF, 0xC7, 0x01, 0x30, 0x00, 0x06, 0x60, 0xC0, 0xC0, 0x81, 0x01, 0xFF, 0x07,
+// 'N'
+0xFF, 0x67, 0x00, 0x04, 0xC0, 0x00, 0x08, 0x80, 0xFD, 0x1F,
+// 'O'
+0xFC, 0x11, 0x50, 0x00, 0x03, 0x18, 0xC0, 0x00, 0x0A, 0x88, 0x3F,
+// 'P'
+0xFF, 0x0F, 0x42, 0x10, 0x82, 0x10, 0x84, 0x20, 0xF8, 0x00,
+// 'Q'
+0xFC, 0x41, 0x40, 0x04, 0x90, 0x00, 0x12, 0x40, 0x02, 0x88, 0x80, 0xE2, 0x8F,
+// 'R'
+0xFF, 0x0F, 0x42, 0x10, 0x82, 0x10, 0x1A, 0x0F, 0x01, 0x10,
+// 'S'
+0x0E, 0x8B, 0x60, 0x04, 0x63, 0x18, 0xC2, 0x10, 0x1A, 0x0F,
+// 'T'
+0x01, 0x08, 0x40, 0x00, 0x02, 0xF0, 0xFF, 0x00, 0x04, 0x20, 0x00, 0x01, 0x00,
+// 'U'
+0xFF, 0x01, 0x10, 0x00, 0x01, 0x08, 0x40, 0x00, 0x02, 0xE8, 0x3F,
+// 'V'
+0x03, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x60, 0xE0, 0xE0, 0xC0, 0x00, 0x01, 0x00,
+// 'W'
+0x1F, 0x00, 0x0F, 0x80, 0x81, 0xC3, 0x83, 0x01, 0x38, 0x00, 0x1E, 0x00, 0x01, 0x3C, 0x1E, 0x0E,
+0x00,
+// 'X'
+0x01, 0x14, 0x10, 0x63, 0xA0, 0x00, 0x03, 0x64, 0x18, 0x24, 0xC0, 0x00, 0x04,
+// 'Y'
+0x01, 0x30, 0x00, 0x06, 0x40, 0x00, 0x7E, 0x08, 0x30, 0x60, 0x00, 0x01, 0x00,
+// 'Z'
+0x01, 0x0F, 0x64, 0x10, 0x63, 0x98, 0xC0, 0x03, 0x06, 0x10,
+// '['
+0xFF, 0x7F, 0x00, 0x08,
+// '\\'
+0x03, 0xC0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x0C,
+// ']'
+0x01, 0xE0, 0xFF, 0x0F,
+// '^'
+0x7C, 0x18, 0x0C,
+// '_'
+0x3F,
+// '`'
+0x09,
+// 'a'
+0x72, 0x89, 0x89, 0x89, 0x49, 0xFE,
+// 'b'
+0xFF, 0x47, 0x20, 0x02, 0x11, 0x88, 0x40, 0xF8, 0x01,
+// 'c'
+0x7E, 0x81, 0x81, 0x81, 0x81, 0x46,
+// 'd'
+0xF0, 0x43, 0x20, 0x02, 0x11, 0x88, 0xC0, 0xFF, 0x03,
+// 'e'
+0x3E, 0x49, 0x89, 0x89, 0x89, 0x8E,
+// 'f'
+0xFC, 0x2F, 0x01, 0x11, 0x10, 0x00,
+// 'g'
+0x7E, 0x0A, 0x64, 0x20, 0x03, 0x19, 0xE8, 0xFF, 0x00,
+// 'h'
+0xFF, 0x87, 0x00, 0x02, 0x10, 0x80, 0x00, 0xF8, 0x03,
+// 'i'
+0xF9, 0x07,
+// 'j'
+0x00, 0x20, 0x00, 0x98, 0xFF, 0x01,
+// 'k'
+0xFF, 0x07, 0x02, 0x28, 0x20, 0x82, 0x20, 0x04, 0x02,
+// 'l'
+0xFF, 0x07,
+// 'm'
+0xFF, 0x02, 0x01, 0x01, 0x01, 0xFE, 0x02, 0x01, 0x01, 0x01, 0xFE,
+// 'n'
+0xFF, 0x02, 0x01, 0x01, 0x01, 0xFE,
+// 'o'
+0x7E, 0x81, 0x81, 0x81, 0x81, 0x7E,
+// 'p'
+0xFF, 0x0F, 0x44, 0x20, 0x02, 0x11, 0x08, 0x3F, 0x00,
+// 'q'
+0x7E, 0x08, 0x44, 0x20, 0x02, 0x11, 0x88, 0xFF, 0x03,
+// 'r'
+0xFF, 0x02, 0x01, 0x01,
+// 's'
+0x46, 0x89, 0x89, 0x91, 0x72,
+// 't'
+0x04, 0xFC, 0x47, 0x20, 0x81,
+// 'u'
+0x7F, 0x80, 0x80, 0x80, 0x80, 0xFF,
+// 'v'
+0x03, 0x1C, 0x60, 0xC0, 0x38, 0x06, 0x01,
+// 'w'
+0x03, 0x3C, 0xC0, 0x70, 0x0E, 0x07, 0x38, 0xC0, 0x78, 0x07, 0x01,
+// 'x'
+0x81, 0x42, 0x3C, 0x18, 0x26, 0xC1, 0x81,
+// 'y'
+0x03, 0xE0, 0x20, 0x98, 0x81, 0x83, 0x03, 0x03, 0x04, 0x00,
+// 'z'
+0xE1, 0x91, 0x89, 0x85, 0x83, 0x80,
+// '{'
+0x80, 0x00, 0xBF, 0x5F, 0x00, 0x30, 0x00, 0x08,
+// '|'
+0xFF, 0x1F,
+// '}'
+0x01, 0x40, 0x03, 0x18, 0xDE, 0x03, 0x10, 0x00,
+// '~'
+0x4E, 0x64, 0x72,
+};
+static const SSD1306_PackedGlyph_t Font16x15_glyphs[] = {
+{0, 0, 0, 0, 0}, // ' '
+{0, 3, 1, 1, 11}, // '!'
+{2, 3, 1, 2, 3}, // '"'
+{3, 2, 1, 8, 11}, // '#'
+{14, 3, 0, 6, 13}, // '$'
+{24, 3, 1, 9, 11}, // '%'
+{37, 3, 1, 8, 11}, // '&'
+{48, 2, 1, 1, 3}, // "'"
+{49, 3, 0, 3, 15}, // '('
+{55, 2, 0, 4, 15}, // ')'
+{63, 2, 1, 6, 6}, // '*'
+{68, 2, 3, 8, 9}, // '+'
+{77, 3, 11, 1, 3}, // ','
+{78, 2, 7, 4, 1}, // '-'
+{79, 3, 11, 1, 1}, // '.'
+{80, 3, 1, 4, 12}, // '/'
+{86, 3, 1, 6, 11}, // '0'
+{95, 3, 1, 4, 11}, // '1'
+{101, 3, 1, 6, 11}, // '2'
+{110, 3, 1, 6, 11}, // '3'
+{119, 2, 1, 8, 11}, // '4'
+{130, 3, 1, 6, 11}, // '5'
+{139, 3, 1, 6, 11}, // '6'
+{148, 2, 1, 7, 11}, // '7'
+{158, 3, 1, 6, 11}, // '8'
+{167, 3, 1, 6, 11}, // '9'
+{176, 3, 4, 1, 8}, // ':'
+{177, 3, 4, 1, 10}, // ';'
+{179, 3, 4, 6, 7}, // '<'
+{185, 3, 5, 6, 4}, // '='
+{188, 3, 4, 6, 7}, // '>'
+{194, 3, 1, 5, 11}, // '?'
+{201, 3, 2, 12, 13}, // '@'
+{221, 2, 1, 9, 11}, // 'A'
+{234, 3, 1, 7, 11}, // 'B'
+{244, 3, 1, 8, 11}, // 'C'
+{255, 4, 1, 7, 11}, // 'D'
+{265, 4, 1, 6, 11}, // 'E'
+{274, 4, 1, 6, 11}, // 'F'
+{283, 3, 1, 8, 11}, // 'G'
+{294, 4, 1, 7, 11}, // 'H'
+{304, 4, 1, 1, 11}, // 'I'
+{306, 3, 1, 6, 11}, // 'J'
+{315, 4, 1, 7, 11}, // 'K'
+{325, 4, 1, 5, 11}, // 'L'
+{332, 4, 1, 9, 11}, // 'M'
+{345, 4, 1, 7, 11}, // 'N'
+{355, 3, 1, 8, 11}, // 'O'
+{366, 3, 1, 7, 11}, // 'P'
+{376, 3, 1, 8, 13}, // 'Q'
+{389, 4, 1, 7, 11}, // 'R'
+{399, 3, 1, 7, 11}, // 'S'
+{409, 2, 1, 9, 11}, // 'T'
+{422, 3, 1, 8, 11}, // 'U'
+{433, 2, 1, 9, 11}, // 'V'
+{446, 3, 1, 12, 11}, // 'W'
+{463, 2, 1, 9, 11}, // 'X'
+{476, 2, 1, 9, 11}, // 'Y'
+{489, 3, 1, 7, 11}, // 'Z'
+{499, 3, 0, 2, 14}, // '['
+{503, 2, 1, 5, 12}, // '\\'
+{511, 1, 0, 2, 14}, // ']'
+{515, 3, 1, 4, 5}, // '^'
+{518, 1, 12, 6, 1}, // '_'
+{519, 3, 1, 2, 2}, // '`'
+{520, 3, 4, 6, 8}, // 'a'
+{526, 3, 1, 6, 11}, // 'b'
+{535, 3, 4, 6, 8}, // 'c'
+{541, 3, 1, 6, 11}, // 'd'
+{550, 3, 4, 6, 8}, // 'e'
+{556, 3, 0, 4, 12}, // 'f'
+{562, 3, 4, 6, 11}, // 'g'
+{571, 3, 1, 6, 11}, // 'h'
+{580, 3, 1, 1, 11}, // 'i'
+{582, 0, 1, 3, 14}, // 'j'
+{588, 3, 1, 6, 11}, // 'k'
+{597, 3, 1, 1, 11}, // 'l'
+{599, 3, 4, 11, 8}, // 'm'
+{610, 3, 4, 6, 8}, // 'n'
+{616, 3, 4, 6, 8}, // 'o'
+{622, 3, 4, 6, 11}, // 'p'
+{631, 3, 4, 6, 11}, // 'q'
+{640, 3, 4, 4, 8}, // 'r'
+{644, 3, 4, 5, 8}, // 's'
+{649, 2, 2, 4, 10}, // 't'
+{654, 3, 4, 6, 8}, // 'u'
+{660, 2, 4, 7, 8}, // 'v'
+{667, 2, 4, 11, 8}, // 'w'
+{678, 2, 4, 7, 8}, // 'x'
+{685, 2, 4, 7, 11}, // 'y'
+{695, 3, 4, 6, 8}, // 'z'
+{701, 3, 0, 4, 15}, // '{'
+{709, 3, 1, 1, 13}, // '|'
+{711, 2, 0, 4, 15}, // '}'
+{719, 3, 6, 8, 3}, // '~'
+};
+static const uint8_t Font16x15_widths[] = {
+6, 5, 6, 11, 10, 13, 11, 4, 7, 7, 8, 10, 5, 6, 5, 8,
+10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 5, 10, 10, 10, 9,
+16, 11, 11, 12, 12, 11, 11, 12, 13, 6, 10, 12, 10, 15, 13, 12,
+11, 12, 12, 11, 11, 12, 11, 16, 11, 11, 11, 6, 8, 5, 8, 8,
+6, 10, 10, 10, 10, 10, 8, 10, 10, 5, 5, 9, 5, 15, 10, 10,
+10, 10, 7, 9, 7, 10, 9, 13, 9, 9, 9, 7, 5, 7, 12,
+};
+const SSD1306_Font_t Font_16x15 = {16, 15, NULL, Font16x15_widths, NULL, Font16x15_glyphs, Font16x15_packed};
+#endif
+
+#endif
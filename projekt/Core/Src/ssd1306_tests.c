@@ -1,5 +1,6 @@
 #include <string.h>
 #include <stdio.h>
+#include <math.h>
 #include "ssd1306.h"
 #include "ssd1306_tests.h"
 #include "ssd1306_fonts.h"
@@ -144,12 +145,20 @@ void ssd1306_TestFonts1() {
     ssd1306_SetCursor(2, y);
     ssd1306_WriteString("Font 16x26", Font_16x26, White);
     y += 26;
+    #else
+    ssd1306_SetCursor(2, y);
+    ssd1306_WriteStringScaled("7x10 x2", Font_7x10, 2, White);
+    y += 20;
     #endif
 
     #ifdef SSD1306_INCLUDE_FONT_11x18
     ssd1306_SetCursor(2, y);
     ssd1306_WriteString("Font 11x18", Font_11x18, White);
     y += 18;
+    #else
+    ssd1306_SetCursor(2, y);
+    ssd1306_WriteStringScaled("6x8 x2", Font_6x8, 2, White);
+    y += 16;
     #endif
 
     #ifdef SSD1306_INCLUDE_FONT_7x10
@@ -170,11 +179,11 @@ void ssd1306_TestFonts1() {
  * This test shows how an 128x64 px OLED can replace a 0802 LCD.
  */
 void ssd1306_TestFonts2() {
-#ifdef SSD1306_INCLUDE_FONT_16x24
     uint8_t x1, y1, x2, y2;
 
     ssd1306_Fill(Black);
 
+#ifdef SSD1306_INCLUDE_FONT_16x24
     ssd1306_SetCursor(0, 4);
     ssd1306_WriteString("18.092.5", Font_16x24, White);
     ssd1306_SetCursor(0, 4+24+8);
@@ -184,11 +193,22 @@ void ssd1306_TestFonts2() {
     x1 = 6*16;
     y1 = 4+24+8+24;
     x2 = x1+16;
+#else
+    // Font_7x10 twice as large is 14x20
+    ssd1306_SetCursor(0, 4);
+    ssd1306_WriteStringScaled("18.092.5", Font_7x10, 2, White);
+    ssd1306_SetCursor(0, 4+20+12);
+    ssd1306_WriteStringScaled("RIT+1000", Font_7x10, 2, White);
+
+    // underline
+    x1 = 6*14;
+    y1 = 4+20+12+20+1;
+    x2 = x1+14;
+#endif
     y2 = y1+2;
     ssd1306_FillRectangle(x1, y1, x2, y2, White);
 
     ssd1306_UpdateScreen();
-#endif
 }
 
 /*
@@ -203,13 +223,13 @@ void ssd1306_TestFonts3() {
     ssd1306_WriteString("text... Sweet!", Font_16x15, White);
     ssd1306_SetCursor(4, 44);
     ssd1306_WriteString("3.1415  04:20", Font_16x15, White);
-#elif defined(SSD1306_INCLUDE_FONT_11x18)
+#else
     ssd1306_SetCursor(4, 4);
-    ssd1306_WriteString("Skip test", Font_11x18, White);
+    ssd1306_WriteStringScaled("Skip test", Font_6x8, 2, White);
     ssd1306_SetCursor(4, 24);
-    ssd1306_WriteString("Font not", Font_11x18, White);
+    ssd1306_WriteStringScaled("Font not", Font_6x8, 2, White);
     ssd1306_SetCursor(4, 44);
-    ssd1306_WriteString("included!", Font_11x18, White);
+    ssd1306_WriteStringScaled("included!", Font_6x8, 2, White);
 #endif
     ssd1306_UpdateScreen();
 }
@@ -220,16 +240,17 @@ void ssd1306_TestFPS() {
     uint32_t start = HAL_GetTick();
     uint32_t end = start;
     int fps = 0;
-    char message[] = "ABCDEFGHIJK";
+    char message[] = "ABCDEFGHIJ";
 
+    // Font_6x8 twice as large, 12x16
     ssd1306_SetCursor(2,0);
-    ssd1306_WriteString("Testing...", Font_11x18, Black);
+    ssd1306_WriteStringScaled("Testing...", Font_6x8, 2, Black);
     ssd1306_SetCursor(2, 18*2);
-    ssd1306_WriteString("0123456789A", Font_11x18, Black);
+    ssd1306_WriteStringScaled("0123456789", Font_6x8, 2, Black);
 
     do {
         ssd1306_SetCursor(2, 18);
-        ssd1306_WriteString(message, Font_11x18, Black);
+        ssd1306_WriteStringScaled(message, Font_6x8, 2, Black);
         ssd1306_UpdateScreen();
 
         char ch = message[0];
@@ -248,7 +269,7 @@ void ssd1306_TestFPS() {
 
     ssd1306_Fill(White);
     ssd1306_SetCursor(2, 2);
-    ssd1306_WriteString(buff, Font_11x18, Black);
+    ssd1306_WriteStringScaled(buff, Font_6x8, 2, Black);
     ssd1306_UpdateScreen();
 }
 
@@ -278,6 +299,24 @@ void ssd1306_TestRectangleFill() {
   ssd1306_UpdateScreen();
 }
 
+void ssd1306_TestPatternFill() {
+  uint8_t pattern[8];
+  uint32_t i;
+
+  /* Gray ramp, 16 steps of 4 levels */
+  for(i = 0; i < 16; i++) {
+    ssd1306_BayerPattern(i * 4 + 4, pattern);
+    ssd1306_FillRectanglePattern(i * 8, 0, i * 8 + 7, 15, pattern, White);
+  }
+  ssd1306_BayerPattern(16, pattern);
+  ssd1306_FillCirclePattern(32, 42, 20, pattern, White);
+  ssd1306_FillCircle(96, 42, 20, White);
+  /* Dim the right circle with a Black checker */
+  ssd1306_BayerPattern(32, pattern);
+  ssd1306_FillRectanglePattern(64, 22, 127, 63, pattern, Black);
+  ssd1306_UpdateScreen();
+}
+
 void ssd1306_TestRectangleInvert() {
 #ifdef SSD1306_INCLUDE_FONT_11x18
   ssd1306_SetCursor(2, 0);
@@ -356,6 +395,400 @@ void ssd1306_TestDrawBitmap()
     ssd1306_UpdateScreen();
 }
 
+/*
+ * Moves a circle over a few dots like a game frame does and shows
+ * the average bus traffic per frame. On the host (Tools/host,
+ * test_dirty_update.c) this is 91 bytes in 6 transactions with
+ * SSD1306_USE_DIRTY_UPDATE and 1048 bytes in 16 transactions without.
+ * Needs SSD1306_USE_BUS_STATS, says so otherwise.
+ */
+void ssd1306_TestBusTraffic() {
+#ifdef SSD1306_USE_BUS_STATS
+    const uint32_t frames = 50;
+    char buff[32];
+
+    ssd1306_Fill(Black);
+    ssd1306_UpdateScreen();
+    ssd1306_ResetBusStats();
+
+    for(uint32_t i = 0; i < frames; i++) {
+        ssd1306_Fill(Black);
+        ssd1306_DrawPixel(20, 20, White);
+        ssd1306_DrawPixel(100, 50, White);
+        ssd1306_FillCircle(10 + i, 32, 7, White);
+        ssd1306_UpdateScreen();
+    }
+
+    SSD1306_BusStats_t stats = ssd1306_GetBusStats();
+    ssd1306_Fill(Black);
+    ssd1306_SetCursor(2, 0);
+    ssd1306_WriteString("Per frame:", Font_7x10, White);
+    snprintf(buff, sizeof(buff), "%lu bytes", (unsigned long)(stats.Bytes / frames));
+    ssd1306_SetCursor(2, 12);
+    ssd1306_WriteString(buff, Font_7x10, White);
+    snprintf(buff, sizeof(buff), "%lu transactions", (unsigned long)(stats.Transactions / frames));
+    ssd1306_SetCursor(2, 24);
+    ssd1306_WriteString(buff, Font_7x10, White);
+    ssd1306_UpdateScreen();
+#else
+    ssd1306_Fill(Black);
+    ssd1306_SetCursor(2, 0);
+    ssd1306_WriteString("Bus stats", Font_7x10, White);
+    ssd1306_SetCursor(2, 12);
+    ssd1306_WriteString("disabled", Font_7x10, White);
+    ssd1306_UpdateScreen();
+#endif
+}
+
+/* Cycle counter of the Cortex-M core */
+static void ssd1306_CyclesStart(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static uint32_t ssd1306_CyclesStop(void) {
+    return DWT->CYCCNT;
+}
+
+/* Pixel by pixel filled circle, the way ssd1306_FillCircle used to draw it */
+static uint32_t ssd1306_RefFillCircle(uint8_t par_x, uint8_t par_y, uint8_t par_r) {
+    int32_t x = -par_r;
+    int32_t y = 0;
+    int32_t err = 2 - 2 * par_r;
+    int32_t e2;
+    uint32_t pixels = 0;
+
+    do {
+        for (int32_t _y = par_y - y; _y <= par_y + y; _y++) {
+            for (int32_t _x = par_x + x; _x <= par_x - x; _x++) {
+                ssd1306_DrawPixel(_x, _y, White);
+                pixels++;
+            }
+        }
+        e2 = err;
+        if (e2 <= y) {
+            y++;
+            err = err + (y * 2 + 1);
+            if (-x == y && e2 <= x) {
+                e2 = 0;
+            }
+        }
+        if (e2 > x) {
+            x++;
+            err = err + (x * 2 + 1);
+        }
+    } while (x <= 0);
+    return pixels;
+}
+
+/* Pixel by pixel filled rectangle, the way ssd1306_FillRectangle used to draw it */
+static uint32_t ssd1306_RefFillRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2) {
+    uint32_t pixels = 0;
+    for (uint8_t y = y1; y <= y2; y++) {
+        for (uint8_t x = x1; x <= x2; x++) {
+            ssd1306_DrawPixel(x, y, White);
+            pixels++;
+        }
+    }
+    return pixels;
+}
+
+/*
+ * Compares the span rasterizer with pixel by pixel drawing, both draw the
+ * same white shape on a cleared screen. Shows pixels written by the pixel
+ * version and cycles of both per primitive. Tools/host/test_raster.c checks
+ * that both write the same bytes.
+ */
+void ssd1306_TestRasterBenchmark() {
+    char buff[32];
+    uint32_t circlePixels, circleRef, circleSpan;
+    uint32_t rectPixels, rectRef, rectSpan;
+
+    ssd1306_Fill(Black);
+    ssd1306_CyclesStart();
+    circlePixels = ssd1306_RefFillCircle(64, 32, 24);
+    circleRef = ssd1306_CyclesStop();
+    ssd1306_Fill(Black);
+    ssd1306_CyclesStart();
+    ssd1306_FillCircle(64, 32, 24, White);
+    circleSpan = ssd1306_CyclesStop();
+
+    ssd1306_Fill(Black);
+    ssd1306_CyclesStart();
+    rectPixels = ssd1306_RefFillRectangle(10, 30, 117, 60);
+    rectRef = ssd1306_CyclesStop();
+    ssd1306_Fill(Black);
+    ssd1306_CyclesStart();
+    ssd1306_FillRectangle(10, 30, 117, 60, White);
+    rectSpan = ssd1306_CyclesStop();
+
+    ssd1306_Fill(Black);
+    ssd1306_SetCursor(0, 0);
+    ssd1306_WriteString("Circle r24", Font_6x8, White);
+    // Pixels and cycles on their own lines, three 10 digit numbers don't fit in buff or on one line
+    snprintf(buff, sizeof(buff), "%lupx", (unsigned long)circlePixels);
+    ssd1306_SetCursor(0, 10);
+    ssd1306_WriteString(buff, Font_6x8, White);
+    snprintf(buff, sizeof(buff), "%lu/%lu", (unsigned long)circleRef, (unsigned long)circleSpan);
+    ssd1306_SetCursor(0, 18);
+    ssd1306_WriteString(buff, Font_6x8, White);
+    ssd1306_SetCursor(0, 30);
+    ssd1306_WriteString("Rect 108x31", Font_6x8, White);
+    snprintf(buff, sizeof(buff), "%lupx", (unsigned long)rectPixels);
+    ssd1306_SetCursor(0, 40);
+    ssd1306_WriteString(buff, Font_6x8, White);
+    snprintf(buff, sizeof(buff), "%lu/%lu", (unsigned long)rectRef, (unsigned long)rectSpan);
+    ssd1306_SetCursor(0, 48);
+    ssd1306_WriteString(buff, Font_6x8, White);
+    ssd1306_UpdateScreen();
+}
+
+/* Arc with sinf/cosf and pi = 3.14, the way ssd1306_DrawArc used to draw it */
+static void ssd1306_RefDrawArc(uint8_t x, uint8_t y, uint8_t radius, uint16_t sweep) {
+    const uint32_t segments = sweep * 36 / 360;
+    const float approx_degree = sweep / (float)segments;
+    for (uint32_t count = 0; count < segments; count++) {
+        float rad = count * approx_degree * (3.14f / 180.0f);
+        uint8_t xp1 = x + (int8_t)(sinf(rad) * radius);
+        uint8_t yp1 = y + (int8_t)(cosf(rad) * radius);
+        rad = ((count + 1 != segments) ? (count + 1) * approx_degree : sweep) * (3.14f / 180.0f);
+        uint8_t xp2 = x + (int8_t)(sinf(rad) * radius);
+        uint8_t yp2 = y + (int8_t)(cosf(rad) * radius);
+        ssd1306_Line(xp1, yp1, xp2, yp2, White);
+    }
+}
+
+/*
+ * Times a 270 degree gauge with the float arc against the sine table one.
+ * The float arc is drawn on the left, the fixed-point one on the right.
+ * Tools/host/test_arc.c compares their endpoints and times them in host
+ * nanoseconds.
+ */
+void ssd1306_TestArcBenchmark() {
+    char buff[32];
+    uint32_t ref, fixed;
+
+    ssd1306_Fill(Black);
+    ssd1306_CyclesStart();
+    ssd1306_RefDrawArc(32, 40, 22, 270);
+    ref = ssd1306_CyclesStop();
+    ssd1306_CyclesStart();
+    ssd1306_DrawArc(96, 40, 22, 0, 270, White);
+    fixed = ssd1306_CyclesStop();
+
+    ssd1306_SetCursor(0, 0);
+    ssd1306_WriteString("Arc r22 270deg", Font_6x8, White);
+    snprintf(buff, sizeof(buff), "%lu/%lu", (unsigned long)ref, (unsigned long)fixed);
+    ssd1306_SetCursor(0, 8);
+    ssd1306_WriteString(buff, Font_6x8, White);
+    ssd1306_UpdateScreen();
+}
+
+/*
+ * Times a full screen image the way winAnimation used to draw it (Fill + DrawBitmap)
+ * against ssd1306_BlitBitmapPages() with the same image in page layout. This is the
+ * only cycle measurement of the two, Tools/host/test_page_bitmaps.c times them in
+ * host nanoseconds.
+ */
+void ssd1306_TestBitmapBenchmark() {
+    static uint8_t pages[SSD1306_WIDTH * SSD1306_HEIGHT / 8];
+    char buff[32];
+    uint32_t ref, blit;
+
+    // Row-major to page layout, what Tools/gen_page_bitmaps.py does offline
+    memset(pages, 0, sizeof(pages));
+    for (uint32_t y = 0; y < 64; y++) {
+        for (uint32_t x = 0; x < 128; x++) {
+            if (garfield_128x64[y * 16 + x / 8] & (0x80 >> (x % 8))) {
+                pages[(y / 8) * 128 + x] |= 1 << (y % 8);
+            }
+        }
+    }
+
+    ssd1306_CyclesStart();
+    ssd1306_Fill(Black);
+    ssd1306_DrawBitmap(0, 0, garfield_128x64, 128, 64, White);
+    ref = ssd1306_CyclesStop();
+    ssd1306_CyclesStart();
+    ssd1306_BlitBitmapPages(0, 0, pages, 128, 64);
+    blit = ssd1306_CyclesStop();
+
+    ssd1306_FillRectangle(0, 0, 127, 19, Black);
+    ssd1306_SetCursor(0, 0);
+    ssd1306_WriteString("Bitmap 128x64", Font_6x8, White);
+    snprintf(buff, sizeof(buff), "%lu/%lu", (unsigned long)ref, (unsigned long)blit);
+    ssd1306_SetCursor(0, 10);
+    ssd1306_WriteString(buff, Font_6x8, White);
+    ssd1306_UpdateScreen();
+}
+
+/*
+ * Times 16 passes of a 64x32 XOR blit on a page boundary (y = 0) and
+ * straddling pages (y = 3), the unaligned one shifts every source word.
+ */
+void ssd1306_TestBlitBenchmark() {
+    static uint8_t src[64 * 32 / 8];
+    char buff[32];
+    uint32_t aligned, unaligned;
+
+    for (uint32_t i = 0; i < sizeof(src); i++) {
+        src[i] = (i & 1) ? 0xAA : 0x55;
+    }
+
+    ssd1306_Fill(Black);
+    ssd1306_CyclesStart();
+    for (uint32_t i = 0; i < 16; i++) {
+        ssd1306_BitBlt(0, 0, src, 64, 32, SSD1306_ROP_XOR);
+    }
+    aligned = ssd1306_CyclesStop();
+    ssd1306_CyclesStart();
+    for (uint32_t i = 0; i < 16; i++) {
+        ssd1306_BitBlt(64, 3, src, 64, 32, SSD1306_ROP_XOR);
+    }
+    unaligned = ssd1306_CyclesStop();
+
+    ssd1306_FillRectangle(0, 40, 127, 63, Black);
+    ssd1306_SetCursor(0, 40);
+    ssd1306_WriteString("BitBlt 64x32 y0/y3", Font_6x8, White);
+    snprintf(buff, sizeof(buff), "%lu/%lu", (unsigned long)aligned, (unsigned long)unaligned);
+    ssd1306_SetCursor(0, 50);
+    ssd1306_WriteString(buff, Font_6x8, White);
+    ssd1306_UpdateScreen();
+}
+
+/*
+ * Cycles per glyph of ssd1306_WriteChar() over all 95 characters, opaque, with
+ * the font storage of the build (SSD1306_USE_PACKED_FONTS or rows and pages).
+ */
+void ssd1306_TestFontBenchmark() {
+    const SSD1306_Font_t* fonts[] = { &Font_6x8, &Font_7x10 };
+    const char* names[] = { "6x8", "7x10" };
+    uint32_t cycles[2];
+    char buff[32];
+
+    for (uint32_t f = 0; f < 2; f++) {
+        const SSD1306_Font_t* font = fonts[f];
+        const uint32_t per_line = SSD1306_WIDTH / font->width;
+        ssd1306_Fill(Black);
+        ssd1306_CyclesStart();
+        for (uint32_t ch = 32; ch <= 126; ch++) {
+            const uint32_t i = ch - 32;
+            ssd1306_SetCursor((i % per_line) * font->width, ((i / per_line) * font->height) % (SSD1306_HEIGHT - font->height));
+            ssd1306_WriteChar(ch, *font, White);
+        }
+        cycles[f] = ssd1306_CyclesStop() / 95;
+    }
+
+    ssd1306_Fill(Black);
+    ssd1306_SetCursor(0, 0);
+#ifdef SSD1306_USE_PACKED_FONTS
+    ssd1306_WriteString("Packed fonts", Font_6x8, White);
+#else
+    ssd1306_WriteString("Rows + pages fonts", Font_6x8, White);
+#endif
+    for (uint32_t f = 0; f < 2; f++) {
+        snprintf(buff, sizeof(buff), "%s: %lu cyc/glyph", names[f], (unsigned long)cycles[f]);
+        ssd1306_SetCursor(0, 16 + f * 10);
+        ssd1306_WriteString(buff, Font_6x8, White);
+    }
+    ssd1306_UpdateScreen();
+}
+
+/*
+ * Cycles of the bus backend of the build (SSD1306_USE_SPI_LL, HAL SPI or
+ * I2C) for one whole frame, window command plus 1 KB of data, and per single
+ * command byte. Build with and without SSD1306_USE_SPI_LL to compare.
+ */
+void ssd1306_TestTransportBenchmark() {
+    static uint8_t frame[SSD1306_BUFFER_SIZE];
+    const uint8_t x0 = SSD1306_X_OFFSET_LOWER + (SSD1306_X_OFFSET_UPPER << 4);
+    const uint8_t window[] = { 0x21, x0, x0 + SSD1306_WIDTH - 1, 0x22, 0, SSD1306_HEIGHT / 8 - 1 };
+    uint32_t frame_cycles, command_cycles;
+    char buff[32];
+
+    for (uint32_t i = 0; i < sizeof(frame); i++) {
+        frame[i] = (i & 8) ? 0x0F : 0xF0;
+    }
+
+    ssd1306_CyclesStart();
+    ssd1306_WriteCommands(window, sizeof(window));
+    ssd1306_WriteData(frame, sizeof(frame));
+    frame_cycles = ssd1306_CyclesStop();
+    ssd1306_CyclesStart();
+    for (uint32_t i = 0; i < 64; i++) {
+        ssd1306_WriteCommand(0xA4); // Output follows RAM content, changes nothing
+    }
+    command_cycles = ssd1306_CyclesStop() / 64;
+    HAL_Delay(1000);
+
+    ssd1306_Fill(Black);
+    ssd1306_SetCursor(0, 0);
+#if defined(SSD1306_USE_SPI_LL)
+    ssd1306_WriteString("LL SPI backend", Font_6x8, White);
+#elif defined(SSD1306_USE_SPI)
+    ssd1306_WriteString("HAL SPI backend", Font_6x8, White);
+#else
+    ssd1306_WriteString("HAL I2C backend", Font_6x8, White);
+#endif
+    snprintf(buff, sizeof(buff), "frame: %lu cyc", (unsigned long)frame_cycles);
+    ssd1306_SetCursor(0, 16);
+    ssd1306_WriteString(buff, Font_6x8, White);
+    snprintf(buff, sizeof(buff), "command: %lu cyc", (unsigned long)command_cycles);
+    ssd1306_SetCursor(0, 26);
+    ssd1306_WriteString(buff, Font_6x8, White);
+    ssd1306_UpdateScreen();
+}
+
+/*
+ * Fades the screen out and back in twice, only contrast commands are sent.
+ */
+void ssd1306_TestFade() {
+    ssd1306_Fill(Black);
+    ssd1306_SetCursor(2, 26);
+    ssd1306_WriteString("Contrast fade", Font_7x10, White);
+    ssd1306_UpdateScreen();
+
+    for (uint32_t i = 0; i < 2; i++) {
+        ssd1306_FadeTo(0x00, 1000, 1);
+        while (ssd1306_FadeUpdate()) {
+        }
+        ssd1306_FadeTo(0xFF, 1000, 0);
+        while (ssd1306_FadeUpdate()) {
+        }
+    }
+}
+
+/*
+ * Opens three nested popups over a pattern and closes them again, each
+ * close sends only the popup's area back.
+ */
+void ssd1306_TestOverlay() {
+    static uint8_t saved[3][SSD1306_OVERLAY_SIZE(0, 4, 63, 35)];
+    SSD1306_Overlay_t overlay[3];
+    uint8_t pattern[8];
+
+    ssd1306_BayerPattern(32, pattern);
+    ssd1306_FillRectanglePattern(0, 0, SSD1306_WIDTH - 1, SSD1306_HEIGHT - 1, pattern, White);
+    ssd1306_UpdateScreen();
+
+    for (uint8_t i = 0; i < 3; i++) {
+        const uint8_t x = 8 + i * 24, y = 4 + i * 12;
+        ssd1306_OverlayBegin(&overlay[i], saved[i], sizeof(saved[i]), x, y, x + 63, y + 31);
+        ssd1306_FillRectangle(x, y, x + 63, y + 31, Black);
+        ssd1306_DrawRectangle(x, y, x + 63, y + 31, White);
+        ssd1306_SetCursor(x + 4, y + 4);
+        ssd1306_WriteString("Popup", Font_6x8, White);
+        ssd1306_UpdateScreen();
+        HAL_Delay(500);
+    }
+    for (int8_t i = 2; i >= 0; i--) {
+        ssd1306_OverlayEnd(&overlay[i]);
+        ssd1306_UpdateScreen();
+        HAL_Delay(500);
+    }
+}
+
 void ssd1306_TestAll() {
     ssd1306_Init();
 
@@ -376,6 +809,9 @@ void ssd1306_TestAll() {
     ssd1306_TestRectangleFill();
     HAL_Delay(3000);
     ssd1306_Fill(Black);
+    ssd1306_TestPatternFill();
+    HAL_Delay(3000);
+    ssd1306_Fill(Black);
     ssd1306_TestRectangleInvert();
     HAL_Delay(3000);
     ssd1306_Fill(Black);
@@ -389,4 +825,21 @@ void ssd1306_TestAll() {
     HAL_Delay(3000);
     ssd1306_TestDrawBitmap();
     HAL_Delay(3000);
+    ssd1306_TestBusTraffic();
+    HAL_Delay(3000);
+    ssd1306_TestRasterBenchmark();
+    HAL_Delay(3000);
+    ssd1306_TestBitmapBenchmark();
+    HAL_Delay(3000);
+    ssd1306_TestArcBenchmark();
+    HAL_Delay(3000);
+    ssd1306_TestBlitBenchmark();
+    HAL_Delay(3000);
+    ssd1306_TestFontBenchmark();
+    HAL_Delay(3000);
+    ssd1306_TestTransportBenchmark();
+    HAL_Delay(3000);
+    ssd1306_TestFade();
+    HAL_Delay(3000);
+    ssd1306_TestOverlay();
 }
@@ -20,44 +20,63 @@ static void delayNOP(uint32_t numberNOP)
 } // end void delayNOP(uint32_t numberNOP)
 
 
+static I2CQ_Device_t SX1509_Device;
+
+void sx1509Init(I2CQ_Bus_t* bus)
+{
+	i2cq_InitDevice(&SX1509_Device, bus, SXAddress, "SX1509");
+}
+
+I2CQ_Device_t* sx1509Device(void)
+{
+	return &SX1509_Device;
+}
+
+// Blocking, waits behind the transactions queued before it
+static uint8_t transfer(uint8_t read, uint8_t reg, uint8_t* buf, uint16_t len)
+{
+	I2CQ_Transaction_t t;
+	if (read)
+		i2cq_SetupRead(&t, &SX1509_Device, reg, buf, len);
+	else
+		i2cq_SetupWrite(&t, &SX1509_Device, reg, buf, len);
+	t.Priority = I2CQ_PRIORITY_HIGH;
+	return i2cq_Transfer(&t) == I2CQ_OK;
+}
+
 uint8_t readByte(uint8_t reg)
 {
-	HAL_StatusTypeDef ret;
-	uint8_t buf[1] = {reg};
-	ret = HAL_I2C_Master_Transmit(&SX1509_I2C_PORT, SXAddress, buf, 1, i2CTimeout);
-	if ( ret == HAL_OK )
+	uint8_t buf[1];
+	if (transfer(1, reg, buf, 1))
 	{
-		ret = HAL_I2C_Master_Receive(&SX1509_I2C_PORT, SXAddress, buf, 1, 1000);
-		if ( ret == HAL_OK )
-		{
-			return buf[0];
-		}
+		return buf[0];
 	}
 	return 0xFF;
 }
 
 uint16_t readWord(uint8_t reg)
 {
-	HAL_StatusTypeDef ret;
-	uint8_t buf[2] = {reg};
-	ret = HAL_I2C_Master_Transmit(&SX1509_I2C_PORT, SXAddress, buf, 1, i2CTimeout);
-	if ( ret == HAL_OK )
+	uint8_t buf[2];
+	if (transfer(1, reg, buf, 2))
 	{
-		ret = HAL_I2C_Master_Receive(&SX1509_I2C_PORT, SXAddress, buf, 2, i2CTimeout);
-		if ( ret == HAL_OK )
-		{
-			uint16_t tmp = buf[0];
-			tmp <<= 8;
-			tmp |= buf[1];
-			return tmp;
-		}
+		uint16_t tmp = buf[0];
+		tmp <<= 8;
+		tmp |= buf[1];
+		return tmp;
 	}
 	return 0xFFFF;
 }
 
+void readBytesAsync(I2CQ_Transaction_t* t, uint8_t reg, uint8_t* buf, uint16_t len, I2CQ_Callback_t callback)
+{
+	i2cq_SetupRead(t, &SX1509_Device, reg, buf, len);
+	t->Priority = I2CQ_PRIORITY_HIGH;
+	t->Callback = callback;
+	i2cq_Submit(t);
+}
+
 void reset(uint8_t hardware)
 {
-	HAL_StatusTypeDef ret;
 	// if hardware bool is set
 	if (hardware != 0)
 	{
@@ -66,10 +85,8 @@ void reset(uint8_t hardware)
 		uint8_t regMisc = readByte(REG_MISC);
 		if (regMisc & (1 << 2))
 		{
-			uint8_t buf[2] = {REG_MISC, 0};
 			regMisc &= ~(1 << 2);
-			buf[1] = regMisc;
-			ret = HAL_I2C_Master_Transmit(&SX1509_I2C_PORT, SXAddress, buf, 2, i2CTimeout);
+			transfer(0, REG_MISC, &regMisc, 1);
 		}
 		// Reset the SX1509, the pin is active low
 		HAL_GPIO_WritePin(SX1509_nRST_PORT, SX1509_nRST_Pin, GPIO_PIN_RESET); // pull reset pin low
@@ -79,9 +96,9 @@ void reset(uint8_t hardware)
 	else
 	{
 		// Software reset command sequence:
-		uint8_t buf[2] = {REG_RESET, 0x12};
-		ret = HAL_I2C_Master_Transmit(&SX1509_I2C_PORT, SXAddress, buf, 2, i2CTimeout);
-		buf[1] = 0x34;
-		ret = HAL_I2C_Master_Transmit(&SX1509_I2C_PORT, SXAddress, buf, 2, i2CTimeout);
+		uint8_t value = 0x12;
+		transfer(0, REG_RESET, &value, 1);
+		value = 0x34;
+		transfer(0, REG_RESET, &value, 1);
 	}
 }
@@ -7,9 +7,16 @@
 C_SRCS += \
 ../Core/Src/LCD_Keypad.c \
 ../Core/Src/bitmaps.c \
+../Core/Src/bitmaps_anim.c \
+../Core/Src/bitmaps_pages.c \
+../Core/Src/i2c_queue.c \
 ../Core/Src/main.c \
 ../Core/Src/ssd1306.c \
+../Core/Src/ssd1306_circles.c \
 ../Core/Src/ssd1306_fonts.c \
+../Core/Src/ssd1306_fonts_packed.c \
+../Core/Src/ssd1306_fonts_pages.c \
+../Core/Src/ssd1306_sine.c \
 ../Core/Src/ssd1306_tests.c \
 ../Core/Src/stm32l4xx_hal_msp.c \
 ../Core/Src/stm32l4xx_it.c \
@@ -21,9 +28,16 @@ C_SRCS += \
 OBJS += \
 ./Core/Src/LCD_Keypad.o \
 ./Core/Src/bitmaps.o \
+./Core/Src/bitmaps_anim.o \
+./Core/Src/bitmaps_pages.o \
+./Core/Src/i2c_queue.o \
 ./Core/Src/main.o \
 ./Core/Src/ssd1306.o \
+./Core/Src/ssd1306_circles.o \
 ./Core/Src/ssd1306_fonts.o \
+./Core/Src/ssd1306_fonts_packed.o \
+./Core/Src/ssd1306_fonts_pages.o \
+./Core/Src/ssd1306_sine.o \
 ./Core/Src/ssd1306_tests.o \
 ./Core/Src/stm32l4xx_hal_msp.o \
 ./Core/Src/stm32l4xx_it.o \
@@ -35,9 +49,16 @@ OBJS += \
 C_DEPS += \
 ./Core/Src/LCD_Keypad.d \
 ./Core/Src/bitmaps.d \
+./Core/Src/bitmaps_anim.d \
+./Core/Src/bitmaps_pages.d \
+./Core/Src/i2c_queue.d \
 ./Core/Src/main.d \
 ./Core/Src/ssd1306.d \
+./Core/Src/ssd1306_circles.d \
 ./Core/Src/ssd1306_fonts.d \
+./Core/Src/ssd1306_fonts_packed.d \
+./Core/Src/ssd1306_fonts_pages.d \
+./Core/Src/ssd1306_sine.d \
 ./Core/Src/ssd1306_tests.d \
 ./Core/Src/stm32l4xx_hal_msp.d \
 ./Core/Src/stm32l4xx_it.d \
@@ -54,7 +75,7 @@ Core/Src/%.o Core/Src/%.su Core/Src/%.cyclo: ../Core/Src/%.c Core/Src/subdir.mk
 clean: clean-Core-2f-Src
 
 clean-Core-2f-Src:
-	-$(RM) ./Core/Src/LCD_Keypad.cyclo ./Core/Src/LCD_Keypad.d ./Core/Src/LCD_Keypad.o ./Core/Src/LCD_Keypad.su ./Core/Src/bitmaps.cyclo ./Core/Src/bitmaps.d ./Core/Src/bitmaps.o ./Core/Src/bitmaps.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/ssd1306.cyclo ./Core/Src/ssd1306.d ./Core/Src/ssd1306.o ./Core/Src/ssd1306.su ./Core/Src/ssd1306_fonts.cyclo ./Core/Src/ssd1306_fonts.d ./Core/Src/ssd1306_fonts.o ./Core/Src/ssd1306_fonts.su ./Core/Src/ssd1306_tests.cyclo ./Core/Src/ssd1306_tests.d ./Core/Src/ssd1306_tests.o ./Core/Src/ssd1306_tests.su ./Core/Src/stm32l4xx_hal_msp.cyclo ./Core/Src/stm32l4xx_hal_msp.d ./Core/Src/stm32l4xx_hal_msp.o ./Core/Src/stm32l4xx_hal_msp.su ./Core/Src/stm32l4xx_it.cyclo ./Core/Src/stm32l4xx_it.d ./Core/Src/stm32l4xx_it.o ./Core/Src/stm32l4xx_it.su ./Core/Src/sx1509.cyclo ./Core/Src/sx1509.d ./Core/Src/sx1509.o ./Core/Src/sx1509.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32l4xx.cyclo ./Core/Src/system_stm32l4xx.d ./Core/Src/system_stm32l4xx.o ./Core/Src/system_stm32l4xx.su
+	-$(RM) ./Core/Src/LCD_Keypad.cyclo ./Core/Src/LCD_Keypad.d ./Core/Src/LCD_Keypad.o ./Core/Src/LCD_Keypad.su ./Core/Src/bitmaps.cyclo ./Core/Src/bitmaps.d ./Core/Src/bitmaps.o ./Core/Src/bitmaps.su ./Core/Src/bitmaps_anim.cyclo ./Core/Src/bitmaps_anim.d ./Core/Src/bitmaps_anim.o ./Core/Src/bitmaps_anim.su ./Core/Src/bitmaps_pages.cyclo ./Core/Src/bitmaps_pages.d ./Core/Src/bitmaps_pages.o ./Core/Src/bitmaps_pages.su ./Core/Src/i2c_queue.cyclo ./Core/Src/i2c_queue.d ./Core/Src/i2c_queue.o ./Core/Src/i2c_queue.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/ssd1306.cyclo ./Core/Src/ssd1306.d ./Core/Src/ssd1306.o ./Core/Src/ssd1306.su ./Core/Src/ssd1306_circles.cyclo ./Core/Src/ssd1306_circles.d ./Core/Src/ssd1306_circles.o ./Core/Src/ssd1306_circles.su ./Core/Src/ssd1306_fonts.cyclo ./Core/Src/ssd1306_fonts.d ./Core/Src/ssd1306_fonts.o ./Core/Src/ssd1306_fonts.su ./Core/Src/ssd1306_fonts_packed.cyclo ./Core/Src/ssd1306_fonts_packed.d ./Core/Src/ssd1306_fonts_packed.o ./Core/Src/ssd1306_fonts_packed.su ./Core/Src/ssd1306_fonts_pages.cyclo ./Core/Src/ssd1306_fonts_pages.d ./Core/Src/ssd1306_fonts_pages.o ./Core/Src/ssd1306_fonts_pages.su ./Core/Src/ssd1306_sine.cyclo ./Core/Src/ssd1306_sine.d ./Core/Src/ssd1306_sine.o ./Core/Src/ssd1306_sine.su ./Core/Src/ssd1306_tests.cyclo ./Core/Src/ssd1306_tests.d ./Core/Src/ssd1306_tests.o ./Core/Src/ssd1306_tests.su ./Core/Src/stm32l4xx_hal_msp.cyclo ./Core/Src/stm32l4xx_hal_msp.d ./Core/Src/stm32l4xx_hal_msp.o ./Core/Src/stm32l4xx_hal_msp.su ./Core/Src/stm32l4xx_it.cyclo ./Core/Src/stm32l4xx_it.d ./Core/Src/stm32l4xx_it.o ./Core/Src/stm32l4xx_it.su ./Core/Src/sx1509.cyclo ./Core/Src/sx1509.d ./Core/Src/sx1509.o ./Core/Src/sx1509.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32l4xx.cyclo ./Core/Src/system_stm32l4xx.d ./Core/Src/system_stm32l4xx.o ./Core/Src/system_stm32l4xx.su
 
 .PHONY: clean-Core-2f-Src
 
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""
+Per-font flash report: the bytes each font of Core/Src/ssd1306_fonts.c costs
+(uint16_t rows, page layout glyphs of ssd1306_fonts_pages.c and the
+proportional widths) or packed (ssd1306_fonts_packed.c), whether
+Core/Inc/ssd1306_conf.h compiles it in, and the scaled Font_6x8/Font_7x10 that
+comes closest to it with ssd1306_WriteStringScaled().
+
+Usage: python3 Tools/font_sizes.py [Core/Src/ssd1306_fonts.c] [Core/Inc/ssd1306_conf.h]
+"""
+
+import re
+import sys
+
+from gen_font_packed import load_fonts, pack_font, packed_size
+
+INCLUDE_RE = re.compile(r"^\s*#define\s+SSD1306_INCLUDE_FONT_(\w+)", re.M)
+PACKED_RE = re.compile(r"^\s*#define\s+SSD1306_USE_PACKED_FONTS", re.M)
+GLYPHS = 126 - 32 + 1
+SMALL = ["6x8", "7x10"]
+
+
+def font_bytes(width, height, proportional):
+    rows = GLYPHS * height * 2
+    pages = GLYPHS * width * ((height + 7) // 8)
+    widths = GLYPHS if proportional else 0
+    return rows, pages, widths
+
+
+def nearest_scaled(fonts, width, height):
+    """Small font and scale whose glyph box is closest to width x height"""
+    best = None
+    for name in SMALL:
+        w, h = fonts[name][:2]
+        for scale in range(2, 5):
+            error = abs(w * scale - width) + abs(h * scale - height)
+            if best is None or error < best[0]:
+                best = (error, name, scale, w * scale, h * scale)
+    return best[1:]
+
+
+def main():
+    fonts_path = sys.argv[1] if len(sys.argv) > 1 else "Core/Src/ssd1306_fonts.c"
+    conf_path = sys.argv[2] if len(sys.argv) > 2 else "Core/Inc/ssd1306_conf.h"
+    loaded = load_fonts(fonts_path)
+    fonts = {size: (width, height) for size, _, width, height, _, _ in loaded}
+    conf = open(conf_path).read()
+    included = set(INCLUDE_RE.findall(conf))
+    use_packed = PACKED_RE.search(conf) is not None
+
+    print("Fonts stored %s\n" % ("packed" if use_packed else "as rows and pages"))
+    print("font    included  rows  pages  widths  total  packed  scaled replacement")
+    total = 0
+    large = 0
+    for size, _, width, height, glyph_rows, advance in loaded:
+        proportional = advance is not None
+        rows, pages, widths = font_bytes(width, height, proportional)
+        packed = packed_size(*pack_font(glyph_rows, width, height), proportional)
+        size_bytes = packed if use_packed else rows + pages + widths
+        replacement = ""
+        if size not in SMALL:
+            name, scale, w, h = nearest_scaled(fonts, width, height)
+            replacement = "Font_%s x%d (%dx%d)" % (name, scale, w, h)
+        if size in included:
+            total += size_bytes
+            if size not in SMALL:
+                large += size_bytes
+        print("%-7s %-8s %5d  %5d  %6d  %5d  %6d  %s"
+              % (size, "yes" if size in included else "no", rows, pages, widths,
+                 rows + pages + widths, packed, replacement))
+
+    print("\nCompiled in: %d bytes, %d of them in fonts a scaled small font can replace" % (total, large))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""
+Generates Core/Src/bitmaps_anim.c: the fajerwerki1..11 frames of
+Core/Src/bitmaps.c as an animation for ssd1306_AnimationNextFrame().
+
+Frames are converted to SSD1306 page layout and stored as deltas: the first
+against a black screen, every following one against the frame before it, and
+a last one from the final frame back to the first so the animation can loop.
+A delta is a sequence of tokens over the 1024 byte screenbuffer:
+
+    0x00          end of frame
+    0x01..0x7F    skip n unchanged bytes
+    0x80..0xFF    n - 0x7F (1..128) literal bytes follow, copied into the buffer
+
+Size and bus traffic statistics are printed to stderr.
+
+Usage: python3 Tools/gen_animation.py Core/Src/bitmaps.c > Core/Src/bitmaps_anim.c
+"""
+
+import re
+import sys
+
+WIDTH = 128
+HEIGHT = 64
+PAGES = HEIGHT // 8
+NAME = "fajerwerki"
+
+ARRAY_RE = re.compile(r"const unsigned char (%s\d+)\s*\[\] = \{(.*?)\};" % NAME, re.S)
+HEX_RE = re.compile(r"0x[0-9A-Fa-f]{2}")
+
+# Commands sent per address window by ssd1306_UpdateScreen()
+WINDOW_COMMANDS = 6
+
+
+def pages(rows):
+    stride = WIDTH // 8
+    data = bytearray(WIDTH * PAGES)
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            if rows[y * stride + x // 8] & (0x80 >> (x % 8)):
+                data[(y // 8) * WIDTH + x] |= 1 << (y % 8)
+    return data
+
+
+def encode(old, new):
+    """Delta tokens turning old into new."""
+    out = bytearray()
+    i = 0
+    n = len(new)
+    while i < n:
+        if old[i] == new[i]:
+            start = i
+            while i < n and old[i] == new[i] and i - start < 0x7F:
+                i += 1
+            if i < n:
+                out.append(i - start)
+        else:
+            start = i
+            # A single unchanged byte is cheaper inside the literal run than a skip token
+            while i < n and i - start < 128 and (old[i] != new[i] or
+                                                 (i + 1 < n and old[i + 1] != new[i + 1])):
+                i += 1
+            out.append(0x7F + i - start)
+            out += new[start:i]
+    out.append(0x00)
+    return out
+
+
+def flush_bytes(old, new):
+    """Bytes ssd1306_UpdateScreen() sends with dirty tracking: one window per run of changed pages."""
+    total = 0
+    page = 0
+    while page < PAGES:
+        cols = [c for c in range(WIDTH) if old[page * WIDTH + c] != new[page * WIDTH + c]]
+        if not cols:
+            page += 1
+            continue
+        x1, x2, first = min(cols), max(cols), page
+        page += 1
+        while page < PAGES:
+            cols = [c for c in range(WIDTH) if old[page * WIDTH + c] != new[page * WIDTH + c]]
+            if not cols:
+                break
+            x1, x2 = min(x1, min(cols)), max(x2, max(cols))
+            page += 1
+        total += WINDOW_COMMANDS + (x2 - x1 + 1) * (page - first)
+    return total
+
+
+def main():
+    source = open(sys.argv[1]).read()
+    frames = sorted(((int(name[len(NAME):]), pages([int(v, 16) for v in HEX_RE.findall(body)]))
+                     for name, body in ARRAY_RE.findall(source)))
+    frames = [f for _, f in frames]
+
+    deltas = []
+    prev = bytearray(WIDTH * PAGES)
+    for frame in frames:
+        deltas.append(encode(prev, frame))
+        prev = frame
+    deltas.append(encode(prev, frames[0]))
+
+    print("/*")
+    print(" * Generated by Tools/gen_animation.py, do not edit.")
+    print(" * %s1..%d of bitmaps.c as page layout deltas." % (NAME, len(frames)))
+    print(" */\n")
+    print('#include "bitmaps.h"\n')
+    print("static const uint8_t %s_deltas[] = {" % NAME)
+    offset = 0
+    for i, delta in enumerate(deltas):
+        if i < len(frames):
+            print("// %s%d" % (NAME, i + 1))
+        else:
+            print("// loop")
+            loop = offset
+        for j in range(0, len(delta), 16):
+            print(" ".join("0x%02X," % b for b in delta[j:j + 16]))
+        offset += len(delta)
+    print("};\n")
+    print("const SSD1306_Animation_t %s_anim = {%s_deltas, %d, %d};" % (NAME, NAME, len(frames), loop))
+
+    raw = len(frames) * WIDTH * PAGES
+    encoded = sum(len(d) for d in deltas)
+    full = WINDOW_COMMANDS + WIDTH * PAGES
+    err = sys.stderr
+    print("frames: %d, raw %d bytes, encoded %d bytes (%.1f%%)" % (len(frames), raw, encoded, 100.0 * encoded / raw), file=err)
+    print("%-6s %6s %10s %10s" % ("frame", "delta", "full bus", "delta bus"), file=err)
+    prev = frames[-1]
+    bus_full = bus_delta = 0
+    for i, frame in enumerate(frames):
+        sent = flush_bytes(prev, frame)
+        bus_full += full
+        bus_delta += sent
+        print("%-6d %6d %10d %10d" % (i + 1, len(deltas[i]), full, sent), file=err)
+        prev = frame
+    print("loop   %6d, bus bytes per cycle: full %d, delta %d" % (len(deltas[-1]), bus_full, bus_delta), file=err)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""
+Generates Core/Src/ssd1306_circles.c: filled and outline circle masks for
+ssd1306_FillCircle() and ssd1306_DrawCircle() in SSD1306 page layout.
+
+The circles are rasterized with the same Bresenham steps as the C code,
+so the tables match its output pixel for pixel.
+
+Usage: python3 Tools/gen_circles.py > Core/Src/ssd1306_circles.c
+"""
+
+R_MIN = 3
+R_MAX = 24  # PLAYER_LIMIT
+
+
+def bresenham(r):
+    """Yields the (x, y) states visited by the driver's circle loop."""
+    x, y, err = -r, 0, 2 - 2 * r
+    while True:
+        yield x, y
+        e2 = err
+        if e2 <= y:
+            y += 1
+            err += y * 2 + 1
+            if -x == y and e2 <= x:
+                e2 = 0
+        if e2 > x:
+            x += 1
+            err += x * 2 + 1
+        if x > 0:
+            break
+
+
+def outline(r):
+    pixels = set()
+    for x, y in bresenham(r):
+        pixels.update({(-x, y), (x, y), (x, -y), (-x, -y)})
+    return pixels
+
+
+def filled(r):
+    pixels = set()
+    for x, y in bresenham(r):
+        for py in range(-y, y + 1):
+            for px in range(x, -x + 1):
+                pixels.add((px, py))
+    return pixels
+
+
+def pages(r, pixels):
+    """Page layout of the (2r+1) x (2r+1) box: page by page, one byte per column."""
+    d = 2 * r + 1
+    data = []
+    for page in range((d + 7) // 8):
+        for col in range(d):
+            byte = 0
+            for bit in range(8):
+                if (col - r, page * 8 + bit - r) in pixels:
+                    byte |= 1 << bit
+            data.append(byte)
+    return data
+
+
+def emit(name, shape):
+    offsets = []
+    data = []
+    for r in range(R_MIN, R_MAX + 1):
+        offsets.append(len(data))
+        data += pages(r, shape(r))
+    print("const uint8_t %s[] = {" % name)
+    for r, off in zip(range(R_MIN, R_MAX + 1), offsets):
+        chunk = data[off:off + (2 * r + 1) * ((2 * r + 8) // 8)]
+        print("// r = %d" % r)
+        for i in range(0, len(chunk), 16):
+            print(" ".join("0x%02X," % b for b in chunk[i:i + 16]))
+    print("};\n")
+    return offsets
+
+
+def main():
+    print("/*")
+    print(" * Generated by Tools/gen_circles.py, do not edit.")
+    print(" * Circle masks for radius %d..%d in SSD1306 page layout." % (R_MIN, R_MAX))
+    print(" */\n")
+    print('#include "ssd1306_circles.h"\n')
+    offsets = emit("SSD1306_FilledCircles", filled)
+    emit("SSD1306_OutlineCircles", outline)
+    print("const uint16_t SSD1306_CircleOffsets[] = {")
+    print(" ".join("%d," % o for o in offsets))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""
+Converts a grayscale image to a 1 bpp bitmap with ordered (8x8 Bayer)
+dithering, for pasting into Core/Src/bitmaps.c.
+
+The input is a binary or ASCII PGM (P5/P2), which any image editor can export.
+A pixel is lit when its gray level, scaled to 0..64, is above the Bayer
+threshold of its position, the same rule ssd1306_BayerPattern() uses, so
+dithered art matches the pattern fills on screen. Use --invert for art drawn
+dark on light.
+
+The output is row-major (MSB = leftmost pixel) like the other bitmaps.c
+arrays, or SSD1306 page layout with --pages (see gen_page_bitmaps.py).
+
+Usage: python3 Tools/gen_dither.py [--pages] [--invert] image.pgm name >> Core/Src/bitmaps.c
+"""
+
+import sys
+
+BAYER = [
+    [0, 32, 8, 40, 2, 34, 10, 42],
+    [48, 16, 56, 24, 50, 18, 58, 26],
+    [12, 44, 4, 36, 14, 46, 6, 38],
+    [60, 28, 52, 20, 62, 30, 54, 22],
+    [3, 35, 11, 43, 1, 33, 9, 41],
+    [51, 19, 59, 27, 49, 17, 57, 25],
+    [15, 47, 7, 39, 13, 45, 5, 37],
+    [63, 31, 55, 23, 61, 29, 53, 21],
+]
+
+
+def read_pgm(path):
+    data = open(path, "rb").read()
+    # Header tokens: magic, width, height, maxval, '#' starts a comment
+    tokens = []
+    pos = 0
+    while len(tokens) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            while data[pos:pos + 1] not in (b"\n", b""):
+                pos += 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        tokens.append(data[start:pos])
+    magic = tokens[0]
+    width, height, maxval = (int(t) for t in tokens[1:])
+    if magic == b"P5":
+        assert maxval < 256, "16 bit PGM not supported"
+        pixels = list(data[pos + 1:pos + 1 + width * height])
+    elif magic == b"P2":
+        pixels = [int(v) for v in data[pos:].split()][:width * height]
+    else:
+        sys.exit("%s: not a PGM file" % path)
+    assert len(pixels) == width * height, "truncated image"
+    return width, height, [p * 64 // maxval for p in pixels]
+
+
+def dither(width, height, levels, invert):
+    lit = []
+    for y in range(height):
+        for x in range(width):
+            level = levels[y * width + x]
+            if invert:
+                level = 64 - level
+            lit.append(BAYER[y % 8][x % 8] < level)
+    return lit
+
+
+def rows(width, height, lit):
+    data = []
+    for y in range(height):
+        for bx in range(0, width, 8):
+            byte = 0
+            for x in range(bx, min(bx + 8, width)):
+                if lit[y * width + x]:
+                    byte |= 0x80 >> (x - bx)
+            data.append(byte)
+    return data
+
+
+def pages(width, height, lit):
+    data = []
+    for page in range((height + 7) // 8):
+        for x in range(width):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height and lit[y * width + x]:
+                    byte |= 1 << bit
+            data.append(byte)
+    return data
+
+
+def main():
+    args = sys.argv[1:]
+    page_layout = "--pages" in args
+    invert = "--invert" in args
+    args = [a for a in args if not a.startswith("--")]
+    if len(args) != 2:
+        sys.exit(__doc__)
+    path, name = args
+
+    width, height, levels = read_pgm(path)
+    lit = dither(width, height, levels, invert)
+    data = (pages if page_layout else rows)(width, height, lit)
+
+    print("\n/* %s, %dx%d, ordered dither by Tools/gen_dither.py */" % (name, width, height))
+    print("const unsigned char %s[] = {" % name)
+    for i in range(0, len(data), 16):
+        print("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    print("};")
+    sys.stderr.write("%s: %dx%d, %d bytes, %d of %d pixels lit\n"
+                     % (name, width, height, len(data), sum(lit), len(lit)))
+
+
+if __name__ == "__main__":
+    main()
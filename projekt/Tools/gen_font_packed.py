@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""
+Generates Core/Src/ssd1306_fonts_packed.c: the fonts of Core/Src/ssd1306_fonts.c
+in the packed format ssd1306_WriteChar() reads when SSD1306_USE_PACKED_FONTS is
+defined. The row and page arrays are left out then.
+
+Each glyph is cut down to the bounding box of its set pixels and stored column
+by column, box height bits per column, bit 0 of a column = top row of the box,
+bits filled LSB first. Glyphs start on a byte. The SSD1306_PackedGlyph_t table
+holds the byte offset and the box of every glyph, 4 bytes each. Proportional
+fonts keep their advance widths. The flash each font takes before and after is
+printed to stderr.
+
+Usage: python3 Tools/gen_font_packed.py Core/Src/ssd1306_fonts.c > Core/Src/ssd1306_fonts_packed.c
+"""
+
+import re
+import sys
+
+from gen_font_pages import ARRAY_RE, GLYPHS, HEX_RE, strip_comments
+
+FONT_RE = re.compile(r"const SSD1306_Font_t Font_(\w+) = \{(\d+), (\d+), (\w+), (\w+),")
+WIDTHS_RE = re.compile(r"static const uint8_t (\w+)\[\] = \{(.*?)\};", re.S)
+
+
+def bounding_box(rows, width, height):
+    """Left column, top row, width and height of the set pixels, all 0 for a blank glyph"""
+    cols = [x for x in range(width) if any((rows[y] << x) & 0x8000 for y in range(height))]
+    lines = [y for y in range(height) if rows[y] & (0xFFFF << (16 - width)) & 0xFFFF]
+    if not cols:
+        return 0, 0, 0, 0
+    return cols[0], lines[0], cols[-1] - cols[0] + 1, lines[-1] - lines[0] + 1
+
+
+def pack_glyph(rows, width, height):
+    """Box and bytes of one glyph"""
+    x, y, w, h = bounding_box(rows, width, height)
+    bits = [(rows[y + r] << (x + c)) & 0x8000 != 0 for c in range(w) for r in range(h)]
+    data = []
+    for i in range(0, len(bits), 8):
+        data.append(sum(1 << b for b, on in enumerate(bits[i:i + 8]) if on))
+    return (x, y, w, h), data
+
+
+def pack_font(rows, width, height):
+    """Glyph table entries (offset, x, y, w, h) and the packed bytes of a font"""
+    glyphs = []
+    data = []
+    for ch in range(GLYPHS):
+        box, glyph = pack_glyph(rows[ch * height:(ch + 1) * height], width, height)
+        glyphs.append((len(data),) + box)
+        data += glyph
+    assert len(data) < 1 << 13, "offset does not fit SSD1306_PackedGlyph_t"
+    return glyphs, data
+
+
+def packed_size(glyphs, data, proportional):
+    return len(data) + 4 * len(glyphs) + (GLYPHS if proportional else 0)
+
+
+def load_fonts(path):
+    """(size, width, height, rows, advance widths or None) of every font in ssd1306_fonts.c"""
+    source = open(path).read()
+    arrays = {name: [int(v, 16) for v in HEX_RE.findall(strip_comments(body))]
+              for name, body in ARRAY_RE.findall(source)}
+    widths = {name: [int(v) for v in re.findall(r"\d+", strip_comments(body))]
+              for name, body in WIDTHS_RE.findall(source)}
+    fonts = []
+    for size, width, height, array, char_width in FONT_RE.findall(source):
+        width, height = int(width), int(height)
+        rows = arrays[array]
+        assert len(rows) == GLYPHS * height, array
+        fonts.append((size, array, width, height, rows, widths.get(char_width)))
+    return fonts
+
+
+def main():
+    fonts = load_fonts(sys.argv[1])
+
+    print("/*")
+    print(" * Generated by Tools/gen_font_packed.py, do not edit.")
+    print(" * Fonts of ssd1306_fonts.c packed to the bounding box of each glyph.")
+    print(" */\n")
+    print('#include "ssd1306_fonts.h"\n')
+    print("#ifdef SSD1306_USE_PACKED_FONTS\n")
+    for size, array, width, height, rows, advance in fonts:
+        glyphs, data = pack_font(rows, width, height)
+        print("#ifdef SSD1306_INCLUDE_FONT_%s" % size)
+        print("static const uint8_t %s_packed[] = {" % array)
+        for ch, (offset, x, y, w, h) in enumerate(glyphs):
+            end = glyphs[ch + 1][0] if ch + 1 < GLYPHS else len(data)
+            if end > offset:
+                print("// %r" % chr(ch + 32))
+                for i in range(offset, end, 16):
+                    print(" ".join("0x%02X," % b for b in data[i:min(i + 16, end)]))
+        print("};")
+        print("static const SSD1306_PackedGlyph_t %s_glyphs[] = {" % array)
+        for ch, glyph in enumerate(glyphs):
+            print("{%d, %d, %d, %d, %d}, // %r" % (glyph + (chr(ch + 32),)))
+        print("};")
+        widths = "NULL"
+        if advance:
+            widths = "%s_widths" % array
+            print("static const uint8_t %s[] = {" % widths)
+            for i in range(0, GLYPHS, 16):
+                print(" ".join("%d," % v for v in advance[i:i + 16]))
+            print("};")
+        print("const SSD1306_Font_t Font_%s = {%d, %d, NULL, %s, NULL, %s_glyphs, %s_packed};"
+              % (size, width, height, widths, array, array))
+        print("#endif\n")
+
+        before = GLYPHS * height * 2 + GLYPHS * width * ((height + 7) // 8) + (GLYPHS if advance else 0)
+        after = packed_size(glyphs, data, advance)
+        sys.stderr.write("Font_%s: %d bytes rows + pages, %d packed (%d glyph bits, %d table), %d saved\n"
+                         % (size, before, after, len(data), 4 * GLYPHS, before - after))
+    print("#endif")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""
+Generates Core/Src/ssd1306_fonts_pages.c: the fonts of Core/Src/ssd1306_fonts.c
+converted to SSD1306 page layout for the glyph blitter in ssd1306_WriteChar().
+
+Each glyph is stored page by page, one byte per column (bit 0 = top row),
+padded to whole pages: width * ((height + 7) / 8) bytes per glyph.
+
+Left out with SSD1306_USE_PACKED_FONTS, see gen_font_packed.py.
+
+Usage: python3 Tools/gen_font_pages.py Core/Src/ssd1306_fonts.c > Core/Src/ssd1306_fonts_pages.c
+"""
+
+import re
+import sys
+
+# Matches the font definitions at the end of ssd1306_fonts.c
+FONT_RE = re.compile(r"const SSD1306_Font_t Font_(\w+) = \{(\d+), (\d+), (\w+),")
+ARRAY_RE = re.compile(r"static const uint16_t (\w+) \[\] = \{(.*?)\};", re.S)
+HEX_RE = re.compile(r"0x[0-9A-Fa-f]{4}")
+GLYPHS = 126 - 32 + 1
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def pages(rows, width, height):
+    data = []
+    for page in range((height + 7) // 8):
+        for col in range(width):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height and (rows[y] << col) & 0x8000:
+                    byte |= 1 << bit
+            data.append(byte)
+    return data
+
+
+def main():
+    source = open(sys.argv[1]).read()
+    arrays = {name: [int(v, 16) for v in HEX_RE.findall(strip_comments(body))]
+              for name, body in ARRAY_RE.findall(source)}
+
+    print("/*")
+    print(" * Generated by Tools/gen_font_pages.py, do not edit.")
+    print(" * Fonts of ssd1306_fonts.c in SSD1306 page layout.")
+    print(" */\n")
+    print('#include "ssd1306_fonts.h"\n')
+    print("#ifndef SSD1306_USE_PACKED_FONTS\n")
+    for size, width, height, array in FONT_RE.findall(source):
+        width, height = int(width), int(height)
+        rows = arrays[array]
+        assert len(rows) == GLYPHS * height, array
+        print("#ifdef SSD1306_INCLUDE_FONT_%s" % size)
+        print("const uint8_t %s_pages[] = {" % array)
+        for ch in range(GLYPHS):
+            glyph = pages(rows[ch * height:(ch + 1) * height], width, height)
+            print("// %r" % chr(ch + 32))
+            for i in range(0, len(glyph), 16):
+                print(" ".join("0x%02X," % b for b in glyph[i:i + 16]))
+        print("};")
+        print("#endif\n")
+    print("#endif")
+
+
+if __name__ == "__main__":
+    main()
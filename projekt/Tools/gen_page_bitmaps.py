@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+"""
+Generates Core/Src/bitmaps_pages.c: 128x64 row-major bitmaps of
+Core/Src/bitmaps.c (1 bpp, MSB = leftmost pixel) converted to SSD1306 page
+layout for ssd1306_DrawBitmapPages() and ssd1306_BlitBitmapPages().
+
+Each bitmap is stored page by page, one byte per column (bit 0 = top row),
+so a full-screen image has exactly the layout of the screen buffer.
+
+Only the named bitmaps are converted, all of them if no names are given.
+The fireworks frames are stored as an animation instead, see gen_animation.py.
+
+Usage: python3 Tools/gen_page_bitmaps.py Core/Src/bitmaps.c menu > Core/Src/bitmaps_pages.c
+"""
+
+import re
+import sys
+
+WIDTH = 128
+HEIGHT = 64
+
+ARRAY_RE = re.compile(r"const unsigned char (\w+)\s*\[\] = \{(.*?)\};", re.S)
+HEX_RE = re.compile(r"0x[0-9A-Fa-f]{2}")
+
+
+def pages(rows):
+    stride = (WIDTH + 7) // 8
+    data = []
+    for page in range((HEIGHT + 7) // 8):
+        for col in range(WIDTH):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < HEIGHT and rows[y * stride + col // 8] & (0x80 >> (col % 8)):
+                    byte |= 1 << bit
+            data.append(byte)
+    return data
+
+
+def main():
+    source = open(sys.argv[1]).read()
+    names = sys.argv[2:]
+
+    print("/*")
+    print(" * Generated by Tools/gen_page_bitmaps.py, do not edit.")
+    print(" * Bitmaps of bitmaps.c in SSD1306 page layout.")
+    print(" */\n")
+    print('#include "bitmaps.h"\n')
+    for name, body in ARRAY_RE.findall(source):
+        if names and name not in names:
+            continue
+        rows = [int(v, 16) for v in HEX_RE.findall(body)]
+        assert len(rows) == (WIDTH + 7) // 8 * HEIGHT, name
+        data = pages(rows)
+        print("const unsigned char %s_pages[] = {" % name)
+        for i in range(0, len(data), 16):
+            print("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+        print("};")
+
+
+if __name__ == "__main__":
+    main()
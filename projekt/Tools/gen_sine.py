@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""
+Generates Core/Src/ssd1306_sine.c: the quarter wave sine table used by
+ssd1306_DrawArc() and ssd1306_DrawArcWithRadiusLine() instead of sinf/cosf.
+
+SSD1306_Sine[d] is sin(d degrees) in Q15 for d = 0..90. The driver takes
+angles in 1/256 degree, mirrors them into the first quadrant and
+interpolates linearly between two entries.
+
+The arc endpoints of the fixed-point version are compared with the float
+version it replaces (pi = 3.14) and with exact sines for every sweep and
+radius; the statistics are printed to stderr. Tools/host/test_arc.c does the
+same with the driver itself and the float code it replaced.
+
+Usage: python3 Tools/gen_sine.py > Core/Src/ssd1306_sine.c
+"""
+
+import math
+import sys
+
+ONE = 1 << 15
+STEPS = 256  # angle units per degree
+SEGMENTS = 36  # CIRCLE_APPROXIMATION_SEGMENTS
+R_MAX = 63
+
+TABLE = [round(math.sin(math.radians(d)) * ONE) for d in range(91)]
+
+
+def trunc_div(a, b):
+    """C integer division, rounds towards zero."""
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b > 0) else -q
+
+
+def fixed_sin(angle):
+    """The driver's ssd1306_Sin()."""
+    angle %= 360 * STEPS
+    quadrant, a = divmod(angle, 90 * STEPS)
+    if quadrant & 1:
+        a = 90 * STEPS - a
+    i, f = divmod(a, STEPS)
+    s = TABLE[i] if f == 0 else TABLE[i] + (TABLE[i + 1] - TABLE[i]) * f // STEPS
+    return -s if quadrant & 2 else s
+
+
+def fixed_point(r, angle):
+    return (trunc_div(fixed_sin(angle) * r, ONE),
+            trunc_div(fixed_sin(angle + 90 * STEPS) * r, ONE))
+
+
+def float_point(r, deg, pi):
+    rad = deg * pi / 180.0
+    return int(math.sin(rad) * r), int(math.cos(rad) * r)
+
+
+def arc_angles(sweep):
+    """Endpoint angles of the segments ssd1306_DrawArc() draws from 0 degrees."""
+    segments = sweep * SEGMENTS // 360
+    for count in range(segments):
+        yield count * sweep / segments, count * sweep * STEPS // segments
+    yield sweep, sweep * STEPS
+
+
+def compare():
+    total = vs_float = vs_exact = 0
+    worst = 0.0
+    for sweep in range(10, 361):
+        for deg, angle in arc_angles(sweep):
+            for r in range(1, R_MAX + 1):
+                p = fixed_point(r, angle)
+                total += 1
+                vs_float += p != float_point(r, deg, 3.14)
+                vs_exact += p != float_point(r, deg, math.pi)
+                exact = (math.sin(math.radians(deg)) * r, math.cos(math.radians(deg)) * r)
+                worst = max(worst, abs(p[0] - exact[0]), abs(p[1] - exact[1]))
+    err = sys.stderr
+    print("endpoints: %d (sweep 10..360, radius 1..%d)" % (total, R_MAX), file=err)
+    print("differ from float, pi = 3.14: %d (%.2f%%)" % (vs_float, 100.0 * vs_float / total), file=err)
+    print("differ from exact sines:      %d (%.2f%%)" % (vs_exact, 100.0 * vs_exact / total), file=err)
+    print("largest distance from the true point: %.3f px" % worst, file=err)
+
+
+def main():
+    print("/*")
+    print(" * Generated by Tools/gen_sine.py, do not edit.")
+    print(" * sin(0..90 degrees) in Q15.")
+    print(" */\n")
+    print('#include "ssd1306_sine.h"\n')
+    print("const uint16_t SSD1306_Sine[] = {")
+    for i in range(0, len(TABLE), 10):
+        print(" ".join("%5d," % v for v in TABLE[i:i + 10]))
+    print("};")
+    compare()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""
+Timing model of the gray mode (SSD1306_USE_GRAYSCALE): prints the bus time,
+the bus load and the highest subframe rate for every SPI1 prescaler.
+
+The gray mode shows the high plane for two subframes and the low plane for
+one. At the two plane switches per cycle ssd1306_GrayPoll() sends the window
+where the planes differ: 6 command bytes (0x21/0x22 window) in one blocking
+HAL call, then the data with DMA, one transfer for whole-width windows and
+one per page otherwise. Between the two high subframes nothing is sent.
+
+The model counts the same bytes as the driver, so "bytes/subframe" can be
+checked against a bus trace, SSD1306_USE_BUS_STATS or the tick driven run of
+Tools/host/test_gray.c. A subframe must not be
+shorter than one panel frame or parts of it are never shown, the panel frame
+rate is Fosc / (K * MUX) with K = 50 + precharge phases (0xD9 = 0x22: 4).
+
+Usage: python3 Tools/gray_timing.py [subframe_hz]
+"""
+
+import sys
+
+PCLK2 = 80e6              # SystemClock_Config(): HSI 16 MHz * 10 / 2, APB2 / 1
+PRESCALERS = [2, 4, 8, 16, 32, 64, 128, 256]
+CURRENT_PRESCALER = 8     # MX_SPI1_Init()
+COMMAND_CALL_S = 2.0e-6   # GPIO + HAL_SPI_Transmit() set up per command burst
+DMA_CALL_S = 3.0e-6       # HAL_SPI_Transmit_DMA() + transfer complete interrupt
+FOSC_HZ = 500e3           # Oscillator with 0xD5 = 0xF0, datasheet 333..407 kHz at reset (0x80)
+K = 50 + 2 + 2
+MUX = 64
+TICK_HZ = 1000            # SysTick
+GRAY_TICKS = 7            # SSD1306_GRAY_TICKS
+
+# Window where the planes differ: columns, pages
+SCENES = [
+    ("bot r=3 (7 x 2 pages)", 7, 2),
+    ("bot r=10 (21 x 4 pages)", 21, 4),
+    ("bot r=24 (49 x 7 pages)", 49, 7),
+    ("full screen", 128, 8),
+]
+
+
+def switch_time(prescaler, cols, pages):
+    """Bus time of one plane switch and the bytes it sends"""
+    byte_s = 8 / (PCLK2 / prescaler)
+    data = cols * pages
+    transfers = 1 if cols == 128 else pages
+    t = COMMAND_CALL_S + 6 * byte_s + transfers * DMA_CALL_S + data * byte_s
+    return t, 6 + data
+
+
+def main():
+    subframe_hz = float(sys.argv[1]) if len(sys.argv) > 1 else TICK_HZ / GRAY_TICKS
+    panel_hz = FOSC_HZ / (K * MUX)
+
+    print("Panel frame rate ~%.0f Hz (Fosc %.0f kHz), subframe rate %.0f Hz, gray cycle %.0f Hz"
+          % (panel_hz, FOSC_HZ / 1e3, subframe_hz, subframe_hz / 3))
+    if subframe_hz > panel_hz:
+        print("WARNING: subframes shorter than a panel frame, raise SSD1306_GRAY_TICKS")
+    print()
+
+    for name, cols, pages in SCENES:
+        print("%s" % name)
+        print("  prescaler  SPI MHz  switch us  bytes/subframe  max subframe Hz  bus load")
+        for prescaler in PRESCALERS:
+            t, nbytes = switch_time(prescaler, cols, pages)
+            # Two switches per three subframes, the worst subframe is a switch
+            load = subframe_hz * 2 / 3 * t
+            mark = " <- MX_SPI1_Init" if prescaler == CURRENT_PRESCALER else ""
+            print("  %9d  %7.2f  %9.1f  %14.1f  %15.0f  %7.1f%%%s"
+                  % (prescaler, PCLK2 / prescaler / 1e6, t * 1e6, nbytes * 2 / 3,
+                     1 / t, load * 100, mark))
+        # Slowest SPI clock that keeps the switch inside a subframe with half of it left for the game
+        ok = [p for p in PRESCALERS if switch_time(p, cols, pages)[0] <= 0.5 / subframe_hz]
+        print("  slowest prescaler with the switch under half a subframe: %s\n"
+              % (max(ok) if ok else "none"))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,13 @@
+/* newlib's _ansi.h for the host build, only what the project headers use */
+#ifndef TOOLS_HOST_ANSI_H_
+#define TOOLS_HOST_ANSI_H_
+
+#ifdef __cplusplus
+#define _BEGIN_STD_C extern "C" {
+#define _END_STD_C   }
+#else
+#define _BEGIN_STD_C
+#define _END_STD_C
+#endif
+
+#endif /* TOOLS_HOST_ANSI_H_ */
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""
+Builds and runs the host tests: every test_*.c in this directory is compiled
+with gcc against the drawing sources of Core/Src, sim_panel.c and sim_hal.c,
+and passes when it exits with 0. What the tests print (bus bytes, timings)
+is shown under their name.
+
+A test includes ssd1306.c itself. Lines of the form
+
+    // host: FLAGS
+
+build and run it once per line instead of once with ssd1306_conf.h as it is.
+FLAGS are gcc options, plus
+    no-OPTION   ssd1306_conf.h without #define SSD1306_OPTION
+    plain       no-USE_DIRTY_UPDATE no-USE_DMA no-USE_GRAYSCALE no-USE_DISPLAY_LIST,
+                the driver as it was before those options
+A test gets a scratch directory as its argument. A line
+
+    // host-check: COMMAND
+
+is run afterwards from this directory, {out} replaced by that directory.
+
+Usage: python3 Tools/host/run_tests.py [test_name ...]
+"""
+
+import glob
+import os
+import re
+import shlex
+import subprocess
+import sys
+import tempfile
+
+HOST = os.path.dirname(os.path.abspath(__file__))
+PROJECT = os.path.normpath(os.path.join(HOST, "..", ".."))
+SOURCES = ["ssd1306_circles.c", "ssd1306_sine.c", "ssd1306_fonts.c", "ssd1306_fonts_pages.c",
+           "ssd1306_fonts_packed.c", "bitmaps.c", "bitmaps_pages.c", "bitmaps_anim.c"]
+INCLUDES = ["Core/Inc", "Core/Src", "Drivers/STM32L4xx_HAL_Driver/Inc",
+            "Drivers/STM32L4xx_HAL_Driver/Inc/Legacy", "Drivers/CMSIS/Device/ST/STM32L4xx/Include",
+            "Drivers/CMSIS/Include"]
+CFLAGS = ["-std=gnu11", "-O1", "-g", "-Wall", "-Wno-unused-function", "-Wno-unused-variable",
+          "-Wno-unused-but-set-variable",
+          "-Wno-int-to-pointer-cast", "-DUSE_HAL_DRIVER", "-DSTM32L476xx"]
+PLAIN = ["no-USE_DIRTY_UPDATE", "no-USE_DMA", "no-USE_GRAYSCALE", "no-USE_DISPLAY_LIST"]
+
+
+def configure(options, work):
+    """ssd1306.h and an ssd1306_conf.h without the options in work, the gcc flags using them"""
+    if not options:
+        return []
+    with open(os.path.join(PROJECT, "Core/Inc/ssd1306_conf.h")) as f:
+        conf = f.read()
+    for option in options:
+        conf = re.sub(r"(?m)^#define SSD1306_%s\b" % option, "// #define SSD1306_%s" % option, conf)
+    with open(os.path.join(work, "ssd1306_conf.h"), "w") as f:
+        f.write(conf)
+    with open(os.path.join(PROJECT, "Core/Inc/ssd1306.h")) as f, open(os.path.join(work, "ssd1306.h"), "w") as g:
+        g.write(f.read())
+    # Headers next to ssd1306.h in Core/Inc would find the original otherwise
+    return ["-I" + work, "-include", os.path.join(work, "ssd1306.h")]
+
+
+def builds(path):
+    """Flag lists of the builds of a test and its checks"""
+    text = open(path).read()
+    lines = re.findall(r"(?m)^// host: *(.*)$", text) or [""]
+    checks = re.findall(r"(?m)^// host-check: *(.*)$", text)
+    return [shlex.split(line) for line in lines], checks
+
+
+def run(path, flags, checks):
+    with tempfile.TemporaryDirectory() as work:
+        options = []
+        gcc = []
+        for flag in flags:
+            if flag == "plain":
+                options += [o[3:] for o in PLAIN]
+            elif flag.startswith("no-"):
+                options.append(flag[3:])
+            else:
+                gcc.append(flag)
+        exe = os.path.join(work, "test")
+        command = (["gcc"] + CFLAGS + configure(options, work) + ["-I" + HOST]
+                   + ["-I" + os.path.join(PROJECT, i) for i in INCLUDES] + gcc
+                   + [path] + [os.path.join(PROJECT, "Core/Src", s) for s in SOURCES]
+                   + [os.path.join(HOST, "sim_panel.c"), os.path.join(HOST, "sim_hal.c"), "-o", exe, "-lm"])
+        build = subprocess.run(command, capture_output=True, text=True)
+        if build.returncode != 0:
+            return False, build.stderr
+        result = subprocess.run([exe, work], capture_output=True, text=True)
+        output = result.stdout + result.stderr
+        ok = result.returncode == 0
+        for check in checks:
+            if not ok:
+                break
+            result = subprocess.run(check.replace("{out}", work), shell=True, cwd=HOST,
+                                    capture_output=True, text=True)
+            output += result.stdout + result.stderr
+            ok = result.returncode == 0
+        return ok, output
+
+
+def main():
+    names = sys.argv[1:]
+    tests = sorted(glob.glob(os.path.join(HOST, "test_*.c")))
+    if names:
+        tests = [t for t in tests if os.path.basename(t)[:-2] in names or os.path.basename(t) in names]
+    failed = 0
+    for path in tests:
+        flag_lists, checks = builds(path)
+        for flags in flag_lists:
+            ok, output = run(path, flags, checks)
+            failed += not ok
+            print("%-4s %s %s" % ("ok" if ok else "FAIL", os.path.basename(path), " ".join(flags)))
+            for line in output.strip().splitlines():
+                print("     " + line)
+    print("%d failed" % failed if failed else "all passed")
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
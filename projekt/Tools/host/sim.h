@@ -0,0 +1,94 @@
+/*
+ * sim.h
+ *
+ * Simulated HAL and SSD1306 panel for the host tests in this directory,
+ * see run_tests.py. A test includes the driver source (ssd1306.c) to reach
+ * its static state; the HAL calls the driver makes land in sim_hal.c and the
+ * bytes they carry in the panel model of sim_panel.c, which knows nothing of
+ * the driver.
+ */
+
+#ifndef TOOLS_HOST_SIM_H_
+#define TOOLS_HOST_SIM_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ssd1306.h"
+
+#define SIM_COLUMNS 128
+#define SIM_PAGES   8
+
+/** Controller state kept by sim_PanelCommand() and sim_PanelData() */
+typedef struct {
+    uint8_t Ram[SIM_PAGES][SIM_COLUMNS];    /**< GDDRAM, random after sim_PanelReset() */
+    uint8_t Mode;                           /**< 0 horizontal, 1 vertical, 2 page addressing */
+    uint8_t Col1, Col2, Page1, Page2;       /**< Address window (0x21/0x22) */
+    uint8_t Col, Page;                      /**< Next data byte goes here */
+    uint8_t StartLine;                      /**< 0x40-0x7F, in rows */
+    uint8_t Offset;                         /**< 0xD3 */
+    uint8_t Contrast;
+    uint8_t On;
+    uint8_t Scrolling;                      /**< Between 0x2F and 0x2E, RAM writes are errors then */
+    uint8_t Cmd[8];                         /**< Command collecting its arguments */
+    uint8_t CmdLength;
+
+    uint32_t Bytes;                         /**< Command and data bytes */
+    uint32_t Transactions;                  /**< Bus transactions, see sim_hal.c */
+    uint32_t Selects;                       /**< SPI: falling edges of CS */
+    uint32_t Errors;                        /**< Data while scrolling or while a command misses arguments, SPI bytes without CS */
+} SimPanel_t;
+
+/** Panel behind hspi1 (the default display) unless a test points it elsewhere */
+extern SimPanel_t* simPanel;
+extern SimPanel_t simDefaultPanel;
+
+void sim_PanelReset(SimPanel_t* panel);
+void sim_PanelCommand(SimPanel_t* panel, uint8_t byte);
+void sim_PanelData(SimPanel_t* panel, uint8_t byte);
+
+/**
+ * @brief Nonzero when the rows the panel shows equal the screenbuffer,
+ *        display start line and RAM page order included.
+ */
+int sim_PanelShows(const SimPanel_t* panel, const uint8_t* buffer, uint8_t pages);
+
+/** Nonzero when the panel RAM equals buffer page for page */
+int sim_PanelRamIs(const SimPanel_t* panel, const uint8_t* buffer, uint8_t pages);
+
+/** HAL_GetTick(), moved by HAL_Delay() and the tests */
+extern uint32_t simTick;
+
+/**
+ * Background transfers of HAL_SPI_Transmit_DMA() and HAL_I2C_Mem_Write_DMA(),
+ * one at a time like one bus. They finish before the start returns unless
+ * Queue is set, then sim_DmaRun() or the next HAL_GetTick() finishes them,
+ * as the interrupt would while the driver waits.
+ */
+typedef struct {
+    uint8_t Queue;          /**< Keep started transfers until sim_DmaRun() or HAL_GetTick() */
+    uint8_t Refuse;         /**< Starts to answer with HAL_BUSY, counted down */
+    uint8_t Fail;           /**< Transfers to end with the error callback after half their bytes, counted down */
+    uint8_t Stall;          /**< Started transfers never end, every HAL_GetTick() is a millisecond later */
+    void (*Idle)(void);     /**< Called by every HAL_GetTick(), where a test runs the transfers of its own buses */
+
+    uint32_t Started;
+    uint32_t Refused;       /**< Starts answered with HAL_BUSY, Refuse or a transfer running */
+    uint32_t Failed;
+    uint32_t Aborted;       /**< HAL_SPI_Abort() calls on a running transfer */
+    uint32_t Busy;          /**< Blocking writes refused while a transfer was running */
+
+    void* Bus;              /**< Running transfer, NULL if none */
+    const uint8_t* Data;
+    uint16_t Size;
+    uint16_t Reg;           /**< I2C control byte */
+} SimDma_t;
+
+extern SimDma_t simDma;
+
+/** Finish the running transfer, 0 if there was none */
+int sim_DmaRun(void);
+
+#endif /* TOOLS_HOST_SIM_H_ */
@@ -0,0 +1,184 @@
+/*
+ * sim_hal.c
+ *
+ * The HAL functions the driver calls. SPI bytes go to simPanel as commands
+ * or data after the DC pin, I2C bytes after the control byte (0x00 commands,
+ * 0x40 data). HAL_SPI_Transmit_DMA() and HAL_I2C_Mem_Write_DMA() run as
+ * simDma says and report their end through the HAL callbacks; a test
+ * needing more defines its own.
+ */
+
+#include "sim.h"
+
+SPI_HandleTypeDef hspi1;
+I2C_HandleTypeDef hi2c1;
+uint32_t simTick;
+SimDma_t simDma;
+
+static uint8_t simDC;
+static uint8_t simCS = 1;
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* port, uint16_t pin, GPIO_PinState state) {
+    if (port == SSD1306_DC_Port && pin == SSD1306_DC_Pin) {
+        simDC = state;
+    }
+    if (port == SSD1306_CS_Port && pin == SSD1306_CS_Pin) {
+        if (simCS && state == GPIO_PIN_RESET) {
+            simPanel->Selects++;
+        }
+        simCS = state;
+    }
+}
+
+void HAL_Delay(uint32_t delay) {
+    simTick += delay;
+}
+
+uint32_t HAL_GetTick(void) {
+    if (simDma.Idle != NULL) {
+        simDma.Idle();
+    }
+    if (simDma.Stall && simDma.Bus != NULL) {
+        return simTick++;
+    }
+    sim_DmaRun();
+    return simTick;
+}
+
+static void sim_SpiBytes(const uint8_t* data, uint16_t size) {
+    for (uint16_t i = 0; i < size; i++) {
+        if (simCS) {
+            simPanel->Errors++;
+        } else if (simDC) {
+            sim_PanelData(simPanel, data[i]);
+        } else {
+            sim_PanelCommand(simPanel, data[i]);
+        }
+    }
+}
+
+static void sim_I2cBytes(uint16_t reg, const uint8_t* data, uint16_t size) {
+    for (uint16_t i = 0; i < size; i++) {
+        if (reg == 0x40) {
+            sim_PanelData(simPanel, data[i]);
+        } else {
+            sim_PanelCommand(simPanel, data[i]);
+        }
+    }
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef* hspi, const uint8_t* data, uint16_t size, uint32_t timeout) {
+    if (simDma.Bus == hspi) {
+        simDma.Busy++;
+        return HAL_BUSY;
+    }
+    simPanel->Transactions++;
+    simPanel->Bytes += size;
+    sim_SpiBytes(data, size);
+    return HAL_OK;
+}
+
+__attribute__((weak)) HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef* hi2c, uint16_t address, uint16_t reg, uint16_t regSize,
+                                                         uint8_t* data, uint16_t size, uint32_t timeout) {
+    if (simDma.Bus == hi2c) {
+        simDma.Busy++;
+        return HAL_BUSY;
+    }
+    simPanel->Transactions++;
+    simPanel->Bytes += size;
+    sim_I2cBytes(reg, data, size);
+    return HAL_OK;
+}
+
+// What main.c does
+__attribute__((weak)) void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef* hspi) {
+#ifdef SSD1306_USE_DMA
+    ssd1306_TxCpltCallback(hspi);
+#endif
+}
+
+__attribute__((weak)) void HAL_SPI_ErrorCallback(SPI_HandleTypeDef* hspi) {
+#ifdef SSD1306_USE_DMA
+    ssd1306_TxErrorCallback(hspi);
+#endif
+}
+
+__attribute__((weak)) void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef* hi2c) {
+#ifdef SSD1306_USE_DMA
+    ssd1306_TxCpltCallback(hi2c);
+#endif
+}
+
+__attribute__((weak)) void HAL_I2C_ErrorCallback(I2C_HandleTypeDef* hi2c) {
+#ifdef SSD1306_USE_DMA
+    ssd1306_TxErrorCallback(hi2c);
+#endif
+}
+
+int sim_DmaRun(void) {
+    void* bus = simDma.Bus;
+    if (bus == NULL || simDma.Stall) {
+        return 0;
+    }
+    const uint8_t failed = (simDma.Fail != 0);
+    const uint16_t size = failed ? simDma.Size / 2 : simDma.Size;
+    if (bus == (void*)&hspi1) {
+        sim_SpiBytes(simDma.Data, size);
+    } else {
+        sim_I2cBytes(simDma.Reg, simDma.Data, size);
+    }
+    // The handle is ready again before the callback, which may start the next transfer
+    simDma.Bus = NULL;
+    if (failed) {
+        simDma.Fail--;
+        simDma.Failed++;
+        if (bus == (void*)&hspi1) {
+            HAL_SPI_ErrorCallback(bus);
+        } else {
+            HAL_I2C_ErrorCallback(bus);
+        }
+    } else if (bus == (void*)&hspi1) {
+        HAL_SPI_TxCpltCallback(bus);
+    } else {
+        HAL_I2C_MemTxCpltCallback(bus);
+    }
+    return 1;
+}
+
+static HAL_StatusTypeDef sim_DmaStart(void* bus, const uint8_t* data, uint16_t size, uint16_t reg) {
+    if (simDma.Refuse || simDma.Bus != NULL) {
+        if (simDma.Refuse) {
+            simDma.Refuse--;
+        }
+        simDma.Refused++;
+        return HAL_BUSY;
+    }
+    simDma.Started++;
+    simPanel->Transactions++;
+    simPanel->Bytes += size;
+    simDma.Bus = bus;
+    simDma.Data = data;
+    simDma.Size = size;
+    simDma.Reg = reg;
+    if (!simDma.Queue) {
+        sim_DmaRun();
+    }
+    return HAL_OK;
+}
+
+__attribute__((weak)) HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef* hspi, const uint8_t* data, uint16_t size) {
+    return sim_DmaStart(hspi, data, size, 0);
+}
+
+__attribute__((weak)) HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef* hi2c, uint16_t address, uint16_t reg, uint16_t regSize,
+                                                             uint8_t* data, uint16_t size) {
+    return sim_DmaStart(hi2c, data, size, reg);
+}
+
+HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef* hspi) {
+    if (simDma.Bus == hspi) {
+        simDma.Bus = NULL;
+        simDma.Aborted++;
+    }
+    return HAL_OK;
+}
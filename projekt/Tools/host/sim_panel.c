@@ -0,0 +1,134 @@
+/*
+ * sim_panel.c
+ *
+ * SSD1306 command and data stream model after the datasheet, written
+ * without looking at the driver: addressing modes with their windows, page
+ * addressing column/page commands, start line, offset, contrast, display
+ * on/off and scroll on/off. Commands may be split across transactions.
+ */
+
+#include "sim.h"
+
+SimPanel_t simDefaultPanel;
+SimPanel_t* simPanel = &simDefaultPanel;
+
+// Argument bytes of the multi-byte commands
+static uint8_t sim_Arguments(uint8_t op) {
+    switch (op) {
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+    case 0xD5: case 0xD6: case 0xD9: case 0xDA: case 0xDB: case 0x23:
+        return 1;
+    case 0x21: case 0x22: case 0xA3:
+        return 2;
+    case 0x29: case 0x2A:
+        return 5;
+    case 0x26: case 0x27:
+        return 6;
+    default:
+        return 0;
+    }
+}
+
+void sim_PanelReset(SimPanel_t* panel) {
+    memset(panel, 0, sizeof(*panel));
+    // Power-up RAM is undefined, what the driver doesn't write shows up
+    for (int p = 0; p < SIM_PAGES; p++) {
+        for (int c = 0; c < SIM_COLUMNS; c++) {
+            panel->Ram[p][c] = rand();
+        }
+    }
+    panel->Mode = 2;
+    panel->Col2 = SIM_COLUMNS - 1;
+    panel->Page2 = SIM_PAGES - 1;
+    panel->Contrast = 0x7F;
+}
+
+static void sim_Execute(SimPanel_t* panel, const uint8_t* cmd) {
+    const uint8_t op = cmd[0];
+    if (op <= 0x0F) {
+        panel->Col = (panel->Col & 0xF0) | op;
+    } else if (op <= 0x1F) {
+        panel->Col = (panel->Col & 0x0F) | ((op & 0x07) << 4);
+    } else if (op == 0x20) {
+        panel->Mode = cmd[1] & 3;
+    } else if (op == 0x21) {
+        panel->Col1 = cmd[1] & 0x7F;
+        panel->Col2 = cmd[2] & 0x7F;
+        panel->Col = panel->Col1;
+    } else if (op == 0x22) {
+        panel->Page1 = cmd[1] & 7;
+        panel->Page2 = cmd[2] & 7;
+        panel->Page = panel->Page1;
+    } else if (op == 0x2E) {
+        panel->Scrolling = 0;
+    } else if (op == 0x2F) {
+        panel->Scrolling = 1;
+    } else if (op >= 0x40 && op <= 0x7F) {
+        panel->StartLine = op & 0x3F;
+    } else if (op == 0x81) {
+        panel->Contrast = cmd[1];
+    } else if (op == 0xAE || op == 0xAF) {
+        panel->On = op & 1;
+    } else if (op >= 0xB0 && op <= 0xB7) {
+        panel->Page = op & 7;
+    } else if (op == 0xD3) {
+        panel->Offset = cmd[1] & 0x3F;
+    }
+}
+
+void sim_PanelCommand(SimPanel_t* panel, uint8_t byte) {
+    panel->Cmd[panel->CmdLength++] = byte;
+    if (panel->CmdLength > sim_Arguments(panel->Cmd[0])) {
+        sim_Execute(panel, panel->Cmd);
+        panel->CmdLength = 0;
+    }
+}
+
+void sim_PanelData(SimPanel_t* panel, uint8_t byte) {
+    if (panel->Scrolling || panel->CmdLength != 0) {
+        panel->Errors++;
+    }
+    panel->Ram[panel->Page][panel->Col] = byte;
+    if (panel->Mode == 0) {
+        if (panel->Col < panel->Col2) {
+            panel->Col++;
+        } else {
+            panel->Col = panel->Col1;
+            panel->Page = (panel->Page < panel->Page2) ? panel->Page + 1 : panel->Page1;
+        }
+    } else if (panel->Mode == 1) {
+        if (panel->Page < panel->Page2) {
+            panel->Page++;
+        } else {
+            panel->Page = panel->Page1;
+            panel->Col = (panel->Col < panel->Col2) ? panel->Col + 1 : panel->Col1;
+        }
+    } else {
+        panel->Col = (panel->Col + 1) % SIM_COLUMNS;
+    }
+}
+
+int sim_PanelShows(const SimPanel_t* panel, const uint8_t* buffer, uint8_t pages) {
+    for (int y = 0; y < pages * 8; y++) {
+        const int row = (y + panel->StartLine + panel->Offset) % (SIM_PAGES * 8);
+        for (int c = 0; c < SIM_COLUMNS; c++) {
+            const int shown = (panel->Ram[row / 8][c] >> (row % 8)) & 1;
+            const int drawn = (buffer[(y / 8) * SIM_COLUMNS + c] >> (y % 8)) & 1;
+            if (shown != drawn) {
+                printf("row %d column %d: panel %d, screenbuffer %d\n", y, c, shown, drawn);
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+int sim_PanelRamIs(const SimPanel_t* panel, const uint8_t* buffer, uint8_t pages) {
+    for (int p = 0; p < pages; p++) {
+        if (memcmp(panel->Ram[p], &buffer[p * SIM_COLUMNS], SIM_COLUMNS) != 0) {
+            printf("RAM page %d differs\n", p);
+            return 0;
+        }
+    }
+    return 1;
+}
@@ -0,0 +1,143 @@
+/*
+ * ssd1306_DrawArc() and ssd1306_DrawArcWithRadiusLine() against the sinf/cosf
+ * versions they replaced, once with pi = 3.14 as they had it and once with
+ * exact pi. Counts the segment endpoints that differ for sweeps 10..360 and
+ * radii 1..63, and the arcs on the screen that draw other pixels. Against
+ * exact pi an endpoint may only differ by a truncation tie, so by at most
+ * 1px and for under 1% of them; against 3.14 the difference is the pi error.
+ * Prints both counts and the host ns per arc of the table and float versions.
+ */
+// host:
+
+#define _POSIX_C_SOURCE 199309L
+#include <math.h>
+#include <time.h>
+
+#include "ssd1306.c"
+#include "sim.h"
+
+#define SEGMENTS 36
+#define PI_3_14  3.14f
+#define PI_EXACT 3.14159265f
+
+static uint8_t fixedArc[SSD1306_BUFFER_SIZE];
+
+static double nowNs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// Endpoint count of the arc the way the float version computed it
+static void floatPoint(uint8_t x, uint8_t y, uint8_t radius, uint32_t count, uint32_t sweep, uint32_t segments,
+                       float pi, int16_t* px, int16_t* py) {
+    const float approx_degree = sweep / (float)segments;
+    const float rad = ((count != segments) ? count * approx_degree : sweep) * (pi / 180.0f);
+    *px = x + (int8_t)(sinf(rad) * radius);
+    *py = y + (int8_t)(cosf(rad) * radius);
+}
+
+// ssd1306_DrawArc() and ssd1306_DrawArcWithRadiusLine() before the sine table, pi as given
+static void floatArc(uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep, float pi,
+                     int radiusLine) {
+    const uint32_t loc_sweep = ssd1306_NormalizeTo0_360(sweep);
+    uint32_t count = (ssd1306_NormalizeTo0_360(start_angle) * SEGMENTS) / 360;
+    const uint32_t segments = (loc_sweep * SEGMENTS) / 360;
+    int16_t xp1, yp1, xp2 = 0, yp2 = 0, firstX, firstY;
+
+    floatPoint(x, y, radius, count, loc_sweep, segments, pi, &firstX, &firstY);
+    while (count < segments) {
+        floatPoint(x, y, radius, count, loc_sweep, segments, pi, &xp1, &yp1);
+        count++;
+        floatPoint(x, y, radius, count, loc_sweep, segments, pi, &xp2, &yp2);
+        ssd1306_Line(xp1, yp1, xp2, yp2, White);
+    }
+    if (radiusLine) {
+        ssd1306_Line(x, y, firstX, firstY, White);
+        ssd1306_Line(x, y, xp2, yp2, White);
+    }
+}
+
+// Arcs on the screen that draw other pixels than the float version with pi
+static int arcsDiffer(float pi, int radiusLine, int* arcs) {
+    int differ = 0;
+    *arcs = 0;
+    for (int sweep = 10; sweep <= 360; sweep += 7) {
+        for (int r = 1; r <= 31; r += 3) {
+            ssd1306_Fill(Black);
+            if (radiusLine) {
+                ssd1306_DrawArcWithRadiusLine(64, 32, r, 0, sweep, White);
+            } else {
+                ssd1306_DrawArc(64, 32, r, 0, sweep, White);
+            }
+            memcpy(fixedArc, SSD1306_Buffer, SSD1306_BUFFER_SIZE);
+            ssd1306_Fill(Black);
+            floatArc(64, 32, r, 0, sweep, pi, radiusLine);
+            differ += memcmp(fixedArc, SSD1306_Buffer, SSD1306_BUFFER_SIZE) != 0;
+            (*arcs)++;
+        }
+    }
+    return differ;
+}
+
+// ns per 270 degree gauge of radius 22
+static double timeArc(int fixed, int radiusLine) {
+    const int runs = 20000;
+    const double start = nowNs();
+    for (int i = 0; i < runs; i++) {
+        if (!fixed) {
+            floatArc(64, 40, 22, 0, 270, PI_EXACT, radiusLine);
+        } else if (radiusLine) {
+            ssd1306_DrawArcWithRadiusLine(64, 40, 22, 0, 270, White);
+        } else {
+            ssd1306_DrawArc(64, 40, 22, 0, 270, White);
+        }
+    }
+    return (nowNs() - start) / runs;
+}
+
+int main(void) {
+    sim_PanelReset(simPanel);
+    ssd1306_Init();
+
+    uint32_t total = 0, vs314 = 0, vsExact = 0;
+    for (uint32_t sweep = 10; sweep <= 360; sweep++) {
+        const uint32_t segments = sweep * SEGMENTS / 360;
+        for (uint32_t count = 0; count <= segments; count++) {
+            for (uint8_t r = 1; r <= 63; r++) {
+                int16_t x, y, x314, y314, xExact, yExact;
+                ssd1306_ArcPoint(0, 0, r, ssd1306_SegmentAngle(count, sweep, segments), &x, &y);
+                floatPoint(0, 0, r, count, sweep, segments, PI_3_14, &x314, &y314);
+                floatPoint(0, 0, r, count, sweep, segments, PI_EXACT, &xExact, &yExact);
+                total++;
+                vs314 += (x != x314 || y != y314);
+                if (x != xExact || y != yExact) {
+                    vsExact++;
+                    if (abs(x - xExact) > 1 || abs(y - yExact) > 1) {
+                        printf("sweep %lu, segment %lu, radius %u: %d,%d against %d,%d\n", (unsigned long)sweep,
+                               (unsigned long)count, r, x, y, xExact, yExact);
+                        return 1;
+                    }
+                }
+            }
+        }
+    }
+    printf("%lu endpoints, differ from float: pi = 3.14 %lu (%.2f%%), exact pi %lu (%.2f%%)\n",
+           (unsigned long)total, (unsigned long)vs314, 100.0 * vs314 / total, (unsigned long)vsExact,
+           100.0 * vsExact / total);
+    if (vsExact * 100 >= total) {
+        puts("1% or more differ from exact pi");
+        return 1;
+    }
+
+    int arcs;
+    const int arc314 = arcsDiffer(PI_3_14, 0, &arcs);
+    const int arcExact = arcsDiffer(PI_EXACT, 0, &arcs);
+    const int lineExact = arcsDiffer(PI_EXACT, 1, &arcs);
+    printf("arcs with other pixels, of %d: pi = 3.14 %d, exact pi %d, exact pi with radius lines %d\n",
+           arcs, arc314, arcExact, lineExact);
+
+    printf("270 degree arc r22, host ns: float %.0f, table %.0f; with radius lines float %.0f, table %.0f\n",
+           timeArc(0, 0), timeArc(1, 0), timeArc(0, 1), timeArc(1, 1));
+    return 0;
+}
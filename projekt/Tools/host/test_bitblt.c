@@ -0,0 +1,132 @@
+/*
+ * ssd1306_BitBlt() writes the same screenbuffer bytes as combining the
+ * source with the screenbuffer pixel by pixel, for every raster operation,
+ * NULL sources, any position on and off the screen and any clip rectangle,
+ * and the dirty update sends it all. Also times the 64x32 blits of
+ * ssd1306_TestBlitBenchmark(), page aligned and not, against the pixel
+ * loop. The times are host nanoseconds, they show the ratio and say
+ * nothing about target cycles.
+ */
+// host:
+// host: plain
+
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+
+#include "ssd1306.c"
+#include "sim.h"
+
+static uint8_t expected[SSD1306_BUFFER_SIZE];
+static uint8_t src[40 * 64 / 8];
+
+static const SSD1306_ROP rops[] = {
+    SSD1306_ROP_COPY, SSD1306_ROP_OR, SSD1306_ROP_AND, SSD1306_ROP_XOR, SSD1306_ROP_ANDNOT
+};
+
+static int rop(SSD1306_ROP op, int d, int s) {
+    switch (op) {
+    case SSD1306_ROP_COPY:
+        return s;
+    case SSD1306_ROP_OR:
+        return d | s;
+    case SSD1306_ROP_AND:
+        return d & s;
+    case SSD1306_ROP_XOR:
+        return d ^ s;
+    default:
+        return d & !s;
+    }
+}
+
+// ssd1306_BitBlt() one pixel at a time
+static void refBitBlt(uint8_t* buffer, int x, int y, const uint8_t* source, int w, int h, SSD1306_ROP op) {
+    for (int py = (y < 0) ? 0 : y; py < y + h && py < SSD1306_HEIGHT; py++) {
+        for (int px = (x < 0) ? 0 : x; px < x + w && px < SSD1306_WIDTH; px++) {
+            if (px < SSD1306.ClipX1 || px > SSD1306.ClipX2 || py < SSD1306.ClipY1 || py > SSD1306.ClipY2) {
+                continue;
+            }
+            const int sx = px - x;
+            const int sy = py - y;
+            const int s = source ? (source[(sy / 8) * w + sx] >> (sy % 8)) & 1 : 1;
+            uint8_t* b = &buffer[(py / 8) * SSD1306_WIDTH + px];
+            const int d = (*b >> (py % 8)) & 1;
+            *b = (*b & ~(1 << (py % 8))) | (rop(op, d, s) << (py % 8));
+        }
+    }
+}
+
+static double nowNs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+int main(void) {
+    srand(14);
+    sim_PanelReset(simPanel);
+    ssd1306_Init();
+
+    for (int i = 0; i < 200000; i++) {
+        const int w = 1 + rand() % 40;
+        const int h = 1 + rand() % 60;
+        const int x = rand() % 180 - 40;
+        const int y = rand() % 110 - 40;
+        const int solid = (rand() % 8 == 0);
+        const SSD1306_ROP op = rops[rand() % 5];
+        for (int b = 0; b < w * ((h + 7) / 8); b++) {
+            src[b] = rand();
+        }
+        if (rand() % 2) {
+            ssd1306_SetClipRect(rand() % 128, rand() % 64, rand() % 128, rand() % 64);
+        } else {
+            ssd1306_ResetClipRect();
+        }
+        for (int b = 0; b < SSD1306_BUFFER_SIZE; b++) {
+            SSD1306_Buffer[b] = rand();
+        }
+        memcpy(expected, SSD1306_Buffer, SSD1306_BUFFER_SIZE);
+        refBitBlt(expected, x, y, solid ? NULL : src, w, h, op);
+
+        ssd1306_BitBlt(x, y, solid ? NULL : src, w, h, op);
+        if (memcmp(expected, SSD1306_Buffer, SSD1306_BUFFER_SIZE) != 0) {
+            printf("differs: %dx%d at %d,%d, rop %d, %s source\n", w, h, x, y, op, solid ? "NULL" : "random");
+            return 1;
+        }
+    }
+
+    // The dirty update sends what the blits changed
+    ssd1306_ResetClipRect();
+    ssd1306_Fill(Black);
+    for (int f = 0; f < 500; f++) {
+        ssd1306_BitBlt(rand() % 140 - 10, rand() % 80 - 10, src, 1 + rand() % 40, 1 + rand() % 32, rops[rand() % 5]);
+        ssd1306_UpdateScreen();
+        if (!sim_PanelShows(simPanel, SSD1306_Buffer, SSD1306_PAGES)) {
+            printf("frame %d\n", f);
+            return 1;
+        }
+    }
+
+    // ssd1306_TestBlitBenchmark(): 64x32 XOR at y 0 and y 3, and the pixel loop
+    const int runs = 20000;
+    for (uint32_t i = 0; i < 64 * 32 / 8; i++) {
+        src[i] = (i & 1) ? 0xAA : 0x55;
+    }
+    double start = nowNs();
+    for (int i = 0; i < runs; i++) {
+        ssd1306_BitBlt(0, 0, src, 64, 32, SSD1306_ROP_XOR);
+    }
+    const double aligned = (nowNs() - start) / runs;
+    start = nowNs();
+    for (int i = 0; i < runs; i++) {
+        ssd1306_BitBlt(64, 3, src, 64, 32, SSD1306_ROP_XOR);
+    }
+    const double unaligned = (nowNs() - start) / runs;
+    start = nowNs();
+    for (int i = 0; i < runs; i++) {
+        refBitBlt(SSD1306_Buffer, 64, 3, src, 64, 32, SSD1306_ROP_XOR);
+    }
+    const double pixels = (nowNs() - start) / runs;
+    printf("200000 blits byte-identical; 64x32 XOR, host ns: aligned %.0f, unaligned %.0f, pixel loop %.0f\n",
+           aligned, unaligned, pixels);
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+ * Command sequences go out as single bursts: ssd1306_Init() leaves the
+ * panel on, at full contrast, in horizontal addressing and showing the
+ * screenbuffer, and init, a full frame, a small change, a contrast change
+ * and a scroll start and stop take no more bus transactions than with
+ * ssd1306_WriteCommands(). Prints the counts.
+ */
+// host:
+// host: plain
+
+#include "ssd1306.c"
+#include "sim.h"
+
+#ifdef SSD1306_USE_DIRTY_UPDATE
+// init, full frame, small change, contrast, scroll start and stop
+static const uint32_t most[] = { 3, 2, 4, 1, 3 };
+#else
+static const uint32_t most[] = { 17, 16, 16, 1, 3 };
+#endif
+
+static const char* const names[] = { "init", "full frame", "small change", "contrast", "scroll start+stop" };
+
+int main(void) {
+    uint32_t count[5];
+    sim_PanelReset(simPanel);
+
+    uint32_t transactions = simPanel->Transactions;
+    ssd1306_Init();
+    count[0] = simPanel->Transactions - transactions;
+    if (!simPanel->On || simPanel->Contrast != 0xFF || simPanel->Mode != 0 ||
+        !sim_PanelShows(simPanel, SSD1306_Buffer, SSD1306_PAGES)) {
+        puts("panel after init");
+        return 1;
+    }
+
+    ssd1306_FillRectangle(0, 0, 127, 63, White);
+    transactions = simPanel->Transactions;
+    ssd1306_UpdateScreen();
+    count[1] = simPanel->Transactions - transactions;
+
+    ssd1306_FillRectangle(10, 10, 30, 30, Black);
+    transactions = simPanel->Transactions;
+    ssd1306_UpdateScreen();
+    count[2] = simPanel->Transactions - transactions;
+    if (!sim_PanelShows(simPanel, SSD1306_Buffer, SSD1306_PAGES)) {
+        puts("panel after the updates");
+        return 1;
+    }
+
+    transactions = simPanel->Transactions;
+    ssd1306_SetContrast(0x40);
+    count[3] = simPanel->Transactions - transactions;
+    if (simPanel->Contrast != 0x40) {
+        puts("contrast");
+        return 1;
+    }
+
+    transactions = simPanel->Transactions;
+    ssd1306_StartScroll(SSD1306_SCROLL_RIGHT, 0, 7, 0);
+    ssd1306_StopScroll();
+    count[4] = simPanel->Transactions - transactions;
+    if (simPanel->Scrolling || simPanel->Errors != 0) {
+        puts("scroll not stopped or bus errors");
+        return 1;
+    }
+
+    for (int i = 0; i < 5; i++) {
+        printf("%s: %lu transactions\n", names[i], (unsigned long)count[i]);
+        if (count[i] > most[i]) {
+            printf("%s: more than %lu\n", names[i], (unsigned long)most[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * The default ssd1306_BusTrace() against the panel model: 30 frames of
+ * drawing, blocking and background updates and a contrast change go out
+ * through the simulated bus while the trace lines go to a UART that writes
+ * them to trace.txt. The panel model must show the screenbuffer, and the
+ * check replays trace.txt with Tools/ssd1306_emu.py, which must end with
+ * the RAM of the panel model (ram.txt) and report no errors.
+ */
+// host: -DSSD1306_USE_BUS_TRACE -DSSD1306_TRACE_UART=huartTrace
+// host: plain -DSSD1306_USE_BUS_TRACE -DSSD1306_TRACE_UART=huartTrace
+// host-check: python3 ../ssd1306_emu.py --ram {out}/trace.txt > {out}/emu.txt && ! grep ERROR {out}/emu.txt && grep '^[0-7]:' {out}/emu.txt | diff - {out}/ram.txt
+
+#include "ssd1306.c"
+#include "ssd1306_fonts.h"
+#include "sim.h"
+
+UART_HandleTypeDef huartTrace;
+static FILE* trace;
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef* huart, const uint8_t* data, uint16_t size, uint32_t timeout) {
+    if (huart != &huartTrace) {
+        return HAL_ERROR;
+    }
+    fwrite(data, 1, size, trace);
+    return HAL_OK;
+}
+
+int main(int argc, char** argv) {
+    char path[512];
+    if (argc < 2) {
+        puts("no scratch directory");
+        return 1;
+    }
+    snprintf(path, sizeof(path), "%s/trace.txt", argv[1]);
+    trace = fopen(path, "w");
+    sim_PanelReset(simPanel);
+    simDma.Queue = 1;
+
+    ssd1306_Init();
+#ifdef SSD1306_USE_DMA
+    ssd1306_WaitForTransfer();
+#endif
+    for (int f = 0; f < 30; f++) {
+        ssd1306_Fill(Black);
+        ssd1306_FillCircle(20 + f * 3, 32, 8 + f % 5, White);
+        ssd1306_SetCursor(0, 0);
+        ssd1306_WriteString("trace", Font_7x10, White);
+        ssd1306_Line(0, 63, f * 4, 40, White);
+        if (f == 10) {
+            ssd1306_SetContrast(0x30);
+        }
+#ifdef SSD1306_USE_DMA
+        if (f % 2) {
+            ssd1306_UpdateScreenAsync();
+            ssd1306_WaitForTransfer();
+            continue;
+        }
+#endif
+        ssd1306_UpdateScreen();
+    }
+    fclose(trace);
+    if (!sim_PanelShows(simPanel, SSD1306_Buffer, SSD1306_PAGES) || simPanel->Contrast != 0x30 || simPanel->Errors != 0) {
+        puts("panel after the frames");
+        return 1;
+    }
+
+    // The rows of ssd1306_emu.py --ram
+    snprintf(path, sizeof(path), "%s/ram.txt", argv[1]);
+    FILE* ram = fopen(path, "w");
+    for (int page = 0; page < SIM_PAGES; page++) {
+        for (int col = 0; col < SIM_COLUMNS; col += 32) {
+            fprintf(ram, "%d:%3d ", page, col);
+            for (int i = 0; i < 32; i++) {
+                fprintf(ram, " %02X", simPanel->Ram[page][col + i]);
+            }
+            fputc('\n', ram);
+        }
+    }
+    fclose(ram);
+    return 0;
+}
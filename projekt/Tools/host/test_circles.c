@@ -0,0 +1,108 @@
+/*
+ * ssd1306_DrawCircle() and ssd1306_FillCircle() from the circle tables
+ * write the same screenbuffer bytes as the Bresenham code drawing pixel by
+ * pixel, at any position and for radii in and around the table range. The
+ * check below regenerates the tables and compares them with the committed ones.
+ */
+// host:
+// host: plain
+// host-check: python3 ../gen_circles.py > {out}/circles.c && tr -d '\r' < ../../Core/Src/ssd1306_circles.c | cmp - {out}/circles.c
+
+#include "ssd1306.c"
+#include "sim.h"
+
+// ssd1306_DrawCircle() before the tables
+static void refDrawCircle(uint8_t par_x, uint8_t par_y, uint8_t par_r, SSD1306_COLOR par_color) {
+    int32_t x = -par_r;
+    int32_t y = 0;
+    int32_t err = 2 - 2 * par_r;
+    int32_t e2;
+
+    if (par_x >= SSD1306_WIDTH || par_y >= SSD1306_HEIGHT) {
+        return;
+    }
+    do {
+        ssd1306_DrawPixel(par_x - x, par_y + y, par_color);
+        ssd1306_DrawPixel(par_x + x, par_y + y, par_color);
+        ssd1306_DrawPixel(par_x + x, par_y - y, par_color);
+        ssd1306_DrawPixel(par_x - x, par_y - y, par_color);
+        e2 = err;
+        if (e2 <= y) {
+            y++;
+            err = err + (y * 2 + 1);
+            if (-x == y && e2 <= x) {
+                e2 = 0;
+            }
+        }
+        if (e2 > x) {
+            x++;
+            err = err + (x * 2 + 1);
+        }
+    } while (x <= 0);
+}
+
+// ssd1306_FillCircle() before the rasterizer and the tables, the uint8_t loops as int32_t
+static void refFillCircle(uint8_t par_x, uint8_t par_y, uint8_t par_r, SSD1306_COLOR par_color) {
+    int32_t x = -par_r;
+    int32_t y = 0;
+    int32_t err = 2 - 2 * par_r;
+    int32_t e2;
+
+    if (par_x >= SSD1306_WIDTH || par_y >= SSD1306_HEIGHT) {
+        return;
+    }
+    do {
+        for (int32_t _y = par_y + y; _y >= par_y - y; _y--) {
+            for (int32_t _x = par_x - x; _x >= par_x + x; _x--) {
+                ssd1306_DrawPixel((uint8_t)_x, (uint8_t)_y, par_color);
+            }
+        }
+        e2 = err;
+        if (e2 <= y) {
+            y++;
+            err = err + (y * 2 + 1);
+            if (-x == y && e2 <= x) {
+                e2 = 0;
+            }
+        }
+        if (e2 > x) {
+            x++;
+            err = err + (x * 2 + 1);
+        }
+    } while (x <= 0);
+}
+
+static uint8_t expected[SSD1306_BUFFER_SIZE];
+
+int main(void) {
+    srand(4);
+    for (int i = 0; i < 100000; i++) {
+        const int filled = rand() % 2;
+        const SSD1306_COLOR color = rand() % 2;
+        const uint8_t background = (rand() % 3 == 0) ? 0 : rand();
+        const uint8_t r = SSD1306_CIRCLE_R_MIN - 2 + rand() % (SSD1306_CIRCLE_R_MAX - SSD1306_CIRCLE_R_MIN + 5);
+        const uint8_t x = rand() % SSD1306_WIDTH;
+        const uint8_t y = rand() % SSD1306_HEIGHT;
+
+        memset(SSD1306_Buffer, background, SSD1306_BUFFER_SIZE);
+        if (filled) {
+            refFillCircle(x, y, r, color);
+        } else {
+            refDrawCircle(x, y, r, color);
+        }
+        memcpy(expected, SSD1306_Buffer, SSD1306_BUFFER_SIZE);
+
+        memset(SSD1306_Buffer, background, SSD1306_BUFFER_SIZE);
+        if (filled) {
+            ssd1306_FillCircle(x, y, r, color);
+        } else {
+            ssd1306_DrawCircle(x, y, r, color);
+        }
+        if (memcmp(expected, SSD1306_Buffer, SSD1306_BUFFER_SIZE) != 0) {
+            printf("%s circle differs: center %d,%d r %d, color %d\n", filled ? "filled" : "outline", x, y, r, color);
+            return 1;
+        }
+    }
+    puts("100000 circles byte-identical");
+    return 0;
+}
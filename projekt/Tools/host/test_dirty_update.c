@@ -0,0 +1,112 @@
+/*
+ * Dirty tracking: after every ssd1306_UpdateScreen() the panel shows the
+ * screenbuffer, and the bus traffic per game frame stays below the full
+ * frame the plain build sends.
+ */
+// host: -DSSD1306_USE_BUS_STATS
+// host: plain -DSSD1306_USE_BUS_STATS
+
+#include "ssd1306.c"
+#include "sim.h"
+
+// Bytes and transactions of one full screen: 8 x (3 commands + 128 data)
+#define FULL_BYTES          (8 * (3 + 128))
+#define FULL_TRANSACTIONS   (8 * 2)
+
+static int frameCheck(int frame) {
+    if (!sim_PanelShows(simPanel, SSD1306_Buffer, 8)) {
+        printf("frame %d\n", frame);
+        return 0;
+    }
+    return 1;
+}
+
+// The frames of ssd1306_TestBusTraffic(): a circle moving over two dots
+static SSD1306_BusStats_t testBusTrafficFrames(void) {
+    const uint32_t frames = 50;
+    ssd1306_Fill(Black);
+    ssd1306_UpdateScreen();
+    ssd1306_ResetBusStats();
+    for (uint32_t i = 0; i < frames; i++) {
+        ssd1306_Fill(Black);
+        ssd1306_DrawPixel(20, 20, White);
+        ssd1306_DrawPixel(100, 50, White);
+        ssd1306_FillCircle(10 + i, 32, 7, White);
+        ssd1306_UpdateScreen();
+        if (!frameCheck(i)) {
+            exit(1);
+        }
+    }
+    SSD1306_BusStats_t stats = ssd1306_GetBusStats();
+    stats.Bytes /= frames;
+    stats.Transactions /= frames;
+    return stats;
+}
+
+int main(void) {
+    srand(1);
+    sim_PanelReset(simPanel);
+    ssd1306_Init();
+    if (!frameCheck(-1)) {
+        return 1;
+    }
+
+    SSD1306_BusStats_t test = testBusTrafficFrames();
+    printf("ssd1306_TestBusTraffic: %lu bytes, %lu transactions per frame\n",
+           (unsigned long)test.Bytes, (unsigned long)test.Transactions);
+
+    // Game frames: a player and a bot of changing radius drift over ten dots
+    const int frames = 500;
+    int px = 10, py = 10, pr = 3, bx = 100, by = 40, br = 3;
+    int dots[10][2];
+    for (int i = 0; i < 10; i++) {
+        dots[i][0] = 15 + rand() % 99;
+        dots[i][1] = 15 + rand() % 35;
+    }
+    ssd1306_ResetBusStats();
+    for (int f = 0; f < frames; f++) {
+        px += rand() % 3 - 1;
+        py += rand() % 3 - 1;
+        bx += rand() % 3 - 1;
+        by += rand() % 3 - 1;
+        if (f % 40 == 0) {
+            pr = 3 + rand() % 22;
+            br = 3 + rand() % 22;
+        }
+        if (px > 128 - 2 * pr - 2) px = 128 - 2 * pr - 2;
+        if (py > 64 - 2 * pr - 2)  py = 64 - 2 * pr - 2;
+        if (bx > 128 - 2 * br - 2) bx = 128 - 2 * br - 2;
+        if (by > 64 - 2 * br - 2)  by = 64 - 2 * br - 2;
+        if (px < 1) px = 1;
+        if (py < 1) py = 1;
+        if (bx < 1) bx = 1;
+        if (by < 1) by = 1;
+
+        ssd1306_Fill(Black);
+        for (int i = 0; i < 10; i++) {
+            ssd1306_DrawPixel(dots[i][0], dots[i][1], White);
+        }
+        ssd1306_FillCircle(px + pr, py + pr, pr, White);
+        ssd1306_DrawCircle(bx + br, by + br, br, White);
+        ssd1306_UpdateScreen();
+        if (!frameCheck(f)) {
+            return 1;
+        }
+    }
+    SSD1306_BusStats_t game = ssd1306_GetBusStats();
+    printf("game frames: %.1f bytes, %.1f transactions per frame\n",
+           game.Bytes / (double)frames, game.Transactions / (double)frames);
+
+#ifdef SSD1306_USE_DIRTY_UPDATE
+    if (test.Bytes >= FULL_BYTES / 4 || game.Bytes >= (uint32_t)frames * FULL_BYTES) {
+        puts("no saving");
+        return 1;
+    }
+#else
+    if (test.Bytes != FULL_BYTES || test.Transactions != FULL_TRANSACTIONS) {
+        puts("full frame");
+        return 1;
+    }
+#endif
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ * ssd1306_RenderList() against the panel model: random game frames and
+ * lists of every primitive, with clipping and page scrolls, show what the
+ * primitives drawn in order after ssd1306_Fill(background) show. Lists
+ * follow each other without updates in between, so only the columns of the
+ * last and the new list go out, and the next ssd1306_UpdateScreen() puts the
+ * screenbuffer back. The queued DMA build keeps each strip on the bus until
+ * the driver waits for it. Prints the bytes a game frame sends after another
+ * one.
+ */
+// host: -DSSD1306_USE_DISPLAY_LIST -DSSD1306_INCLUDE_FONT_11x18 -DSSD1306_INCLUDE_FONT_16x26
+// host: -DSSD1306_USE_DISPLAY_LIST -DSSD1306_INCLUDE_FONT_11x18 -DSSD1306_INCLUDE_FONT_16x26 no-USE_DMA
+// host: -DSSD1306_USE_DISPLAY_LIST -DSSD1306_INCLUDE_FONT_11x18 -DSSD1306_INCLUDE_FONT_16x26 -DQUEUED_DMA
+
+#include "ssd1306.c"
+#include "ssd1306_fonts.h"
+#include "bitmaps.h"
+#include "sim.h"
+
+static SSD1306_DrawItem_t items[64];
+static SSD1306_DrawList_t list;
+static char text[4][8];
+
+static int R(int n) {
+    return rand() % n;
+}
+
+static void gameFrame(uint8_t background) {
+    ssd1306_ListBegin(&list, items, 64, background);
+    for (int i = 0; i < 10; i++) {
+        ssd1306_ListPixel(&list, 15 + R(99), 15 + R(35), White);
+    }
+    const int r1 = 3 + R(22);
+    const int r2 = 3 + R(22);
+    ssd1306_ListFillCircle(&list, r1 + R(128 - 2 * r1), r1 + R(64 - 2 * r1), r1, White);
+    ssd1306_ListCircle(&list, R(140) - 6, R(80) - 8, r2, White);
+}
+
+static void mixedFrame(uint8_t background) {
+    static const SSD1306_Font_t* const fonts[] = { &Font_6x8, &Font_7x10, &Font_11x18, &Font_16x26 };
+    ssd1306_ListBegin(&list, items, 64, background);
+    for (int i = R(12); i > 0; i--) {
+        SSD1306_COLOR color = R(2) ? White : Black;
+        if (background && R(2)) {
+            color = Black;
+        }
+        switch (R(7)) {
+        case 0:
+            ssd1306_ListPixel(&list, R(140), R(70), color);
+            break;
+        case 1:
+            ssd1306_ListLine(&list, R(300) - 80, R(200) - 60, R(300) - 80, R(200) - 60, color);
+            break;
+        case 2:
+            ssd1306_ListCircle(&list, R(128), R(64), R(30), color);
+            break;
+        case 3:
+            ssd1306_ListFillCircle(&list, R(128), R(64), R(30), color);
+            break;
+        case 4:
+            ssd1306_ListFillRectangle(&list, R(128), R(64), R(128), R(64), color);
+            break;
+        case 5: {
+            char* s = text[i % 4];
+            for (int k = 0; k < 7; k++) {
+                s[k] = 32 + R(95);
+            }
+            s[7] = 0;
+            ssd1306_ListText(&list, R(128), R(64), s, fonts[R(4)], color);
+            break;
+        }
+        default:
+            ssd1306_ListBitmapPages(&list, R(128), R(64), menu_pages, R(128) + 1, R(64) + 1, color);
+            break;
+        }
+    }
+}
+
+int main(void) {
+    srand(11);
+    sim_PanelReset(simPanel);
+#ifdef QUEUED_DMA
+    // Strips stay on the bus until the next wait, as with a real DMA
+    simDma.Queue = 1;
+#endif
+    ssd1306_Init();
+
+    for (int f = 0; f < 20000; f++) {
+        const uint8_t background = (R(8) == 0);
+        const int game = R(2);
+        if (game) {
+            gameFrame(background);
+        } else {
+            mixedFrame(background);
+        }
+        if (R(5) == 0) {
+            ssd1306_SetClipRect(R(64), R(32), 64 + R(64), 32 + R(32));
+        } else {
+            ssd1306_ResetClipRect();
+        }
+        if (R(10) == 0) {
+            ssd1306_ScrollPages(R(2) ? 1 : -1);
+        }
+
+        ssd1306_RenderList(&list);
+#ifdef SSD1306_USE_DMA
+        ssd1306_WaitForTransfer();
+#endif
+
+        // The same primitives drawn into the screenbuffer, clipped alike
+        memset(SSD1306_Buffer, background ? 0xFF : 0x00, SSD1306_BUFFER_SIZE);
+        for (uint16_t i = 0; i < list.count; i++) {
+            ssd1306_DrawItem(&list.items[i]);
+        }
+        if (!sim_PanelShows(simPanel, SSD1306_Buffer, SSD1306_PAGES)) {
+            printf("frame %d differs, game %d, background %d\n", f, game, background);
+            return 1;
+        }
+
+        // Sometimes the screenbuffer comes back with an update
+        if (R(4) == 0) {
+            ssd1306_ResetClipRect();
+            ssd1306_Fill(Black);
+            ssd1306_DrawPixel(R(128), R(64), White);
+            ssd1306_UpdateScreen();
+            if (!sim_PanelShows(simPanel, SSD1306_Buffer, SSD1306_PAGES)) {
+                printf("update after frame %d differs\n", f);
+                return 1;
+            }
+        }
+    }
+    if (simPanel->Errors != 0) {
+        printf("%lu panel errors\n", (unsigned long)simPanel->Errors);
+        return 1;
+    }
+
+    // A game loop
+    ssd1306_ResetClipRect();
+    const uint32_t bytes = simPanel->Bytes;
+    for (int f = 0; f < 1000; f++) {
+        gameFrame(Black);
+        ssd1306_RenderList(&list);
+    }
+    printf("20000 lists shown right, game frame %lu bytes on average\n", (unsigned long)((simPanel->Bytes - bytes) / 1000));
+    return 0;
+}
@@ -0,0 +1,72 @@
+/*
+ * ssd1306_FadeTo() and ssd1306_FadeUpdate() against the panel model: the
+ * contrast only moves towards the target, a fade out ends at contrast 0
+ * with the display off, a fade in turns it on first, and a fade to the
+ * current contrast sends nothing. Prints the steps and bytes of a fade.
+ */
+// host:
+
+#include "ssd1306.c"
+#include "sim.h"
+
+int main(void) {
+    sim_PanelReset(simPanel);
+    ssd1306_Init();
+    if (simPanel->Contrast != 0xFF || !simPanel->On) {
+        puts("contrast or display on after init");
+        return 1;
+    }
+
+    // Out, polled every millisecond
+    uint32_t bytes = simPanel->Bytes;
+    int last = 0xFF;
+    int steps = 0;
+    ssd1306_FadeTo(0x00, 300, 1);
+    while (ssd1306_FadeUpdate()) {
+        simTick++;
+        if (simPanel->Contrast > last || simTick > 100000) {
+            puts("fade out goes up or never ends");
+            return 1;
+        }
+        steps += (simPanel->Contrast != last);
+        last = simPanel->Contrast;
+    }
+    if (simPanel->On || simPanel->Contrast != 0) {
+        puts("display on after the fade out");
+        return 1;
+    }
+    printf("fade out: %d steps, %lu bytes\n", steps, (unsigned long)(simPanel->Bytes - bytes));
+
+    // In, polled every 10 ms
+    bytes = simPanel->Bytes;
+    last = 0;
+    steps = 0;
+    ssd1306_FadeTo(0xFF, 300, 0);
+    if (!simPanel->On) {
+        puts("fade in left the display off");
+        return 1;
+    }
+    while (ssd1306_FadeUpdate()) {
+        simTick += 10;
+        if (simPanel->Contrast < last) {
+            puts("fade in goes down");
+            return 1;
+        }
+        steps += (simPanel->Contrast != last);
+        last = simPanel->Contrast;
+    }
+    if (simPanel->Contrast != 0xFF) {
+        puts("fade in ends below 255");
+        return 1;
+    }
+    printf("fade in, 10 ms polling: %d steps, %lu bytes\n", steps, (unsigned long)(simPanel->Bytes - bytes));
+
+    // Nowhere to go
+    bytes = simPanel->Bytes;
+    ssd1306_FadeTo(0xFF, 300, 0);
+    if (ssd1306_FadeUpdate() || simPanel->Bytes != bytes) {
+        puts("fade to the current contrast sent something");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,173 @@
+/*
+ * The gray mode driven like on the target: every simulated millisecond the
+ * running DMA finishes, SysTick calls ssd1306_GrayTick() and the main loop
+ * draws, presents and calls ssd1306_GrayPoll(). The tick never touches the
+ * bus, the panel shows the plane of the subframe whenever nothing is left
+ * to send, and over a steady scene white, light and dark gray pixels are lit
+ * 3, 2 and 1 subframes of 3. Prints the bus cost of that scene, a light
+ * gray r10 bot and a dark gray bar, next to Tools/gray_timing.py.
+ */
+// host: -DSSD1306_USE_GRAYSCALE -DSSD1306_USE_BUS_STATS
+
+#include "ssd1306.c"
+#include "ssd1306_circles.h"
+#include "sim.h"
+
+static uint32_t subframes;
+static uint32_t shortest = 0xFFFF;
+static uint32_t longest;
+static uint32_t ticksInSubframe;
+
+// SysTick: the transfers of the last millisecond are done, then the tick
+static int tick(void) {
+    while (sim_DmaRun()) {
+    }
+    simTick++;
+    const uint32_t bytes = simPanel->Bytes;
+    const uint32_t started = simDma.Started;
+    const uint8_t subframe = SSD1306_GraySubframe;
+    ssd1306_GrayTick();
+    if (simPanel->Bytes != bytes || simDma.Started != started || SSD1306_GraySubframe != subframe) {
+        puts("ssd1306_GrayTick() used the bus");
+        return 0;
+    }
+    ticksInSubframe++;
+    return 1;
+}
+
+// Main loop: start a queued subframe, keep the subframe lengths
+static void poll(void) {
+    const uint8_t subframe = SSD1306_GraySubframe;
+    ssd1306_GrayPoll();
+    if (SSD1306_GraySubframe != subframe) {
+        if (subframes > 0 && ticksInSubframe < shortest) shortest = ticksInSubframe;
+        if (subframes > 0 && ticksInSubframe > longest)  longest = ticksInSubframe;
+        subframes++;
+        ticksInSubframe = 0;
+    }
+}
+
+// With nothing left to send the panel shows the front plane of the subframe
+static int showsSubframe(void) {
+    if (SSD1306_TxBusy || SSD1306_GrayPending.page1 <= SSD1306_GrayPending.page2) {
+        return 1;
+    }
+    const uint8_t* front = (SSD1306_GraySubframe == 2) ? SSD1306_GrayFront : SSD1306_FrontBuffer;
+    return sim_PanelRamIs(simPanel, front, SSD1306_PAGES);
+}
+
+static int lit(int x, int y) {
+    return (simPanel->Ram[SSD1306_RAM_PAGE(y / 8)][x] >> (y % 8)) & 1;
+}
+
+int main(void) {
+    srand(16);
+    sim_PanelReset(simPanel);
+    ssd1306_Init();
+    simDma.Queue = 1;
+
+    ssd1306_FillRectangle(0, 0, 20, 20, White);
+    ssd1306_UpdateScreen();
+    ssd1306_GrayBegin();
+    if (memcmp(SSD1306_GrayBuffer, SSD1306_Buffer, SSD1306_BUFFER_SIZE) != 0) {
+        puts("planes differ after ssd1306_GrayBegin()");
+        return 1;
+    }
+
+    // Random drawing into both planes, presented now and then
+    for (int ms = 0; ms < 20000; ms++) {
+        if (!tick()) {
+            return 1;
+        }
+        if (rand() % 8 == 0) {
+            ssd1306_SetDrawPlane(rand() % 2);
+            switch (rand() % 4) {
+            case 0:
+                ssd1306_FillCircle(rand() % 128, rand() % 64, rand() % 12, rand() % 2);
+                break;
+            case 1:
+                ssd1306_FillRectangle(rand() % 128, rand() % 64, rand() % 128, rand() % 64, rand() % 2);
+                break;
+            case 2:
+                ssd1306_Line(rand() % 128, rand() % 64, rand() % 128, rand() % 64, rand() % 2);
+                break;
+            default:
+                if (rand() % 10 == 0) {
+                    ssd1306_Fill(rand() % 2);
+                }
+                break;
+            }
+            ssd1306_SetDrawPlane(SSD1306_PLANE_HIGH);
+        }
+        if (rand() % 30 == 0) {
+            ssd1306_UpdateScreenAsync();
+        }
+        poll();
+        if (!showsSubframe()) {
+            printf("millisecond %d, subframe %d: panel differs\n", ms, SSD1306_GraySubframe);
+            return 1;
+        }
+    }
+
+    // Steady scene: a white and a light gray bot, a dark gray bar
+    static SSD1306_Sprite_t bots[2];
+    const uint8_t* circle = &SSD1306_FilledCircles[SSD1306_CircleOffsets[10 - SSD1306_CIRCLE_R_MIN]];
+    ssd1306_Fill(Black);
+    ssd1306_SetDrawPlane(SSD1306_PLANE_LOW);
+    ssd1306_Fill(Black);
+    ssd1306_SetDrawPlane(SSD1306_PLANE_HIGH);
+    ssd1306_SpriteInit(&bots[0], circle, 21, 21, White);
+    ssd1306_SpriteInit(&bots[1], circle, 21, 21, White);
+    bots[1].dim = 1;
+    ssd1306_SpriteMove(&bots[0], 10, 10);
+    ssd1306_SpriteMove(&bots[1], 70, 30);
+    ssd1306_UpdateSprites(bots, 2, Black);
+    ssd1306_SetDrawPlane(SSD1306_PLANE_LOW);
+    ssd1306_FillRectangle(100, 4, 120, 11, White);
+    ssd1306_SetDrawPlane(SSD1306_PLANE_HIGH);
+    ssd1306_UpdateScreen();
+    for (int ms = 0; ms < 3 * SSD1306_GRAY_TICKS + 1; ms++) {
+        tick();
+        poll();
+    }
+
+    ssd1306_ResetBusStats();
+    const uint32_t first = subframes;
+    uint32_t on[3] = { 0, 0, 0 };
+    const int runs = 300 * SSD1306_GRAY_TICKS;
+    shortest = 0xFFFF;
+    longest = 0;
+    for (int ms = 0; ms < runs; ms++) {
+        if (!tick()) {
+            return 1;
+        }
+        poll();
+        while (sim_DmaRun()) {
+        }
+        on[0] += lit(20, 20);
+        on[1] += lit(80, 40);
+        on[2] += lit(110, 8);
+    }
+    const SSD1306_BusStats_t stats = ssd1306_GetBusStats();
+    const uint32_t count = subframes - first;
+    const double white = (double)on[0] / runs;
+    const double light = (double)on[1] / runs;
+    const double dark = (double)on[2] / runs;
+    if (white < 0.99 || light < 0.6 || light > 0.72 || dark < 0.28 || dark > 0.39 ||
+        shortest != SSD1306_GRAY_TICKS || longest != SSD1306_GRAY_TICKS) {
+        printf("lit white %.2f, light gray %.2f, dark gray %.2f, subframes %lu..%lu ticks\n", white, light, dark,
+               (unsigned long)shortest, (unsigned long)longest);
+        return 1;
+    }
+
+    ssd1306_GrayEnd();
+    ssd1306_UpdateScreen();
+    if (!sim_PanelShows(simPanel, SSD1306_Buffer, SSD1306_PAGES) || simPanel->Errors != 0 || simDma.Busy != 0) {
+        puts("panel after ssd1306_GrayEnd()");
+        return 1;
+    }
+    printf("%lu subframes of %d ticks, lit white %.2f, light %.2f, dark %.2f; %.1f bytes, %.1f transactions per subframe\n",
+           (unsigned long)count, SSD1306_GRAY_TICKS, white, light, dark,
+           (double)stats.Bytes / count, (double)stats.Transactions / count);
+    return 0;
+}
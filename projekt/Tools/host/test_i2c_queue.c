@@ -0,0 +1,341 @@
+/*
+ * The I2C queue against simulated devices on one 100 kHz bus: the SX1509
+ * keypad polled every millisecond, an INA219 that doesn't acknowledge every
+ * third read, the SSD1306 through i2cq_TransportSSD1306 streaming frames,
+ * a device stretching the clock forever and an absent one. Two simulated
+ * seconds later the panel shows the frame, every read carried the right
+ * data, the INA219 reads all recovered on a retry, the stuck and the absent
+ * reads ended with I2CQ_TIMEOUT and I2CQ_NACK, and a keypad poll waited for
+ * at most one stuck attempt. i2cq_Tick() never touches the peripheral, only
+ * i2cq_Poll() does. A display piece failing for good gives up the frame and
+ * the next update sends the whole screen. Prints the device statistics.
+ */
+// host:
+
+#include <stdint.h>
+
+static uint32_t simUs;
+static void simStep(void);
+
+// Microsecond clock and no interrupts, the waits run the bus
+#define I2CQ_NOW()          simUs
+#define I2CQ_TICKS_PER_US   1
+#define I2CQ_START_CLOCK()
+#define I2CQ_LOCK()         do { } while (0)
+#define I2CQ_UNLOCK()       do { } while (0)
+#define I2CQ_WAIT()         simStep()
+
+#include "ssd1306.c"
+#include "i2c_queue.c"
+#include "sx1509.c"
+#include "ssd1306_fonts.h"
+#include "sim.h"
+
+#define BYTE_US     90          // 9 bits at 100 kHz
+#define STUCK_ADDR  (0x50 << 1)
+#define ABSENT_ADDR (0x51 << 1)
+#define OLED_ADDR   (0x3C << 1)
+
+// The attempt on the bus
+static struct {
+    uint8_t busy;
+    uint8_t read;
+    uint8_t nack;
+    uint16_t address;
+    uint16_t reg;
+    uint16_t regSize;
+    uint8_t* data;
+    uint16_t size;
+    uint32_t end;
+} op;
+
+static uint8_t sxRegs[256];
+static uint8_t inaRegs[256][2];
+static uint32_t inaReads;
+static uint8_t oledNack;
+static uint32_t reinits;
+static uint32_t overlaps;
+static uint32_t busyUs;
+
+static HAL_StatusTypeDef start(uint16_t address, uint16_t reg, uint16_t regSize, uint8_t* data, uint16_t size, uint8_t read) {
+    if (op.busy) {
+        overlaps++;
+        return HAL_BUSY;
+    }
+    op.busy = 1;
+    op.read = read;
+    op.address = address;
+    op.reg = reg;
+    op.regSize = regSize;
+    op.data = data;
+    op.size = size;
+    // The INA219 is busy converting on every third read
+    op.nack = address == ABSENT_ADDR || (address == INAAddress && read && inaReads++ % 3 == 0) ||
+              (address == OLED_ADDR && oledNack);
+    op.end = simUs + (op.nack ? 1 : 1 + regSize + size + read) * BYTE_US;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef* hi2c, uint16_t address, uint16_t reg, uint16_t regSize, uint8_t* data, uint16_t size) {
+    return start(address, reg, regSize, data, size, 1);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef* hi2c, uint16_t address, uint16_t reg, uint16_t regSize, uint8_t* data, uint16_t size) {
+    return start(address, reg, regSize, data, size, 0);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Receive_IT(I2C_HandleTypeDef* hi2c, uint16_t address, uint8_t* data, uint16_t size) {
+    return start(address, 0, 0, data, size, 1);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT(I2C_HandleTypeDef* hi2c, uint16_t address, uint8_t* data, uint16_t size) {
+    return start(address, 0, 0, data, size, 0);
+}
+
+uint32_t HAL_I2C_GetError(const I2C_HandleTypeDef* hi2c) {
+    return hi2c->ErrorCode;
+}
+
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef* hi2c) {
+    op.busy = 0;
+    reinits++;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef* hi2c) {
+    return HAL_OK;
+}
+
+// The interrupt at the end of the attempt
+static void complete(void) {
+    op.busy = 0;
+    busyUs += op.nack ? BYTE_US : (1 + op.regSize + op.size + op.read) * BYTE_US;
+    if (op.nack) {
+        hi2c1.ErrorCode = HAL_I2C_ERROR_AF;
+        i2cq_TransferError(&hi2c1);
+        return;
+    }
+    hi2c1.ErrorCode = HAL_I2C_ERROR_NONE;
+    for (uint16_t i = 0; i < op.size; i++) {
+        if (op.address == SXAddress && op.read) {
+            op.data[i] = sxRegs[(op.reg + i) & 0xFF];
+        } else if (op.address == SXAddress) {
+            sxRegs[(op.reg + i) & 0xFF] = op.data[i];
+        } else if (op.address == INAAddress && op.read && i < 2) {
+            op.data[i] = inaRegs[op.reg][i];
+        } else if (op.address == OLED_ADDR && op.reg == 0x40) {
+            sim_PanelData(simPanel, op.data[i]);
+        } else if (op.address == OLED_ADDR) {
+            sim_PanelCommand(simPanel, op.data[i]);
+        }
+    }
+    if (op.address == OLED_ADDR) {
+        simPanel->Transactions++;
+        simPanel->Bytes += op.size;
+    }
+    i2cq_TransferDone(&hi2c1);
+}
+
+// On to the end of the attempt or the next millisecond, whichever comes first
+static void simStep(void) {
+    const uint32_t nextTick = (simUs / 1000 + 1) * 1000;
+    const int stuck = op.busy && op.address == STUCK_ADDR;
+    if (op.busy && !stuck && op.end <= nextTick) {
+        simUs = op.end;
+        complete();
+        return;
+    }
+    simUs = nextTick;
+    simTick++;
+    const uint32_t before = reinits;
+    i2cq_Tick();
+    if (reinits != before) {
+        puts("i2cq_Tick() reinitialized the peripheral");
+        exit(1);
+    }
+}
+
+static void runUntil(uint32_t us) {
+    while (simUs < us) {
+        simStep();
+    }
+}
+
+static I2CQ_Bus_t queue;
+static I2CQ_Device_t ina;
+static I2CQ_Device_t stuckDevice;
+static I2CQ_Device_t absent;
+static I2CQ_Display_t oledQueue;
+static uint8_t oledBuffer[SSD1306_BUFFER_SIZE] __ALIGNED(4);
+static uint8_t oledFront[SSD1306_BUFFER_SIZE] __ALIGNED(4);
+static SSD1306_Display_t oled = {
+    .Transport = &i2cq_TransportSSD1306,
+    .Bus = &oledQueue,
+    .Height = 64,
+    .Buffer = oledBuffer,
+    .FrontBuffer = oledFront,
+};
+
+static I2CQ_Transaction_t keyRead, inaRead, stuckRead, absentRead;
+static uint8_t keyData[2], inaData[2], stuckData[4], absentData[1];
+static uint32_t keyDone, keyBad, inaDone, inaBad;
+
+static void keyFinished(I2CQ_Transaction_t* t) {
+    keyDone++;
+    keyBad += t->Status != I2CQ_OK || keyData[0] != sxRegs[REG_KEY_DATA_1] || keyData[1] != sxRegs[REG_KEY_DATA_2];
+}
+
+static void inaFinished(I2CQ_Transaction_t* t) {
+    inaDone++;
+    inaBad += t->Status != I2CQ_OK || inaData[0] != 0x12 || inaData[1] != 0x34;
+}
+
+static void printStats(const I2CQ_Device_t* device) {
+    const I2CQ_Stats_t* s = &device->Stats;
+    printf("%-8s %5lu transactions %6lu bytes, nack %3lu retry %3lu error %3lu timeout %lu, latency max %5lu mean %4lu us\n",
+           device->Name, (unsigned long)s->Transactions, (unsigned long)s->Bytes, (unsigned long)s->Nacks,
+           (unsigned long)s->Retries, (unsigned long)s->Errors, (unsigned long)s->Timeouts, (unsigned long)s->LatencyMax,
+           (unsigned long)(s->Transactions ? s->LatencySum / s->Transactions : 0));
+}
+
+// The frame is out, the main loop polling the queue meanwhile
+static void flush(void) {
+    while (oled.TxBusy || queue.Active != NULL) {
+        simStep();
+        i2cq_Poll();
+    }
+}
+
+int main(void) {
+    i2cq_InitBus(&queue, &hi2c1);
+    sx1509Init(&queue);
+    i2cq_InitDevice(&ina, &queue, INAAddress, "INA219");
+    i2cq_InitDevice(&stuckDevice, &queue, STUCK_ADDR, "stuck");
+    i2cq_InitDevice(&absent, &queue, ABSENT_ADDR, "absent");
+    i2cq_InitDevice(&oledQueue.Device, &queue, OLED_ADDR, "SSD1306");
+    inaRegs[2][0] = 0x12;
+    inaRegs[2][1] = 0x34;
+
+    // Blocking reads and writes of sx1509.c
+    sxRegs[0x10] = 0xA5;
+    sxRegs[0x11] = 0x5A;
+    if (readByte(0x10) != 0xA5 || readWord(0x10) != 0xA55A) {
+        puts("SX1509 read");
+        return 1;
+    }
+    reset(0);
+    sxRegs[REG_MISC] = 0x04;
+    reset(1);
+    if (sxRegs[REG_RESET] != 0x34 || sxRegs[REG_MISC] != 0) {
+        puts("SX1509 reset");
+        return 1;
+    }
+
+    sim_PanelReset(simPanel);
+    ssd1306_SelectDisplay(&oled);
+    ssd1306_Init();
+    flush();
+    if (!simPanel->On || !sim_PanelShows(simPanel, oledBuffer, SSD1306_PAGES)) {
+        puts("display after init");
+        return 1;
+    }
+    i2cq_ResetStats(sx1509Device());
+    i2cq_ResetStats(&oledQueue.Device);
+
+    // Keypad every ms, sensor every 5 ms, a frame every 33 ms, the stuck and the absent device every 250 ms
+    const uint32_t t0 = simUs;
+    busyUs = 0;
+    int frames = 0;
+    int skipped = 0;
+    for (int ms = 0; ms < 2000; ms++) {
+        runUntil(t0 + ms * 1000);
+        i2cq_Poll();
+        sxRegs[REG_KEY_DATA_1] = ms;
+        sxRegs[REG_KEY_DATA_2] = ~ms;
+        if (keyRead.Status != I2CQ_PENDING) {
+            readBytesAsync(&keyRead, REG_KEY_DATA_1, keyData, 2, keyFinished);
+        }
+        if (ms % 5 == 0 && inaRead.Status != I2CQ_PENDING) {
+            i2cq_SetupRead(&inaRead, &ina, 2, inaData, 2);
+            inaRead.Callback = inaFinished;
+            i2cq_Submit(&inaRead);
+        }
+        if (ms % 250 == 0 && stuckRead.Status != I2CQ_PENDING) {
+            i2cq_SetupRead(&stuckRead, &stuckDevice, 0, stuckData, 4);
+            i2cq_Submit(&stuckRead);
+        }
+        if (ms % 250 == 125 && absentRead.Status != I2CQ_PENDING) {
+            i2cq_SetupRead(&absentRead, &absent, 0, absentData, 1);
+            i2cq_Submit(&absentRead);
+        }
+        if (ms % 33 == 0) {
+            if (oled.TxBusy) {
+                skipped++;
+            } else {
+                ssd1306_Fill(Black);
+                ssd1306_FillCircle(20 + frames % 80, 32, 10 + frames % 5, White);
+                ssd1306_SetCursor(0, 0);
+                ssd1306_WriteString("I2C", Font_7x10, White);
+                ssd1306_UpdateScreenAsync();
+                frames++;
+            }
+        }
+    }
+    const uint32_t elapsed = simUs - t0;
+    flush();
+    if (!sim_PanelShows(simPanel, oledBuffer, SSD1306_PAGES) || simPanel->Errors != 0) {
+        puts("display after the game loop");
+        return 1;
+    }
+
+    printStats(sx1509Device());
+    printStats(&ina);
+    printStats(&oledQueue.Device);
+    printStats(&stuckDevice);
+    printStats(&absent);
+    printf("%d frames, %d skipped, bus busy %.0f%%, %lu reinits\n", frames, skipped, 100.0 * busyUs / elapsed,
+           (unsigned long)reinits);
+
+    const I2CQ_Stats_t* key = &sx1509Device()->Stats;
+    if (keyBad || inaBad || overlaps || keyDone < 1000 || inaDone < 300) {
+        printf("%lu of %lu keypad and %lu of %lu sensor reads wrong, %lu overlaps\n", (unsigned long)keyBad,
+               (unsigned long)keyDone, (unsigned long)inaBad, (unsigned long)inaDone, (unsigned long)overlaps);
+        return 1;
+    }
+    if (ina.Stats.Errors != 0 || ina.Stats.Nacks == 0 || ina.Stats.Retries != ina.Stats.Nacks) {
+        puts("sensor reads not recovered by retries");
+        return 1;
+    }
+    if (stuckDevice.Stats.Timeouts != 8 || reinits != 8) {
+        puts("stuck reads not timed out");
+        return 1;
+    }
+    if (absent.Stats.Errors != 8 || absent.Stats.Nacks != 8 * (I2CQ_RETRIES + 1)) {
+        puts("absent device reads");
+        return 1;
+    }
+    // Behind the stuck device at worst
+    if (key->LatencyMax > I2CQ_TIMEOUT_MS * 1000 + 2000) {
+        puts("keypad latency");
+        return 1;
+    }
+
+    // The display stops answering in the middle of a frame
+    ssd1306_Fill(Black);
+    ssd1306_FillRectangle(0, 0, 127, 63, White);
+    ssd1306_UpdateScreenAsync();
+    oledNack = 1;
+    flush();
+    oledNack = 0;
+    if (oledQueue.Device.Stats.Errors == 0 || oled.TxBusy) {
+        puts("failed display write not given up");
+        return 1;
+    }
+    ssd1306_UpdateScreenAsync();
+    flush();
+    if (!sim_PanelShows(simPanel, oledBuffer, SSD1306_PAGES)) {
+        puts("display after a failed frame");
+        return 1;
+    }
+    return 0;
+}
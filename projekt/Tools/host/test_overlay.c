@@ -0,0 +1,217 @@
+/*
+ * Overlays nested up to four deep over random screens: drawing stays inside
+ * each popup, ssd1306_OverlayEnd() in reverse order brings back the screen
+ * and the clip rectangle under it, and with dirty updates closing one
+ * sends no more than its area. A Begin with too small a save area fails
+ * and an End on a zeroed overlay changes nothing. In gray mode a popup
+ * over both planes puts both back, and layers are saved from and composed
+ * into the draw plane. Prints the cost of a 64x24 popup.
+ */
+// host:
+// host: plain
+// host: -DSSD1306_USE_GRAYSCALE
+
+#include "ssd1306.c"
+#include "sim.h"
+
+#define DEPTH 4
+
+static SSD1306_Overlay_t overlays[DEPTH];
+static uint8_t saves[DEPTH][SSD1306_BUFFER_SIZE];
+static uint8_t under[DEPTH][SSD1306_BUFFER_SIZE];
+static uint8_t before[SSD1306_BUFFER_SIZE];
+static uint8_t screen[SSD1306_BUFFER_SIZE];
+
+static int shows(void) {
+    ssd1306_UpdateScreen();
+    return sim_PanelShows(simPanel, SSD1306_Buffer, SSD1306_PAGES);
+}
+
+// A pixel changed outside x1..x2, y1..y2
+static int leaked(int x1, int y1, int x2, int y2) {
+    for (int i = 0; i < SSD1306_BUFFER_SIZE; i++) {
+        const int x = i % SSD1306_WIDTH;
+        for (int b = 0; b < 8; b++) {
+            const int y = (i / SSD1306_WIDTH) * 8 + b;
+            if ((x < x1 || x > x2 || y < y1 || y > y2) && (((before[i] ^ SSD1306_Buffer[i]) >> b) & 1)) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+#ifdef SSD1306_USE_GRAYSCALE
+static void subframes(void) {
+    for (int i = 0; i < 3 * SSD1306_GRAY_TICKS; i++) {
+        while (sim_DmaRun()) {
+        }
+        ssd1306_GrayTick();
+        ssd1306_GrayPoll();
+    }
+}
+
+// A popup over both planes
+static int grayPopup(void) {
+    static uint8_t high[SSD1306_BUFFER_SIZE];
+    static uint8_t low[SSD1306_BUFFER_SIZE];
+
+    ssd1306_GrayBegin();
+    ssd1306_FillCircle(60, 30, 20, White);
+    ssd1306_SetDrawPlane(SSD1306_PLANE_LOW);
+    ssd1306_FillCircle(40, 30, 20, White);
+    ssd1306_SetDrawPlane(SSD1306_PLANE_HIGH);
+    ssd1306_UpdateScreen();
+    subframes();
+    memcpy(high, SSD1306_Buffer, SSD1306_BUFFER_SIZE);
+    memcpy(low, SSD1306_GrayBuffer, SSD1306_BUFFER_SIZE);
+
+    ssd1306_OverlayBegin(&overlays[0], saves[0], sizeof(saves[0]), 30, 10, 90, 50);
+    ssd1306_FillRectangle(0, 0, 127, 63, White);
+    ssd1306_SetDrawPlane(SSD1306_PLANE_LOW);
+    ssd1306_OverlayBegin(&overlays[1], saves[1], sizeof(saves[1]), 30, 10, 90, 50);
+    ssd1306_FillRectangle(0, 0, 127, 63, White);
+    ssd1306_SetDrawPlane(SSD1306_PLANE_HIGH);
+    ssd1306_UpdateScreen();
+    subframes();
+
+    ssd1306_OverlayEnd(&overlays[1]);
+    ssd1306_OverlayEnd(&overlays[0]);
+    ssd1306_UpdateScreen();
+    subframes();
+    if (memcmp(high, SSD1306_Buffer, SSD1306_BUFFER_SIZE) != 0 || memcmp(low, SSD1306_GrayBuffer, SSD1306_BUFFER_SIZE) != 0) {
+        puts("gray planes not restored");
+        return 0;
+    }
+
+    // The low plane as a layer, cleared by its own mask and put back
+    static uint32_t layer[SSD1306_LAYER_WORDS];
+    ssd1306_SetDrawPlane(SSD1306_PLANE_LOW);
+    ssd1306_SaveLayer(layer);
+    ssd1306_ComposeLayers(layer, NULL, layer);
+    static const uint8_t blank[SSD1306_BUFFER_SIZE];
+    const int cleared = memcmp(blank, SSD1306_GrayBuffer, SSD1306_BUFFER_SIZE) == 0;
+    ssd1306_ComposeLayers(layer, NULL, NULL);
+    ssd1306_SetDrawPlane(SSD1306_PLANE_HIGH);
+    if (memcmp(low, layer, SSD1306_BUFFER_SIZE) != 0 || !cleared ||
+        memcmp(high, SSD1306_Buffer, SSD1306_BUFFER_SIZE) != 0 || memcmp(low, SSD1306_GrayBuffer, SSD1306_BUFFER_SIZE) != 0) {
+        puts("layers of the low plane");
+        return 0;
+    }
+    ssd1306_GrayEnd();
+    if (!shows()) {
+        puts("panel after ssd1306_GrayEnd()");
+        return 0;
+    }
+    return 1;
+}
+#endif
+
+int main(void) {
+    srand(18);
+    sim_PanelReset(simPanel);
+    ssd1306_Init();
+    simDma.Queue = 1;
+
+    for (int f = 0; f < 2000; f++) {
+        for (int i = 0; i < 5; i++) {
+            ssd1306_FillCircle(rand() % 128, rand() % 64, rand() % 20, rand() % 2);
+        }
+        ssd1306_UpdateScreen();
+        memcpy(screen, SSD1306_Buffer, SSD1306_BUFFER_SIZE);
+        const uint8_t clipX1 = SSD1306.ClipX1, clipY1 = SSD1306.ClipY1;
+        const uint8_t clipX2 = SSD1306.ClipX2, clipY2 = SSD1306.ClipY2;
+
+        const int depth = 1 + rand() % DEPTH;
+        for (int d = 0; d < depth; d++) {
+            memcpy(under[d], SSD1306_Buffer, SSD1306_BUFFER_SIZE);
+            const int x1 = rand() % 128, y1 = rand() % 64;
+            const int x2 = x1 + rand() % 60, y2 = y1 + rand() % 40;
+            const uint16_t size = SSD1306_OVERLAY_SIZE(x1, y1, (x2 > 127) ? 127 : x2, (y2 > 63) ? 63 : y2);
+            if (ssd1306_OverlayBegin(&overlays[d], saves[d], size - 1, x1, y1, x2, y2) != SSD1306_ERR) {
+                printf("frame %d: save area one byte short accepted\n", f);
+                return 1;
+            }
+            if (ssd1306_OverlayBegin(&overlays[d], saves[d], size, x1, y1, x2, y2) != SSD1306_OK) {
+                printf("frame %d: begin failed\n", f);
+                return 1;
+            }
+            memcpy(before, SSD1306_Buffer, SSD1306_BUFFER_SIZE);
+            ssd1306_FillRectangle(0, 0, 127, 63, rand() % 2);
+            ssd1306_Line(0, 0, 127, 63, rand() % 2);
+            if (leaked(x1, y1, x2, y2)) {
+                printf("frame %d: drawing left popup %d\n", f, d);
+                return 1;
+            }
+            if (rand() % 2) {
+                ssd1306_UpdateScreen();
+            }
+        }
+
+        for (int d = depth - 1; d >= 0; d--) {
+            ssd1306_UpdateScreen();
+            const uint32_t bytes = simPanel->Bytes;
+            ssd1306_OverlayEnd(&overlays[d]);
+            if (memcmp(SSD1306_Buffer, under[d], SSD1306_BUFFER_SIZE) != 0) {
+                printf("frame %d: popup %d not restored\n", f, d);
+                return 1;
+            }
+            if (!shows()) {
+                printf("frame %d: panel after closing popup %d\n", f, d);
+                return 1;
+            }
+#ifdef SSD1306_USE_DIRTY_UPDATE
+            const uint32_t area = (overlays[d].x2 - overlays[d].x1 + 1) * (overlays[d].page2 - overlays[d].page1 + 1);
+            if (simPanel->Bytes - bytes > area + 6 * SSD1306_PAGES) {
+                printf("frame %d: closing popup %d sent %lu bytes for %lu\n", f, d,
+                       (unsigned long)(simPanel->Bytes - bytes), (unsigned long)area);
+                return 1;
+            }
+#else
+            (void)bytes;
+#endif
+        }
+        if (SSD1306.ClipX1 != clipX1 || SSD1306.ClipY1 != clipY1 || SSD1306.ClipX2 != clipX2 || SSD1306.ClipY2 != clipY2) {
+            printf("frame %d: clip rectangle not restored\n", f);
+            return 1;
+        }
+        if (memcmp(SSD1306_Buffer, screen, SSD1306_BUFFER_SIZE) != 0) {
+            printf("frame %d: screen not restored\n", f);
+            return 1;
+        }
+    }
+
+    // What pauseGame() does when a Begin fails
+    SSD1306_Overlay_t closed = { 0 };
+    memcpy(before, SSD1306_Buffer, SSD1306_BUFFER_SIZE);
+    if (ssd1306_OverlayBegin(&closed, saves[0], 0, 32, 20, 95, 43) != SSD1306_ERR) {
+        puts("begin without a save area");
+        return 1;
+    }
+    ssd1306_OverlayEnd(&closed);
+    if (memcmp(before, SSD1306_Buffer, SSD1306_BUFFER_SIZE) != 0) {
+        puts("end of a failed begin changed the screen");
+        return 1;
+    }
+
+#ifdef SSD1306_USE_GRAYSCALE
+    if (!grayPopup()) {
+        return 1;
+    }
+#endif
+
+    // A 64x24 popup over an unchanged game
+    SSD1306_Overlay_t popup;
+    static uint8_t save[SSD1306_OVERLAY_SIZE(32, 20, 95, 43)];
+    ssd1306_UpdateScreen();
+    ssd1306_OverlayBegin(&popup, save, sizeof(save), 32, 20, 95, 43);
+    ssd1306_FillRectangle(0, 0, 127, 63, White);
+    uint32_t bytes = simPanel->Bytes;
+    ssd1306_UpdateScreen();
+    const uint32_t open = simPanel->Bytes - bytes;
+    bytes = simPanel->Bytes;
+    ssd1306_OverlayEnd(&popup);
+    ssd1306_UpdateScreen();
+    printf("64x24 popup: %lu bytes to show, %lu to close\n", (unsigned long)open, (unsigned long)(simPanel->Bytes - bytes));
+    return 0;
+}
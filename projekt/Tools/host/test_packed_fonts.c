@@ -0,0 +1,105 @@
+/*
+ * The packed fonts against the rows and pages they were generated from:
+ * ssd1306_fonts.c and ssd1306_fonts_pages.c are built in here without
+ * SSD1306_USE_PACKED_FONTS, under other names, and random characters of all
+ * six fonts, both colors, opaque and transparent, clipped, scaled or not,
+ * must return the same, move the cursor the same and write the same
+ * screenbuffer bytes from both. Also times ssd1306_WriteChar() with the
+ * packed 6x8 and 7x10; the times are host nanoseconds, not target cycles.
+ */
+// host: -DSSD1306_INCLUDE_FONT_11x18 -DSSD1306_INCLUDE_FONT_16x26 -DSSD1306_INCLUDE_FONT_16x24 -DSSD1306_INCLUDE_FONT_16x15
+
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+
+#include "ssd1306.c"
+#include "ssd1306_fonts.h"
+#include "sim.h"
+
+#undef SSD1306_USE_PACKED_FONTS
+#define Font_6x8 Ref_6x8
+#define Font_7x10 Ref_7x10
+#define Font_11x18 Ref_11x18
+#define Font_16x26 Ref_16x26
+#define Font_16x24 Ref_16x24
+#define Font_16x15 Ref_16x15
+#include "ssd1306_fonts.c"
+#include "ssd1306_fonts_pages.c"
+#undef Font_6x8
+#undef Font_7x10
+#undef Font_11x18
+#undef Font_16x26
+#undef Font_16x24
+#undef Font_16x15
+
+static uint8_t before[SSD1306_BUFFER_SIZE];
+static uint8_t packed[SSD1306_BUFFER_SIZE];
+
+static double nowNs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// ns per character, all of 32..126 over and over
+static double timeFont(const SSD1306_Font_t* font) {
+    const int runs = 20000;
+    const double start = nowNs();
+    for (int i = 0; i < runs; i++) {
+        for (int ch = 32; ch <= 126; ch++) {
+            ssd1306_SetCursor(((ch - 32) % 16) * font->width % 100, ((ch - 32) / 16 * font->height) % 40);
+            ssd1306_WriteChar(ch, *font, White);
+        }
+    }
+    return (nowNs() - start) / (runs * 95.0);
+}
+
+int main(void) {
+    srand(20);
+    sim_PanelReset(simPanel);
+    ssd1306_Init();
+
+    const SSD1306_Font_t* fonts[] = { &Font_6x8, &Font_7x10, &Font_11x18, &Font_16x26, &Font_16x24, &Font_16x15 };
+    const SSD1306_Font_t* refs[] = { &Ref_6x8, &Ref_7x10, &Ref_11x18, &Ref_16x26, &Ref_16x24, &Ref_16x15 };
+    for (int i = 0; i < 60000; i++) {
+        const int f = rand() % 6;
+        const char ch = 32 + rand() % 95;
+        const int color = rand() % 2;
+        const int transparent = rand() % 2;
+        const int scale = (rand() % 4 == 0) ? 1 + rand() % 3 : 0;
+        for (int b = 0; b < SSD1306_BUFFER_SIZE; b++) {
+            SSD1306_Buffer[b] = rand();
+        }
+        if (rand() % 2) {
+            ssd1306_SetClipRect(rand() % 128, rand() % 64, rand() % 128, rand() % 64);
+        } else {
+            ssd1306_ResetClipRect();
+        }
+        const int x = rand() % 128;
+        const int y = rand() % 64;
+        ssd1306_SetTransparentText(transparent);
+        memcpy(before, SSD1306_Buffer, SSD1306_BUFFER_SIZE);
+
+        ssd1306_SetCursor(x, y);
+        const char fromPacked = scale ? ssd1306_WriteCharScaled(ch, *fonts[f], scale, color)
+                                      : ssd1306_WriteChar(ch, *fonts[f], color);
+        const uint8_t cursor = SSD1306.CurrentX;
+        memcpy(packed, SSD1306_Buffer, SSD1306_BUFFER_SIZE);
+
+        memcpy(SSD1306_Buffer, before, SSD1306_BUFFER_SIZE);
+        ssd1306_SetCursor(x, y);
+        const char fromRows = scale ? ssd1306_WriteCharScaled(ch, *refs[f], scale, color)
+                                    : ssd1306_WriteChar(ch, *refs[f], color);
+        if (fromPacked != fromRows || cursor != SSD1306.CurrentX || memcmp(packed, SSD1306_Buffer, SSD1306_BUFFER_SIZE) != 0) {
+            printf("'%c' of font %d at %d,%d, scale %d, color %d, transparent %d differs\n", ch, f, x, y, scale,
+                   color, transparent);
+            return 1;
+        }
+    }
+
+    ssd1306_ResetClipRect();
+    ssd1306_SetTransparentText(0);
+    printf("60000 characters byte-identical; ssd1306_WriteChar(), host ns: 6x8 %.1f, 7x10 %.1f\n",
+           timeFont(&Font_6x8), timeFont(&Font_7x10));
+    return 0;
+}
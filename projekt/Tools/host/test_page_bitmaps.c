@@ -0,0 +1,143 @@
+/*
+ * ssd1306_BlitBitmapPages() and ssd1306_DrawBitmapPages() draw what
+ * ssd1306_DrawBitmap() draws from the row-major image, for menu_pages and
+ * random images at random positions, and the dirty update sends it all.
+ * Also times a full screen fireworks frame both ways. The times are host
+ * nanoseconds, they show the ratio and say nothing about target cycles.
+ */
+// host:
+// host: plain
+
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+
+#include "ssd1306.c"
+#include "bitmaps.h"
+#include "sim.h"
+
+static uint8_t expected[SSD1306_BUFFER_SIZE];
+static uint8_t background[SSD1306_BUFFER_SIZE];
+static uint8_t pages[SSD1306_BUFFER_SIZE];
+static uint8_t rows[SSD1306_BUFFER_SIZE];
+
+// What Tools/gen_page_bitmaps.py does
+static void rowsToPages(const uint8_t* image, int w, int h, uint8_t* out) {
+    const int bytesPerRow = (w + 7) / 8;
+    memset(out, 0, w * ((h + 7) / 8));
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            if (image[y * bytesPerRow + x / 8] & (0x80 >> (x % 8))) {
+                out[(y / 8) * w + x] |= 1 << (y % 8);
+            }
+        }
+    }
+}
+
+static double nowNs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+int main(void) {
+    srand(6);
+
+    // The menu in page layout
+    memset(SSD1306_Buffer, 0, SSD1306_BUFFER_SIZE);
+    ssd1306_DrawBitmap(0, 0, menu, 128, 64, White);
+    memcpy(expected, SSD1306_Buffer, SSD1306_BUFFER_SIZE);
+    memset(SSD1306_Buffer, 0x5A, SSD1306_BUFFER_SIZE);
+    ssd1306_BlitBitmapPages(0, 0, menu_pages, 128, 64);
+    if (memcmp(expected, SSD1306_Buffer, SSD1306_BUFFER_SIZE) != 0) {
+        puts("menu_pages blit differs");
+        return 1;
+    }
+    memset(SSD1306_Buffer, 0, SSD1306_BUFFER_SIZE);
+    ssd1306_DrawBitmapPages(0, 0, menu_pages, 128, 64, White);
+    if (memcmp(expected, SSD1306_Buffer, SSD1306_BUFFER_SIZE) != 0) {
+        puts("menu_pages draw differs");
+        return 1;
+    }
+
+    // Random images: blit against clear + DrawBitmap, draw against DrawBitmap
+    for (int i = 0; i < 100000; i++) {
+        const int w = 1 + rand() % 128;
+        const int h = 1 + rand() % 64;
+        const int x = rand() % 128;
+        const int y = (rand() % 2) ? (rand() % 64) & ~7 : rand() % 64;
+        const SSD1306_COLOR color = rand() % 2;
+        const int blit = rand() % 2;
+        const int bytesPerRow = (w + 7) / 8;
+        for (int b = 0; b < bytesPerRow * h; b++) {
+            rows[b] = rand();
+        }
+        if (w % 8) {
+            // Padding bits of a row are not part of the image
+            for (int r = 0; r < h; r++) {
+                rows[r * bytesPerRow + bytesPerRow - 1] &= 0xFF << (8 - w % 8);
+            }
+        }
+        rowsToPages(rows, w, h, pages);
+        for (int b = 0; b < SSD1306_BUFFER_SIZE; b++) {
+            background[b] = rand();
+        }
+
+        memcpy(SSD1306_Buffer, background, SSD1306_BUFFER_SIZE);
+        if (blit) {
+            for (int r = 0; r < h; r++) {
+                for (int c = 0; c < w; c++) {
+                    ssd1306_DrawPixel(x + c, y + r, Black);
+                }
+            }
+            ssd1306_DrawBitmap(x, y, rows, w, h, White);
+        } else {
+            ssd1306_DrawBitmap(x, y, rows, w, h, color);
+        }
+        memcpy(expected, SSD1306_Buffer, SSD1306_BUFFER_SIZE);
+
+        memcpy(SSD1306_Buffer, background, SSD1306_BUFFER_SIZE);
+        if (blit) {
+            ssd1306_BlitBitmapPages(x, y, pages, w, h);
+        } else {
+            ssd1306_DrawBitmapPages(x, y, pages, w, h, color);
+        }
+        if (memcmp(expected, SSD1306_Buffer, SSD1306_BUFFER_SIZE) != 0) {
+            printf("%s differs: %dx%d at %d,%d\n", blit ? "blit" : "draw", w, h, x, y);
+            return 1;
+        }
+    }
+
+    // The dirty update sends blitted frames
+    sim_PanelReset(simPanel);
+    ssd1306_Init();
+    for (int f = 0; f < 200; f++) {
+        if (f % 3 == 0) {
+            ssd1306_Fill(Black);
+            ssd1306_FillCircle(rand() % 128, rand() % 64, 3 + rand() % 10, White);
+        } else {
+            ssd1306_BlitBitmapPages(0, 0, menu_pages, 128, 64);
+        }
+        ssd1306_UpdateScreen();
+        if (!sim_PanelShows(simPanel, SSD1306_Buffer, SSD1306_PAGES)) {
+            printf("frame %d\n", f);
+            return 1;
+        }
+    }
+
+    // A fireworks frame the old way (Fill + DrawBitmap) and as one blit
+    const int runs = 2000;
+    rowsToPages(fajerwerki6, 128, 64, pages);
+    double start = nowNs();
+    for (int i = 0; i < runs; i++) {
+        ssd1306_Fill(Black);
+        ssd1306_DrawBitmap(0, 0, fajerwerki6, 128, 64, White);
+    }
+    const double old = (nowNs() - start) / runs;
+    start = nowNs();
+    for (int i = 0; i < runs; i++) {
+        ssd1306_BlitBitmapPages(0, 0, pages, 128, 64);
+    }
+    const double blit = (nowNs() - start) / runs;
+    printf("fireworks frame, host ns: Fill + DrawBitmap %.0f, BlitBitmapPages %.0f\n", old, blit);
+    return 0;
+}
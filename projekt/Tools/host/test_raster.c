@@ -0,0 +1,108 @@
+/*
+ * The span rasterizer writes the same screenbuffer bytes as the pixel by
+ * pixel ssd1306_FillCircle() and ssd1306_FillRectangle() it replaced, and
+ * horizontal and vertical ssd1306_Line() the same as such a rectangle.
+ */
+// host:
+// host: plain
+
+#include "ssd1306.c"
+#include "sim.h"
+
+// ssd1306_FillCircle() before the rasterizer, the uint8_t loops as int32_t
+static void refFillCircle(uint8_t par_x, uint8_t par_y, uint8_t par_r, SSD1306_COLOR par_color) {
+    int32_t x = -par_r;
+    int32_t y = 0;
+    int32_t err = 2 - 2 * par_r;
+    int32_t e2;
+
+    if (par_x >= SSD1306_WIDTH || par_y >= SSD1306_HEIGHT) {
+        return;
+    }
+    do {
+        for (int32_t _y = par_y + y; _y >= par_y - y; _y--) {
+            for (int32_t _x = par_x - x; _x >= par_x + x; _x--) {
+                ssd1306_DrawPixel((uint8_t)_x, (uint8_t)_y, par_color);
+            }
+        }
+        e2 = err;
+        if (e2 <= y) {
+            y++;
+            err = err + (y * 2 + 1);
+            if (-x == y && e2 <= x) {
+                e2 = 0;
+            }
+        }
+        if (e2 > x) {
+            x++;
+            err = err + (x * 2 + 1);
+        }
+    } while (x <= 0);
+}
+
+// ssd1306_FillRectangle() before the rasterizer
+static void refFillRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1306_COLOR color) {
+    uint8_t x_start = ((x1<=x2) ? x1 : x2);
+    uint8_t x_end   = ((x1<=x2) ? x2 : x1);
+    uint8_t y_start = ((y1<=y2) ? y1 : y2);
+    uint8_t y_end   = ((y1<=y2) ? y2 : y1);
+
+    for (uint8_t y= y_start; (y<= y_end)&&(y<SSD1306_HEIGHT); y++) {
+        for (uint8_t x= x_start; (x<= x_end)&&(x<SSD1306_WIDTH); x++) {
+            ssd1306_DrawPixel(x, y, color);
+        }
+    }
+}
+
+static uint8_t expected[SSD1306_BUFFER_SIZE];
+
+int main(void) {
+    srand(3);
+    uint32_t compared = 0;
+    for (int i = 0; i < 20000; i++) {
+        const int kind = rand() % 3;
+        const SSD1306_COLOR color = rand() % 2;
+        const uint8_t background = rand();
+        const int r = rand() % 30;
+        int x = r + rand() % (128 - r + 20);
+        int y = r + rand() % (64 - r + 10);
+        // Centers past 255 - r wrap into the screen in the old uint8_t loops
+        if (x > 255 - r) x = 255 - r;
+        if (y > 255 - r) y = 255 - r;
+        const int x1 = rand() % 140, y1 = rand() % 70;
+        int x2 = rand() % 140, y2 = rand() % 70;
+        if (rand() % 2) {
+            x2 = x1;
+        } else if (rand() % 2) {
+            y2 = y1;
+        }
+        if (kind == 2 && x1 != x2 && y1 != y2) {
+            continue;
+        }
+
+        memset(SSD1306_Buffer, background, SSD1306_BUFFER_SIZE);
+        if (kind == 0) {
+            refFillCircle(x, y, r, color);
+        } else {
+            refFillRectangle(x1, y1, x2, y2, color);
+        }
+        memcpy(expected, SSD1306_Buffer, SSD1306_BUFFER_SIZE);
+
+        memset(SSD1306_Buffer, background, SSD1306_BUFFER_SIZE);
+        if (kind == 0) {
+            ssd1306_FillCircle(x, y, r, color);
+        } else if (kind == 1) {
+            ssd1306_FillRectangle(x1, y1, x2, y2, color);
+        } else {
+            ssd1306_Line(x1, y1, x2, y2, color);
+        }
+        if (memcmp(expected, SSD1306_Buffer, SSD1306_BUFFER_SIZE) != 0) {
+            printf("%s differs: center %d,%d r %d, corners %d,%d %d,%d, color %d\n",
+                   kind == 0 ? "circle" : kind == 1 ? "rectangle" : "line", x, y, r, x1, y1, x2, y2, color);
+            return 1;
+        }
+        compared++;
+    }
+    printf("%lu shapes byte-identical\n", (unsigned long)compared);
+    return 0;
+}
@@ -0,0 +1,137 @@
+/*
+ * ssd1306_WriteCharScaled() against the font rows blown up pixel by pixel:
+ * every character of Font_6x8 and Font_7x10 at scales 1 to 8, from page
+ * layout and from rows, both colors, opaque and transparent, clipped, and
+ * refused where it doesn't fit on the display or is over 64px high. At
+ * scale 1 it draws what ssd1306_WriteChar() draws. The reference reads the
+ * rows, so the fonts are built unpacked.
+ */
+// host: no-USE_PACKED_FONTS
+// host: plain no-USE_PACKED_FONTS
+// host: plain no-USE_PACKED_FONTS -DSSD1306_HEIGHT=128
+
+#include "ssd1306.c"
+#include "ssd1306_fonts.h"
+#include "sim.h"
+
+static uint8_t expected[SSD1306_BUFFER_SIZE];
+
+static void setPixel(uint8_t* buffer, int x, int y, int color) {
+    if (x < SSD1306.ClipX1 || x > SSD1306.ClipX2 || y < SSD1306.ClipY1 || y > SSD1306.ClipY2) {
+        return;
+    }
+    if (color) {
+        buffer[(y / 8) * SSD1306_WIDTH + x] |= 1 << (y % 8);
+    } else {
+        buffer[(y / 8) * SSD1306_WIDTH + x] &= ~(1 << (y % 8));
+    }
+}
+
+// Every font pixel as a scale x scale block
+static void refCharScaled(uint8_t* buffer, char ch, const SSD1306_Font_t* font, int scale, int x, int y, int color, int transparent) {
+    for (int row = 0; row < font->height; row++) {
+        const uint16_t bits = font->data[(ch - 32) * font->height + row];
+        for (int col = 0; col < font->width; col++) {
+            const int on = (bits << col) & 0x8000;
+            if (!on && transparent) {
+                continue;
+            }
+            for (int a = 0; a < scale; a++) {
+                for (int b = 0; b < scale; b++) {
+                    setPixel(buffer, x + col * scale + b, y + row * scale + a, on ? color : !color);
+                }
+            }
+        }
+    }
+}
+
+int main(void) {
+    srand(19);
+    sim_PanelReset(simPanel);
+    ssd1306_Init();
+
+    const SSD1306_Font_t* fonts[] = { &Font_6x8, &Font_7x10 };
+    for (int i = 0; i < 20000; i++) {
+        const SSD1306_Font_t* base = fonts[rand() % 2];
+        // The same font without page layout glyphs draws from the rows
+        const SSD1306_Font_t rows = { base->width, base->height, base->data, base->char_width, NULL, NULL, NULL };
+        const SSD1306_Font_t* font = (rand() % 2) ? &rows : base;
+        const int scale = 1 + rand() % 8;
+        const char ch = 32 + rand() % 95;
+        const int color = rand() % 2;
+        const int transparent = rand() % 2;
+        for (int b = 0; b < SSD1306_BUFFER_SIZE; b++) {
+            SSD1306_Buffer[b] = rand();
+        }
+        if (rand() % 3 == 0) {
+            ssd1306_SetClipRect(rand() % 128, rand() % SSD1306_HEIGHT, rand() % 128, rand() % SSD1306_HEIGHT);
+        } else {
+            ssd1306_ResetClipRect();
+        }
+        memcpy(expected, SSD1306_Buffer, SSD1306_BUFFER_SIZE);
+
+        const int x = rand() % 128;
+        const int y = rand() % SSD1306_HEIGHT;
+        const int fits = x + font->width * scale <= SSD1306_WIDTH && y + font->height * scale <= SSD1306_HEIGHT &&
+                         font->height * scale <= 64;
+        ssd1306_SetCursor(x, y);
+        ssd1306_SetTransparentText(transparent);
+        const char written = ssd1306_WriteCharScaled(ch, *font, scale, color);
+        if ((written == ch) != fits) {
+            printf("'%c' x%d at %d,%d: returned %d\n", ch, scale, x, y, written);
+            return 1;
+        }
+        if (fits) {
+            refCharScaled(expected, ch, font, scale, x, y, color, transparent);
+        }
+        if (memcmp(expected, SSD1306_Buffer, SSD1306_BUFFER_SIZE) != 0) {
+            printf("'%c' x%d at %d,%d, %s, color %d, transparent %d differs\n", ch, scale, x, y,
+                   font == &rows ? "rows" : "pages", color, transparent);
+            return 1;
+        }
+        if (fits && scale == 1) {
+            ssd1306_SetCursor(x, y);
+            ssd1306_WriteChar(ch, *font, color);
+            if (memcmp(expected, SSD1306_Buffer, SSD1306_BUFFER_SIZE) != 0) {
+                printf("'%c' at %d,%d: scale 1 differs from ssd1306_WriteChar()\n", ch, x, y);
+                return 1;
+            }
+        }
+    }
+
+    ssd1306_ResetClipRect();
+    ssd1306_SetTransparentText(0);
+    ssd1306_SetCursor(0, 0);
+    if (ssd1306_WriteStringScaled("18.092.5", Font_7x10, 2, White) != 0) {
+        puts("a 7x10 string at scale 2 doesn't fit");
+        return 1;
+    }
+
+    // A 32px display takes 30px high text at the top, but not lower or higher
+    static uint8_t smallBuffer[SSD1306_BUFFER_SIZE] __ALIGNED(4);
+    SSD1306_Display_t small = {
+        .Transport = &ssd1306_TransportSPI,
+        .Bus = &hspi1,
+        .CS_Port = SSD1306_CS_Port,
+        .CS_Pin = SSD1306_CS_Pin,
+        .DC_Port = SSD1306_DC_Port,
+        .DC_Pin = SSD1306_DC_Pin,
+        .Height = 32,
+        .Buffer = smallBuffer,
+        .FrontBuffer = smallBuffer,
+    };
+    ssd1306_SelectDisplay(&small);
+    ssd1306_Init();
+    ssd1306_SetCursor(0, 0);
+    const char top = ssd1306_WriteCharScaled('8', Font_7x10, 3, White);
+    ssd1306_SetCursor(0, 3);
+    const char lower = ssd1306_WriteCharScaled('8', Font_7x10, 3, White);
+    ssd1306_SetCursor(0, 0);
+    const char higher = ssd1306_WriteCharScaled('8', Font_7x10, 4, White);
+    if (top != '8' || lower != 0 || higher != 0) {
+        puts("30px high text on a 32px display");
+        return 1;
+    }
+    puts("20000 scaled characters pixel-identical");
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * ssd1306_ScrollPages() against the panel model, which applies the display
+ * start line when it shows the RAM: random frames of drawing, fills and page
+ * scrolls through the plain, dirty and async updates show the screenbuffer
+ * after every update, and a scroll of n pages sends at most n * 128 data
+ * bytes plus 13 command bytes. A horizontal scroll holds the updates back.
+ */
+// host:
+// host: plain
+
+#include "ssd1306.c"
+#include "sim.h"
+
+static int shows(int frame) {
+    if (!sim_PanelShows(simPanel, SSD1306_Buffer, SSD1306_PAGES)) {
+        printf("frame %d, start line %d\n", frame, simPanel->StartLine);
+        return 0;
+    }
+    return 1;
+}
+
+static void update(void) {
+#ifdef SSD1306_USE_DMA
+    if (rand() % 2) {
+        ssd1306_UpdateScreenAsync();
+        ssd1306_WaitForTransfer();
+        return;
+    }
+#endif
+    ssd1306_UpdateScreen();
+}
+
+int main(void) {
+    srand(8);
+    sim_PanelReset(simPanel);
+    ssd1306_Init();
+    if (!shows(-1)) {
+        return 1;
+    }
+
+    for (int f = 0; f < 3000; f++) {
+        const int kind = rand() % 4;
+        if (kind == 0) {
+            ssd1306_Fill(rand() % 4 ? Black : White);
+        }
+        if (kind <= 1) {
+            for (int i = 0; i < 5; i++) {
+                ssd1306_FillCircle(rand() % 128, rand() % 64, 3 + rand() % 10, rand() % 2);
+            }
+        }
+        if (kind == 2) {
+            const int n = rand() % 15 - 7;
+            if (n == 0) {
+                continue;
+            }
+            if (ssd1306_ScrollPages(n) != SSD1306_OK) {
+                printf("ssd1306_ScrollPages(%d) failed\n", n);
+                return 1;
+            }
+#ifdef SSD1306_USE_DIRTY_UPDATE
+            if (rand() % 2) {
+                const uint32_t bytes = simPanel->Bytes;
+                ssd1306_UpdateScreen();
+                const uint32_t sent = simPanel->Bytes - bytes;
+                if (sent > (uint32_t)abs(n) * 128 + 13) {
+                    printf("scroll by %d sent %lu bytes\n", n, (unsigned long)sent);
+                    return 1;
+                }
+                if (!shows(f)) {
+                    return 1;
+                }
+                continue;
+            }
+#endif
+        }
+        if (kind == 3) {
+            ssd1306_DrawPixel(rand() % 128, rand() % 64, White);
+        }
+        update();
+        if (!shows(f)) {
+            return 1;
+        }
+    }
+
+    // Horizontal scroll: no RAM writes until it stops, then everything is sent
+    if (SSD1306_PageOffset == 0) {
+        ssd1306_ScrollPages(3);
+    }
+    ssd1306_UpdateScreen();
+    if (ssd1306_StartScroll(SSD1306_SCROLL_LEFT, 0, 7, 0) == SSD1306_OK) {
+        puts("scroll area wrapping around the moved RAM pages accepted");
+        return 1;
+    }
+    if (ssd1306_StartScroll(SSD1306_SCROLL_LEFT, 0, 7 - SSD1306_PageOffset, 0) != SSD1306_OK || !simPanel->Scrolling) {
+        puts("scroll not started");
+        return 1;
+    }
+    const uint32_t bytes = simPanel->Bytes;
+    ssd1306_FillCircle(60, 30, 10, White);
+    update();
+    if (simPanel->Bytes != bytes) {
+        puts("wrote while scrolling");
+        return 1;
+    }
+    // The scroll moved the RAM
+    for (int p = 0; p < SIM_PAGES; p++) {
+        for (int c = 0; c < SIM_COLUMNS; c++) {
+            simPanel->Ram[p][c] = rand();
+        }
+    }
+    ssd1306_StopScroll();
+    ssd1306_UpdateScreen();
+    if (!shows(-2) || simPanel->Errors != 0) {
+        return 1;
+    }
+    printf("3000 frames, start line %d at the end\n", simPanel->StartLine);
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+ * ssd1306_UpdateSprites() leaves the screenbuffer as ssd1306_Fill() plus
+ * drawing every visible sprite in order would, for sprites that move,
+ * change image, hide and overlap, also with more sprites than bits in a
+ * word, and the update after it shows it. Prints the bytes a game frame
+ * (ten dots and two circles) sends.
+ */
+// host:
+// host: plain
+
+#include "ssd1306.c"
+#include "ssd1306_circles.h"
+#include "sim.h"
+
+#define SPRITES 80
+
+static SSD1306_Sprite_t sprites[SPRITES];
+static const uint8_t dot[] = { 0x01 };
+static uint8_t expected[SSD1306_BUFFER_SIZE];
+
+static int R(int n) {
+    return rand() % n;
+}
+
+// A random circle from the tables as the image of s
+static void circle(SSD1306_Sprite_t* s, int filled) {
+    const int r = 3 + R(22);
+    const uint8_t* table = filled ? SSD1306_FilledCircles : SSD1306_OutlineCircles;
+    ssd1306_SpriteSetImage(s, &table[SSD1306_CircleOffsets[r - SSD1306_CIRCLE_R_MIN]], 2 * r + 1, 2 * r + 1);
+}
+
+// Fill and draw all visible sprites into expected, the display state stays as it was
+static void drawAll(int n, SSD1306_COLOR background) {
+    const SSD1306_Display_t saved = *SSD1306_Display;
+    SSD1306_Target = expected;
+    memset(expected, (background == Black) ? 0x00 : 0xFF, SSD1306_BUFFER_SIZE);
+    for (int i = 0; i < n; i++) {
+        const SSD1306_Sprite_t* s = &sprites[i];
+        if (s->visible) {
+            ssd1306_DrawMaskPages(s->mask, s->w, (s->h + 7) / 8, s->x, s->y, s->color);
+        }
+    }
+    SSD1306_Target = SSD1306_Plane;
+    *SSD1306_Display = saved;
+}
+
+int main(void) {
+    srand(12);
+    sim_PanelReset(simPanel);
+    ssd1306_Init();
+
+    uint32_t gameBytes = 0;
+    uint32_t gameFrames = 0;
+    for (int run = 0; run < 600; run++) {
+        const int game = run % 2;
+        const int n = game ? 12 : 2 + R(SPRITES - 1);
+        const SSD1306_COLOR background = game ? Black : R(2);
+        for (int i = 0; i < n; i++) {
+            ssd1306_SpriteInit(&sprites[i], dot, 1, 1, (game || R(2)) ? White : Black);
+            if (!game || i >= 10) {
+                circle(&sprites[i], R(2));
+            }
+            ssd1306_SpriteMove(&sprites[i], R(140) - 10, R(80) - 10);
+        }
+        ssd1306_Fill(background);
+        ssd1306_ForgetSprites(sprites, n);
+        ssd1306_UpdateScreen();
+
+        for (int f = 0; f < 60; f++) {
+            for (int i = 0; i < n; i++) {
+                SSD1306_Sprite_t* s = &sprites[i];
+                if (game && i < 10) {
+                    if (R(10) == 0) {
+                        ssd1306_SpriteMove(s, 15 + R(99), 15 + R(35));
+                    }
+                    continue;
+                }
+                if (R(game ? 10 : 3) == 0) {
+                    ssd1306_SpriteMove(s, s->x + R(7) - 3, s->y + R(7) - 3);
+                }
+                if (!game && R(10) == 0) {
+                    s->visible = !s->visible;
+                }
+                if (R(15) == 0) {
+                    circle(s, 1);
+                }
+            }
+            ssd1306_UpdateSprites(sprites, n, background);
+            const uint32_t bytes = simPanel->Bytes;
+            ssd1306_UpdateScreen();
+            if (game) {
+                gameBytes += simPanel->Bytes - bytes;
+                gameFrames++;
+            }
+
+            drawAll(n, background);
+            if (memcmp(expected, SSD1306_Buffer, SSD1306_BUFFER_SIZE) != 0) {
+                printf("run %d frame %d, %d sprites: screenbuffer differs\n", run, f, n);
+                return 1;
+            }
+            if (!sim_PanelShows(simPanel, SSD1306_Buffer, SSD1306_PAGES)) {
+                printf("run %d frame %d: panel differs\n", run, f);
+                return 1;
+            }
+        }
+    }
+    printf("36000 frames, game frame %lu bytes on average\n", (unsigned long)(gameBytes / gameFrames));
+    return 0;
+}
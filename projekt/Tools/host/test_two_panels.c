@@ -0,0 +1,260 @@
+/*
+ * Two panels on two buses: the default 128x64 display on SPI and a 128x32
+ * HUD on its own I2C bus, each with its own panel model. A game frame on
+ * one and a score line on the other, both updated with
+ * ssd1306_UpdateScreenAsync(), are in flight at the same time and both
+ * panels show their screenbuffer afterwards. A second display on the SPI
+ * bus of the first waits for it, and the end of a transfer on the I2C bus
+ * leaves the SPI one alone. Prints the bus time of the frames at 10 MHz
+ * SPI and 400 kHz I2C, both buses at once against one after the other.
+ * With SSD1306_USE_DISPLAY_LIST, ssd1306_RenderList() on one panel while
+ * the last strip of the other one is still on its bus leaves that strip
+ * alone.
+ */
+// host:
+// host: -DSSD1306_USE_DISPLAY_LIST
+
+#include "ssd1306.c"
+#include "ssd1306_fonts.h"
+#include "sim.h"
+
+static SimPanel_t hudPanel;
+static I2C_HandleTypeDef hi2cHud;
+static uint8_t hudBuffer[SSD1306_BUFFER_SIZE] __ALIGNED(4);
+static uint8_t hudFront[SSD1306_BUFFER_SIZE] __ALIGNED(4);
+static SSD1306_Display_t hud = {
+    .Transport = &ssd1306_TransportI2C,
+    .Bus = &hi2cHud,
+    .Address = 0x3D << 1,
+    .Height = 32,
+    .Buffer = hudBuffer,
+    .FrontBuffer = hudFront,
+};
+
+// Background transfer on hi2cHud, one at a time
+static uint8_t* hudData;
+static uint16_t hudSize;
+static uint32_t hudBytes;
+
+static void hudWrite(uint16_t reg, const uint8_t* data, uint16_t size) {
+    for (uint16_t i = 0; i < size; i++) {
+        if (reg == 0x40) {
+            sim_PanelData(&hudPanel, data[i]);
+        } else {
+            sim_PanelCommand(&hudPanel, data[i]);
+        }
+    }
+    // Address and control byte
+    hudBytes += size + 2;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef* hi2c, uint16_t address, uint16_t reg, uint16_t regSize,
+                                    uint8_t* data, uint16_t size, uint32_t timeout) {
+    if (hi2c != &hi2cHud || address != hud.Address || hudData != NULL) {
+        hudPanel.Errors++;
+        return HAL_BUSY;
+    }
+    hudPanel.Transactions++;
+    hudPanel.Bytes += size;
+    hudWrite(reg, data, size);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef* hi2c, uint16_t address, uint16_t reg, uint16_t regSize,
+                                        uint8_t* data, uint16_t size) {
+    if (hi2c != &hi2cHud || address != hud.Address || reg != 0x40 || hudData != NULL) {
+        hudPanel.Errors++;
+        return HAL_BUSY;
+    }
+    hudPanel.Transactions++;
+    hudPanel.Bytes += size;
+    hudData = data;
+    hudSize = size;
+    return HAL_OK;
+}
+
+// The DMA of hi2cHud finishes, 0 if nothing was running
+static int hudRun(void) {
+    if (hudData == NULL) {
+        return 0;
+    }
+    uint8_t* data = hudData;
+    hudData = NULL;
+    hudWrite(0x40, data, hudSize);
+    HAL_I2C_MemTxCpltCallback(&hi2cHud);
+    return 1;
+}
+
+#ifdef SSD1306_USE_DISPLAY_LIST
+static SSD1306_DrawItem_t gameItems[16];
+static SSD1306_DrawItem_t hudItems[16];
+static SSD1306_DrawList_t gameList;
+static SSD1306_DrawList_t hudList;
+
+static void hudIdle(void) {
+    hudRun();
+}
+
+// Render a list on the selected display with only its own bus running while it waits
+static void renderAlone(const SSD1306_DrawList_t* list) {
+    const uint8_t hudSelected = (ssd1306_GetDisplay() == &hud);
+    simDma.Stall = hudSelected;
+    simDma.Idle = hudSelected ? hudIdle : NULL;
+    ssd1306_RenderList(list);
+    simDma.Stall = 0;
+    simDma.Idle = NULL;
+}
+
+// What the list shows, drawn into the screenbuffer of the selected display
+static void drawList(const SSD1306_DrawList_t* list) {
+    memset(SSD1306_Buffer, (list->background == Black) ? 0x00 : 0xFF, SSD1306_BUFFER_SIZE);
+    for (uint16_t i = 0; i < list->count; i++) {
+        ssd1306_DrawItem(&list->items[i]);
+    }
+}
+#endif
+
+int main(void) {
+    sim_PanelReset(simPanel);
+    sim_PanelReset(&hudPanel);
+    simDma.Queue = 1;
+
+    ssd1306_Init();
+    ssd1306_SelectDisplay(&hud);
+    ssd1306_Init();
+    if (!hudPanel.On || hudPanel.Errors != 0 || SSD1306.ClipY2 != 31) {
+        puts("HUD after init");
+        return 1;
+    }
+    ssd1306_SelectDisplay(NULL);
+    if (SSD1306.ClipY2 != 63 || ssd1306_GetDisplay() == &hud) {
+        puts("default display not selected");
+        return 1;
+    }
+
+    const int frames = 60;
+    int overlap = 0;
+    const uint32_t spiBytes = simPanel->Bytes;
+    hudBytes = 0;
+    for (int f = 0; f < frames; f++) {
+        ssd1306_SelectDisplay(NULL);
+        ssd1306_Fill(Black);
+        ssd1306_FillCircle(10 + f, 32, 12, White);
+        ssd1306_FillRectangle(0, 60, f * 2, 63, White);
+        ssd1306_UpdateScreenAsync();
+
+        char score[16];
+        snprintf(score, sizeof(score), "Score %d", f * 10);
+        ssd1306_SelectDisplay(&hud);
+        ssd1306_Fill(Black);
+        ssd1306_SetCursor(0, 0);
+        ssd1306_WriteString(score, Font_7x10, White);
+        ssd1306_FillRectangle(0, 28, f, 31, White);
+        ssd1306_UpdateScreenAsync();
+
+        overlap += (hud.TxBusy && SSD1306_DefaultDisplay.TxBusy);
+        while (sim_DmaRun() | hudRun()) {
+        }
+        if (!sim_PanelShows(&hudPanel, hudBuffer, 4)) {
+            printf("HUD frame %d\n", f);
+            return 1;
+        }
+        ssd1306_SelectDisplay(NULL);
+        if (!sim_PanelShows(simPanel, SSD1306_Buffer, SSD1306_PAGES)) {
+            printf("game frame %d\n", f);
+            return 1;
+        }
+    }
+    if (overlap != frames || simPanel->Errors != 0 || hudPanel.Errors != 0) {
+        printf("both in flight %d of %d frames, bus errors %lu and %lu\n", overlap, frames,
+               (unsigned long)simPanel->Errors, (unsigned long)hudPanel.Errors);
+        return 1;
+    }
+
+    // 0.8 us per SPI byte, 9 bits of 2.5 us per I2C byte
+    const double spiTime = (simPanel->Bytes - spiBytes) * 0.8e-6;
+    const double i2cTime = hudBytes * 22.5e-6;
+    const double together = (spiTime > i2cTime) ? spiTime : i2cTime;
+    printf("bus time of %d frames: SPI %.1f ms, I2C %.1f ms; %.0f frames/s on both buses at once, %.0f one after the other\n",
+           frames, spiTime * 1e3, i2cTime * 1e3, 2 * frames / together, 2 * frames / (spiTime + i2cTime));
+
+#ifdef SSD1306_USE_DISPLAY_LIST
+    // Lists on both panels, each rendered while the last strip of the other one is in flight
+    int listOverlap = 0;
+    for (int f = 0; f < frames; f++) {
+        char score[16];
+        snprintf(score, sizeof(score), "%d", f * 10);
+        ssd1306_ListBegin(&gameList, gameItems, 16, Black);
+        ssd1306_ListFillCircle(&gameList, 20 + f, 20 + f % 24, 12, White);
+        ssd1306_ListFillRectangle(&gameList, 0, 60, f * 2, 63, White);
+        const SSD1306_COLOR hudBackground = (f % 3 == 0) ? White : Black;
+        ssd1306_ListBegin(&hudList, hudItems, 16, hudBackground);
+        ssd1306_ListText(&hudList, f, 4 + f % 16, score, &Font_7x10, !hudBackground);
+        ssd1306_ListLine(&hudList, 0, 31 - f % 32, 127, f % 32, !hudBackground);
+
+        for (int k = 0; k < 2; k++) {
+            ssd1306_SelectDisplay((k == f % 2) ? &hud : NULL);
+            renderAlone((k == f % 2) ? &hudList : &gameList);
+        }
+        listOverlap += (hud.TxBusy && SSD1306_DefaultDisplay.TxBusy);
+        while (sim_DmaRun() | hudRun()) {
+        }
+
+        ssd1306_SelectDisplay(&hud);
+        drawList(&hudList);
+        if (!sim_PanelShows(&hudPanel, hudBuffer, 4)) {
+            printf("HUD list %d\n", f);
+            return 1;
+        }
+        ssd1306_SelectDisplay(NULL);
+        drawList(&gameList);
+        if (!sim_PanelShows(simPanel, SSD1306_Buffer, SSD1306_PAGES)) {
+            printf("game list %d\n", f);
+            return 1;
+        }
+    }
+    if (listOverlap != frames || simPanel->Errors != 0 || hudPanel.Errors != 0) {
+        printf("lists in flight on both buses %d of %d frames, bus errors %lu and %lu\n", listOverlap, frames,
+               (unsigned long)simPanel->Errors, (unsigned long)hudPanel.Errors);
+        return 1;
+    }
+#endif
+
+    // A second panel on hspi1, its own chip select
+    static uint8_t sameBuffer[SSD1306_BUFFER_SIZE] __ALIGNED(4);
+    static uint8_t sameFront[SSD1306_BUFFER_SIZE] __ALIGNED(4);
+    SSD1306_Display_t same = {
+        .Transport = &ssd1306_TransportSPI,
+        .Bus = &hspi1,
+        .CS_Port = GPIOA,
+        .CS_Pin = GPIO_PIN_0,
+        .DC_Port = SSD1306_DC_Port,
+        .DC_Pin = SSD1306_DC_Pin,
+        .Reset_Port = GPIOA,
+        .Reset_Pin = GPIO_PIN_1,
+        .Height = 64,
+        .Buffer = sameBuffer,
+        .FrontBuffer = sameFront,
+    };
+    ssd1306_SelectDisplay(&same);
+    ssd1306_Init();
+    ssd1306_SelectDisplay(NULL);
+    ssd1306_FillRectangle(0, 0, 127, 63, White);
+    ssd1306_UpdateScreenAsync();
+    if (!ssd1306_BusBusy(&same) || ssd1306_BusBusy(&hud)) {
+        puts("bus of the second SPI panel not busy, or the HUD bus busy");
+        return 1;
+    }
+    HAL_I2C_MemTxCpltCallback(&hi2cHud);
+    if (!SSD1306_DefaultDisplay.TxBusy) {
+        puts("end of an I2C transfer ended the SPI one");
+        return 1;
+    }
+    while (sim_DmaRun()) {
+    }
+    if (ssd1306_BusBusy(&same) || !sim_PanelShows(simPanel, SSD1306_Buffer, SSD1306_PAGES)) {
+        puts("default display after the shared bus transfer");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * ssd1306_UpdateScreenAsync() against background transfers that finish
+ * later, don't start, fail half way or never end: the panel ends up
+ * showing the frame every time, and no wait blocks forever.
+ */
+// host: -DSSD1306_USE_BUS_STATS
+// host: no-USE_DIRTY_UPDATE
+
+#include "ssd1306.c"
+#include "sim.h"
+
+static uint8_t drawn[SSD1306_BUFFER_SIZE];
+
+static int fail(const char* what, int frame) {
+    printf("%s, frame %d\n", what, frame);
+    return 1;
+}
+
+// A moving circle and a random dot, kept in drawn
+static void drawFrame(int f) {
+    ssd1306_Fill(Black);
+    ssd1306_FillCircle(20 + f % 80, 20 + f % 25, 3 + f % 10, White);
+    ssd1306_DrawPixel(rand() % 128, rand() % 64, White);
+    memcpy(drawn, SSD1306_Buffer, sizeof(drawn));
+}
+
+// Drawing of the next frame goes on while the transfer runs
+static void drawMeanwhile(void) {
+    ssd1306_FillCircle(64, 32, 20, White);
+    ssd1306_Fill(Black);
+}
+
+static int shows(int frame) {
+    while (sim_DmaRun()) {
+    }
+    if (ssd1306_IsTransferBusy()) {
+        return fail("still busy", frame);
+    }
+    if (!sim_PanelShows(simPanel, drawn, SSD1306_PAGES)) {
+        return fail("panel", frame);
+    }
+    return 0;
+}
+
+int main(void) {
+    srand(2);
+    sim_PanelReset(simPanel);
+    ssd1306_Init();
+    simDma.Queue = 1;
+
+    // Transfers finishing in the background
+    for (int f = 0; f < 300; f++) {
+        drawFrame(f);
+        ssd1306_UpdateScreenAsync();
+        drawMeanwhile();
+        if (shows(f)) {
+            return 1;
+        }
+    }
+
+    // The first or a later part can't start, it goes out blocking
+    for (int f = 0; f < 50; f++) {
+        drawFrame(f);
+        simDma.Refuse = 1;
+        ssd1306_UpdateScreenAsync();
+        if (shows(f)) {
+            return 1;
+        }
+        drawFrame(f + 7);
+        ssd1306_UpdateScreenAsync();
+        simDma.Refuse = 1 + f % 3;
+        drawMeanwhile();
+        if (shows(f)) {
+            return 1;
+        }
+    }
+    simDma.Refuse = 0;
+
+    // Without any DMA the update is done on return
+    drawFrame(1);
+    simDma.Refuse = 255;
+    ssd1306_UpdateScreenAsync();
+    simDma.Refuse = 0;
+    if (ssd1306_IsTransferBusy() || shows(-1)) {
+        return 1;
+    }
+
+    // A failed transfer ends it, the next update sends the whole screen again
+    for (int f = 0; f < 20; f++) {
+        drawFrame(f);
+        simDma.Fail = 1;
+        ssd1306_UpdateScreenAsync();
+        sim_DmaRun();
+        if (ssd1306_IsTransferBusy()) {
+            return fail("busy after the error", f);
+        }
+        ssd1306_UpdateScreenAsync();
+        if (shows(f)) {
+            return 1;
+        }
+    }
+
+    // A transfer that never ends is aborted by the waits after SSD1306_DMA_TIMEOUT_MS
+    for (int f = 0; f < 2; f++) {
+        drawFrame(f);
+        simDma.Stall = 1;
+        ssd1306_UpdateScreenAsync();
+        const uint32_t start = simTick;
+        if (f == 0) {
+            ssd1306_WaitForTransfer();
+        } else {
+            ssd1306_SetContrast(0x40); // Waits for the bus
+        }
+        if (ssd1306_IsTransferBusy() || simDma.Bus != NULL) {
+            return fail("not aborted", f);
+        }
+        if (simTick - start < SSD1306_DMA_TIMEOUT_MS || simTick - start > SSD1306_DMA_TIMEOUT_MS + 2) {
+            return fail("timeout", f);
+        }
+        simDma.Stall = 0;
+        ssd1306_UpdateScreenAsync();
+        if (shows(f)) {
+            return 1;
+        }
+    }
+
+    if (simPanel->Errors != 0 || simDma.Busy != 0) {
+        printf("%lu panel errors, %lu blocking writes on a busy bus\n",
+               (unsigned long)simPanel->Errors, (unsigned long)simDma.Busy);
+        return 1;
+    }
+    printf("%lu transfers, %lu refused, %lu failed, %lu aborted\n", (unsigned long)simDma.Started,
+           (unsigned long)simDma.Refused, (unsigned long)simDma.Failed, (unsigned long)simDma.Aborted);
+    return 0;
+}
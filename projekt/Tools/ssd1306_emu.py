@@ -0,0 +1,368 @@
+#!/usr/bin/env python3
+"""
+SSD1306 emulator: replays a bus trace written by ssd1306_BusTrace()
+(SSD1306_USE_BUS_TRACE) into the display RAM (GDDRAM) and reports the bus
+cost of every frame, so a transport or rendering change can be checked for
+the same screen content and its bandwidth without the panel.
+
+Trace lines, one per ssd1306_BusTrace() call, '#' starts a comment:
+    C 21 00 7F 22 00 07     command bytes
+    D FF 00 ...             data bytes, blocking write
+    B FF 00 ...             data bytes, background (DMA) write
+    E                       end of the background writes of a frame
+    F                       start of a screen update
+    R                       hardware reset
+
+The controller follows the datasheet: horizontal, vertical and page
+addressing with their column/page windows, display start line, offset,
+segment and COM remap, multiplex ratio, contrast, inverse, entire display on,
+display on/off and the scroll setup. Commands may be split across
+transactions. A frame runs from one F to the next, its background writes
+included even when they end after the next F. Its RAM is taken when all of
+its bytes are in.
+
+Bus cost per frame: payload bytes, transactions, CS assertions (SPI: one per
+command or data write, one per run of background writes up to E) and the
+time on the wire, SPI 8 clocks per byte, I2C 9 per byte plus the address and
+control byte of every transaction. The clock defaults are MX_SPI1_Init()
+(80 MHz / 8) and MX_I2C1_Init() (100 kHz).
+
+Usage: python3 Tools/ssd1306_emu.py [--i2c] [--clock HZ] [--frames] [--ascii]
+           [--ram] [--pgm out.pgm] [--scroll STEPS] trace.txt [other.txt]
+With a second trace the RAM of both is compared frame by frame.
+"""
+
+import sys
+
+WIDTH = 128
+PAGES = 8
+SPI_HZ = 10e6
+I2C_HZ = 100e3
+
+# Argument bytes of the multi-byte commands
+ARGS = {
+    0x20: 1, 0x21: 2, 0x22: 2, 0x23: 1, 0x26: 6, 0x27: 6, 0x29: 5, 0x2A: 5,
+    0x81: 1, 0x8D: 1, 0xA3: 2, 0xA8: 1, 0xD3: 1, 0xD5: 1, 0xD6: 1, 0xD9: 1,
+    0xDA: 1, 0xDB: 1,
+}
+MODES = ["horizontal", "vertical", "page", "invalid"]
+
+
+class Controller:
+    def __init__(self):
+        # Power-up RAM is undefined, start black
+        self.ram = [[0] * WIDTH for _ in range(PAGES)]
+        self.errors = []
+        self.reset()
+
+    def reset(self):
+        """Register values after RES#, the RAM is kept"""
+        self.mode = 2
+        self.col1, self.col2 = 0, WIDTH - 1
+        self.page1, self.page2 = 0, PAGES - 1
+        self.col = 0
+        self.page = 0
+        self.page_col = 0           # Column start of page addressing (0x00-0x1F)
+        self.start_line = 0
+        self.offset = 0
+        self.seg_remap = False
+        self.com_remap = False
+        self.mux = 63
+        self.contrast = 0x7F
+        self.inverse = False
+        self.entire_on = False
+        self.on = False
+        self.charge_pump = False
+        self.scroll = None          # Last scroll setup
+        self.scrolling = False
+        self.scroll_area = (0, 64)  # 0xA3: fixed rows on top, scrolled rows
+        self.pending = []
+
+    def error(self, text):
+        if len(self.errors) < 20:
+            self.errors.append(text)
+
+    def command(self, byte):
+        self.pending.append(byte)
+        op = self.pending[0]
+        if len(self.pending) > ARGS.get(op, 0):
+            args = self.pending[1:]
+            self.pending = []
+            self.execute(op, args)
+
+    def execute(self, op, a):
+        if op <= 0x0F:
+            self.page_col = (self.page_col & 0xF0) | op
+            self.col = self.page_col
+        elif op <= 0x1F:
+            self.page_col = (self.page_col & 0x0F) | ((op & 0x07) << 4)
+            self.col = self.page_col
+        elif op == 0x20:
+            self.mode = a[0] & 3
+            if self.mode == 3:
+                self.error("invalid addressing mode 0x20 %02X" % a[0])
+        elif op == 0x21:
+            self.col1, self.col2 = a[0] & 0x7F, a[1] & 0x7F
+            self.col = self.col1
+        elif op == 0x22:
+            self.page1, self.page2 = a[0] & 7, a[1] & 7
+            self.page = self.page1
+        elif op in (0x26, 0x27):
+            self.scroll = ("right" if op == 0x26 else "left", a[1] & 7, a[2] & 7, a[3] & 7, 0)
+        elif op in (0x29, 0x2A):
+            self.scroll = ("right" if op == 0x29 else "left", a[1] & 7, a[2] & 7, a[3] & 7, a[4] & 0x3F)
+        elif op == 0x2E:
+            self.scrolling = False
+        elif op == 0x2F:
+            if self.scroll is None:
+                self.error("0x2F without a scroll setup")
+            self.scrolling = True
+        elif 0x40 <= op <= 0x7F:
+            self.start_line = op & 0x3F
+        elif op == 0x81:
+            self.contrast = a[0]
+        elif op == 0x8D:
+            self.charge_pump = bool(a[0] & 0x04)
+        elif op in (0xA0, 0xA1):
+            self.seg_remap = op == 0xA1
+        elif op == 0xA3:
+            self.scroll_area = (a[0] & 0x3F, a[1] & 0x7F)
+        elif op in (0xA4, 0xA5):
+            self.entire_on = op == 0xA5
+        elif op in (0xA6, 0xA7):
+            self.inverse = op == 0xA7
+        elif op == 0xA8:
+            self.mux = max(a[0] & 0x3F, 15)
+        elif op in (0xAE, 0xAF):
+            self.on = op == 0xAF
+        elif 0xB0 <= op <= 0xB7:
+            self.page = op & 7
+        elif 0xC0 <= op <= 0xCF:
+            self.com_remap = op >= 0xC8
+        elif op == 0xD3:
+            self.offset = a[0] & 0x3F
+        elif op in (0x23, 0xD5, 0xD6, 0xD9, 0xDA, 0xDB, 0xE3):
+            pass                    # Timing, fade, zoom, COM pins, NOP: no effect on the RAM
+        else:
+            self.error("unknown command 0x%02X" % op)
+
+    def data(self, byte):
+        if self.pending:
+            self.error("data while command 0x%02X waits for arguments" % self.pending[0])
+            self.pending = []
+        if self.scrolling:
+            self.error("RAM written while scrolling")
+        self.ram[self.page][self.col] = byte
+        if self.mode == 0:
+            if self.col < self.col2:
+                self.col += 1
+            else:
+                self.col = self.col1
+                self.page = self.page + 1 if self.page < self.page2 else self.page1
+        elif self.mode == 1:
+            if self.page < self.page2:
+                self.page += 1
+            else:
+                self.page = self.page1
+                self.col = self.col + 1 if self.col < self.col2 else self.col1
+        else:
+            self.col = self.col + 1 if self.col < WIDTH - 1 else self.page_col
+
+    def pixel(self, row, col):
+        return (self.ram[row // 8][col] >> (row % 8)) & 1
+
+    def image(self, steps=0):
+        """Rows of 0/1 as the panel shows them after a scroll of steps"""
+        rows = self.mux + 1
+        if not self.on:
+            return [[0] * WIDTH for _ in range(rows)]
+        shift, vshift = 0, 0
+        if self.scrolling and steps:
+            direction, first, _, last, voffset = self.scroll
+            shift = steps if direction == "right" else -steps
+            vshift = steps * voffset
+        top, count = self.scroll_area
+        img = []
+        for y in range(rows):
+            # COM scan direction as mounted: C8 upright, C0 upside down
+            com = y if self.com_remap else rows - 1 - y
+            row = (self.start_line + com + self.offset) % 64
+            if vshift and top <= com < top + count:
+                row = (row + vshift) % 64
+            line = []
+            for x in range(WIDTH):
+                col = x if self.seg_remap else WIDTH - 1 - x
+                if shift and first <= row // 8 <= last:
+                    col = (col - shift) % WIDTH
+                on = 1 if self.entire_on else self.pixel(row, col)
+                line.append(on ^ self.inverse)
+            img.append(line)
+        return img
+
+
+class Frame:
+    def __init__(self, index):
+        self.index = index
+        self.bytes = 0
+        self.transactions = 0
+        self.cs = 0
+        self.wire_s = 0.0
+        self.ram = None
+
+
+def replay(path, i2c, clock):
+    """Controller after the trace and its frames, frame 0 is everything before the first F"""
+    ctrl = Controller()
+    frames = [Frame(0)]
+    chain = None                # Frame of the running background writes
+    held = None                 # Frame waiting for its background writes before its RAM is taken
+
+    def account(frame, n, cs):
+        frame.bytes += n
+        frame.transactions += 1
+        if i2c:
+            frame.wire_s += ((2 + n) * 9 + 2) / clock
+        else:
+            frame.cs += cs
+            frame.wire_s += n * 8 / clock
+
+    def snapshot(frame):
+        frame.ram = tuple(bytes(page) for page in ctrl.ram)
+
+    for number, line in enumerate(open(path), 1):
+        line = line.split("#")[0].split()
+        if not line:
+            continue
+        kind, values = line[0], [int(v, 16) for v in line[1:]]
+        current = frames[-1]
+        if kind == "F":
+            if chain is current:
+                held = current
+            else:
+                snapshot(current)
+            frames.append(Frame(len(frames)))
+        elif kind == "R":
+            ctrl.reset()
+        elif kind == "C":
+            account(current, len(values), 1)
+            for b in values:
+                ctrl.command(b)
+        elif kind == "D":
+            account(current, len(values), 1)
+            for b in values:
+                ctrl.data(b)
+        elif kind == "B":
+            if chain is None:
+                chain = current
+                account(chain, len(values), 1)
+            else:
+                account(chain, len(values), 0)
+            for b in values:
+                ctrl.data(b)
+        elif kind == "E":
+            if chain is not None and chain is held:
+                snapshot(held)
+                held = None
+            chain = None
+        else:
+            sys.exit("%s:%d: unknown line %r" % (path, number, line[0]))
+    for frame in frames:
+        if frame.ram is None:
+            snapshot(frame)
+    return ctrl, frames
+
+
+def summary(name, ctrl, frames, i2c):
+    updates = frames[1:] or frames
+    print("%s: %d frames after init, %s" % (name, len(frames) - 1, "I2C" if i2c else "SPI"))
+    print("  init: %d bytes, %d transactions, %d CS, %.0f us"
+          % (frames[0].bytes, frames[0].transactions, frames[0].cs, frames[0].wire_s * 1e6))
+    for label, get in (("bytes", lambda f: f.bytes), ("transactions", lambda f: f.transactions),
+                       ("CS", lambda f: f.cs), ("wire us", lambda f: f.wire_s * 1e6)):
+        values = [get(f) for f in updates]
+        print("  %-12s per frame mean %8.1f  max %8.1f  total %10.1f"
+              % (label, sum(values) / len(values), max(values), sum(values)))
+    print("  display %s, contrast 0x%02X, %s addressing, start line %d, %d rows, scroll %s"
+          % ("on" if ctrl.on else "off", ctrl.contrast, MODES[ctrl.mode], ctrl.start_line,
+             ctrl.mux + 1, ("on " if ctrl.scrolling else "off ") + repr(ctrl.scroll) if ctrl.scroll else "none"))
+    for text in ctrl.errors:
+        print("  ERROR: %s" % text)
+
+
+def compare(frames_a, frames_b):
+    """Index, page and column of the first RAM difference, None if the same"""
+    if len(frames_a) != len(frames_b):
+        print("frame counts differ: %d and %d, comparing the common ones" % (len(frames_a), len(frames_b)))
+    for fa, fb in zip(frames_a, frames_b):
+        if fa.ram != fb.ram:
+            for page in range(PAGES):
+                for col in range(WIDTH):
+                    if fa.ram[page][col] != fb.ram[page][col]:
+                        return fa.index, page, col
+    return None
+
+
+def write_pgm(path, img):
+    with open(path, "wb") as f:
+        f.write(b"P5\n%d %d\n255\n" % (WIDTH, len(img)))
+        f.write(bytes(255 if on else 0 for line in img for on in line))
+
+
+def option(args, name, default):
+    if name in args:
+        i = args.index(name)
+        value = args[i + 1]
+        del args[i:i + 2]
+        return value
+    return default
+
+
+def main():
+    args = sys.argv[1:]
+    i2c = "--i2c" in args
+    clock = float(option(args, "--clock", I2C_HZ if i2c else SPI_HZ))
+    pgm = option(args, "--pgm", None)
+    steps = int(option(args, "--scroll", 0))
+    flags = {a for a in args if a.startswith("--")}
+    paths = [a for a in args if not a.startswith("--")]
+    if not 1 <= len(paths) <= 2 or flags - {"--i2c", "--frames", "--ascii", "--ram"}:
+        sys.exit(__doc__)
+
+    ctrl, frames = replay(paths[0], i2c, clock)
+    summary(paths[0], ctrl, frames, i2c)
+    if "--frames" in flags:
+        print("\nframe    bytes  trans   CS  wire us")
+        for f in frames:
+            print("%5d  %7d  %5d  %3d  %7.0f" % (f.index, f.bytes, f.transactions, f.cs, f.wire_s * 1e6))
+    if "--ram" in flags:
+        print("\nGDDRAM")
+        for page in range(PAGES):
+            for col in range(0, WIDTH, 32):
+                print("%d:%3d  %s" % (page, col, " ".join("%02X" % b for b in ctrl.ram[page][col:col + 32])))
+    img = ctrl.image(steps)
+    if "--ascii" in flags:
+        print()
+        for line in img:
+            print("".join("#" if on else "." for on in line))
+    if pgm:
+        write_pgm(pgm, img)
+
+    if len(paths) == 2:
+        other, other_frames = replay(paths[1], i2c, clock)
+        print()
+        summary(paths[1], other, other_frames, i2c)
+        diff = compare(frames, other_frames)
+        print()
+        if diff is None:
+            print("RAM identical in all %d frames" % min(len(frames), len(other_frames)))
+        else:
+            print("RAM differs from frame %d on, page %d column %d" % diff)
+        a = sum(f.wire_s for f in frames[1:])
+        b = sum(f.wire_s for f in other_frames[1:])
+        if a > 0:
+            print("bus time of the frames: %.0f us -> %.0f us (%+.1f%%)" % (a * 1e6, b * 1e6, (b - a) / a * 100))
+        sys.exit(0 if diff is None else 1)
+
+
+if __name__ == "__main__":
+    main()